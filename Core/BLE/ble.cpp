@@ -55,6 +55,14 @@ static std::uint32_t g_callback_cnt {};
 /** BLE state. */
 static std::atomic<State> g_state {};
 
+/** Handle of the connection while CONNECTED. */
+static std::uint16_t g_connection {};
+
+/** RSSI callback, and when the RSSI was last read. */
+static rssi_callback g_rssi_callback {};
+static void *g_rssi_context {};
+static std::uint32_t g_rssi_read_ms {};
+
 /** Configured BLE role. */
 static Role g_ble_role {};
 
@@ -73,6 +81,9 @@ static etl::vector<std::uint8_t, 31> g_adv_uuid128s {};
 /** Passes callback info to registered event handlers. */
 static void process_aci_packet(void *data);
 
+/** Reads the RSSI if connected and it's due. */
+static void read_rssi();
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Public Implementations
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,7 +98,7 @@ bool init(Role role) {
 	uint8_t  hwVersion;
 	uint16_t fwVersion;
 	getBlueNRGVersion(&hwVersion, &fwVersion);
-	logger::log("HWver %d, FWver %d\n", hwVersion, fwVersion);
+	LOG("HWver %d, FWver %d\n", hwVersion, fwVersion);
     if (hwVersion > 0x30) { /* X-NUCLEO-IDB05A1 expansion board is used */
         g_expansion_board = ExpansionBoard::IDB05A1;
     } else {
@@ -115,13 +126,13 @@ bool init(Role role) {
                                          bdaddr);
 
 	if (ret) {
-	    logger::log("%s: Set public address failed: %02X\n", __func__, ret);
+	    LOG("%s: Set public address failed: %02X\n", __func__, ret);
 	    return false;
 	}
 
 	ret = aci_gatt_init();
 	if (ret) {
-	    logger::log("%s: GATT init failed: %02X\n", __func__, ret);
+	    LOG("%s: GATT init failed: %02X\n", __func__, ret);
 	    return false;
 	}
 
@@ -157,7 +168,7 @@ bool init(Role role) {
     }
 
     if (ret != BLE_STATUS_SUCCESS) {
-        logger::log("%s: GAP init failed: %02X\n", __func__, ret);
+        LOG("%s: GAP init failed: %02X\n", __func__, ret);
         return false;
     }
 
@@ -172,18 +183,18 @@ bool init(Role role) {
             BONDING);                  /* Bonding: enabled */
 
     if (ret != BLE_STATUS_SUCCESS) {
-        logger::log("%s: GAP set auth failed: %02X\n", __func__, ret);
+        LOG("%s: GAP set auth failed: %02X\n", __func__, ret);
         return false;
     }
 
     /* Set output power level. */
     ret = aci_hal_set_tx_power_level(1, 4);
     if (ret != BLE_STATUS_SUCCESS) {
-        logger::log("%s: Set TX power failed: %02X\n", __func__, ret);
+        LOG("%s: Set TX power failed: %02X\n", __func__, ret);
         return false;
     }
 
-    logger::log("%s: Successfully setup BLE\n", __func__);
+    LOG("%s: Successfully setup BLE\n", __func__);
     return true;
 }
 
@@ -205,7 +216,7 @@ namespace advertising {
         const auto uuid128_adv_len = g_adv_uuid128s.size();
 
         if (name_adv_len + uuid16_adv_len + uuid128_adv_len > 31) {
-            logger::log("%s: too many bytes in advertising packet: %d",
+            LOG("%s: too many bytes in advertising packet: %d",
                         __func__, name_adv_len + uuid16_adv_len + uuid128_adv_len);
             return false;
         }
@@ -244,7 +255,7 @@ namespace advertising {
                  0);                /* Max slave connection interval */
 
         if (ret != BLE_STATUS_SUCCESS) {
-            logger::log("%s: Set discoverable failed: %02X\n", __func__, ret);
+            LOG("%s: Set discoverable failed: %02X\n", __func__, ret);
             return false;
         }
 
@@ -260,7 +271,7 @@ namespace advertising {
 
         auto ret = aci_gap_set_non_discoverable();
         if (ret != BLE_STATUS_SUCCESS) {
-            logger::log("%s: Set non-discoverable failed: %02X\n", __func__, ret);
+            LOG("%s: Set non-discoverable failed: %02X\n", __func__, ret);
         }
 
         g_state = State::IDLE;
@@ -275,7 +286,7 @@ namespace advertising {
     bool add_name(const char *name) {
         auto len = std::strlen(name);
         if (len > 30) {
-            logger::log("%s: Name too long (%d > 30)\n", __func__, len);
+            LOG("%s: Name too long (%d > 30)\n", __func__, len);
             return false;
         }
 
@@ -287,7 +298,7 @@ namespace advertising {
 
     bool add_uuid16(std::uint16_t uuid) {
         if (g_adv_uuid16s.size() + 2 > 31) {
-            logger::log("%s: Too many UUIDs (%d bytes)\n",
+            LOG("%s: Too many UUIDs (%d bytes)\n",
                         __func__, g_adv_uuid16s.size() + 2);
             return false;
         }
@@ -304,7 +315,7 @@ namespace advertising {
 
     bool add_uuid128(const std::uint8_t *uuid) {
         if (g_adv_uuid128s.size() + 16 > 31) {
-            logger::log("%s: Too many UUIDs (%d bytes)\n",
+            LOG("%s: Too many UUIDs (%d bytes)\n",
                         __func__, g_adv_uuid128s.size() + 16);
             return false;
         }
@@ -330,6 +341,11 @@ void register_callback(event_callback callback, void *context) {
 	}
 }
 
+void set_rssi_callback(rssi_callback callback, void *context) {
+    g_rssi_context = context;
+    g_rssi_callback = callback;
+}
+
 void process_events() {
     hci_user_evt_proc();
 }
@@ -339,6 +355,7 @@ void thread(void *arg) {
 
     while (true) {
         process_events();
+        read_rssi();
     }
 }
 
@@ -346,7 +363,6 @@ void thread(void *arg) {
 // Private Implementations
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-// TODO: update state
 static void process_aci_packet(void *data) {
     auto *event = reinterpret_cast<hci_uart_pckt *>(data);
 
@@ -363,7 +379,9 @@ static void process_aci_packet(void *data) {
 	switch (hci_packet->evt) {
 
 	    case EVT_DISCONN_COMPLETE: {
-	        logger::log("Disconnected\n");
+	        /* The BlueNRG stops advertising once connected */
+	        g_state = State::IDLE;
+	        LOG("Disconnected\n");
 	    } break;
 
 	    case EVT_LE_META_EVENT: {
@@ -375,9 +393,13 @@ static void process_aci_packet(void *data) {
 	                auto *conn_event =
 	                        reinterpret_cast<evt_le_connection_complete *>(le_event->data);
 	                auto *addr = conn_event->peer_bdaddr;
-	                logger::log("Connected to: %02X:%02X:%02X:%02X:%02X:%02X",
-                                addr[5], addr[4], addr[3], addr[2], addr[1], addr[0]);
-	                logger::log(" (%d)\n", conn_event->handle);
+	                if (conn_event->status == BLE_STATUS_SUCCESS) {
+	                    g_connection = conn_event->handle;
+	                    g_state = State::CONNECTED;
+	                }
+	                LOG("Connected to: %02X:%02X:%02X:%02X:%02X:%02X (%d)\n",
+                                addr[5], addr[4], addr[3], addr[2], addr[1], addr[0],
+                                conn_event->handle);
 	            } break;
 
 	        }
@@ -387,4 +409,20 @@ static void process_aci_packet(void *data) {
 	}
 }
 
+static void read_rssi() {
+    if (g_rssi_callback == nullptr || g_state != State::CONNECTED ||
+            HAL_GetTick() - g_rssi_read_ms < RSSI_PERIOD_MS) {
+        return;
+    }
+    g_rssi_read_ms = HAL_GetTick();
+
+    std::uint16_t handle = g_connection;
+    std::int8_t rssi {};
+    if (hci_read_rssi(&handle, &rssi) != BLE_STATUS_SUCCESS) {
+        return;
+    }
+
+    g_rssi_callback(g_rssi_context, rssi);
+}
+
 } /* namespace ble */
@@ -57,12 +57,20 @@ enum class ExpansionBoard {
  */
 using event_callback = void (*)(void *context, hci_uart_pckt *data);
 
+/**
+ * Callback for a new RSSI reading of the connection, in dBm.
+ */
+using rssi_callback = void (*)(void *context, std::int8_t rssi);
+
 /* Number of event callbacks that can be registered. */
 constexpr inline std::uint32_t CALLBACK_COUNT { 10 };
 
 /* Size in bytes of a BLE MAC address */
 constexpr inline auto BDADDR_SIZE { 6 };
 
+/* Milliseconds between RSSI readings while connected */
+constexpr inline std::uint32_t RSSI_PERIOD_MS { 1000 };
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -135,6 +143,15 @@ void scan();
  */
 void register_callback(event_callback callback, void *context);
 
+/**
+ * Set a callback to be called with the connection's RSSI every RSSI_PERIOD_MS while connected.
+ * Called from the BLE thread, like event callbacks.
+ *
+ * @param     callback function pointer to be called with each reading, or nullptr for none.
+ * @param[in] context  context passed when the callback is triggered.
+ */
+void set_rssi_callback(rssi_callback callback, void *context);
+
 /**
  * Processes BLE events. Should be called from a main event loop repeatedly.
  */
@@ -0,0 +1,145 @@
+/*
+ * aa_font.cpp
+ *
+ * Drawing anti-aliased fonts.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "aa_font.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "stm32l5xx.h"  /* __SMLAD */
+#define AA_FONT_DSP 1
+#endif
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/** aa_blend() with the foreground split into channels once per glyph. */
+class portable_kernel {
+public:
+    explicit portable_kernel(std::uint16_t fg) :
+            _fg { fg },
+            _red { (fg >> 11) & 0x1FU }, _green { (fg >> 5) & 0x3FU }, _blue { fg & 0x1FU } {
+
+    }
+
+    std::uint16_t fg() const { return _fg; }
+
+    std::uint16_t operator()(std::uint16_t bg, std::uint32_t alpha) const {
+        const auto inverse = AA_OPAQUE - alpha;
+        const auto red = aa_div15(_red * alpha + ((bg >> 11) & 0x1FU) * inverse + 7U);
+        const auto green = aa_div15(_green * alpha + ((bg >> 5) & 0x3FU) * inverse + 7U);
+        const auto blue = aa_div15(_blue * alpha + (bg & 0x1FU) * inverse + 7U);
+        return static_cast<std::uint16_t>((red << 11) | (green << 5) | blue);
+    }
+
+protected:
+    std::uint16_t _fg;
+    std::uint32_t _red;
+    std::uint32_t _green;
+    std::uint32_t _blue;
+};
+
+#ifdef AA_FONT_DSP
+/**
+ * The same blend with each channel's two products and the rounding term in one SMLAD: the
+ * foreground channel sits in the low halfword and the background's in the high one, against
+ * alpha and 15 - alpha.
+ */
+class dsp_kernel : public portable_kernel {
+public:
+    using portable_kernel::portable_kernel;
+
+    std::uint16_t operator()(std::uint16_t bg, std::uint32_t alpha) const {
+        const std::uint32_t weights = alpha | ((AA_OPAQUE - alpha) << 16);
+        const auto red = aa_div15(__SMLAD(_red | ((bg & 0xF800U) << 5), weights, 7U));
+        const auto green = aa_div15(__SMLAD(_green | ((bg & 0x07E0U) << 11), weights, 7U));
+        const auto blue = aa_div15(__SMLAD(_blue | ((bg & 0x001FU) << 16), weights, 7U));
+        return static_cast<std::uint16_t>((red << 11) | (green << 5) | blue);
+    }
+};
+#endif
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Kernel>
+static void blend_glyph(const aa_font &font, char c, std::uint16_t *dst, std::uint32_t stride,
+                        const Kernel &kernel);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void aa_font::decode(char c, std::uint16_t *dst, std::uint32_t stride,
+                     const aa_palette &palette) const {
+    if (!contains(c)) {
+        for (std::uint32_t row = 0; row < height; ++row, dst += stride) {
+            std::fill_n(dst, width, palette.colors[0]);
+        }
+        return;
+    }
+
+    const auto *src = &coverage[(static_cast<std::uint8_t>(c) - first) * glyph_size()];
+    std::uint32_t nibble = 0;
+
+    for (std::uint32_t row = 0; row < height; ++row, dst += stride) {
+        for (std::uint32_t column = 0; column < width; ++column, ++nibble) {
+            const auto alpha = (src[nibble / 2U] >> ((~nibble & 1U) * 4U)) & 0x0FU;
+            dst[column] = palette.colors[alpha];
+        }
+    }
+}
+
+void aa_font::blend(char c, std::uint16_t *dst, std::uint32_t stride, std::uint16_t fg) const {
+#ifdef AA_FONT_DSP
+    blend_glyph(*this, c, dst, stride, dsp_kernel { fg });
+#else
+    blend_glyph(*this, c, dst, stride, portable_kernel { fg });
+#endif
+}
+
+void aa_font::blend_portable(char c, std::uint16_t *dst, std::uint32_t stride,
+                             std::uint16_t fg) const {
+    blend_glyph(*this, c, dst, stride, portable_kernel { fg });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Kernel>
+static void blend_glyph(const aa_font &font, char c, std::uint16_t *dst, std::uint32_t stride,
+                        const Kernel &kernel) {
+    if (!font.contains(c)) {
+        return;
+    }
+
+    const auto glyph = static_cast<std::uint8_t>(c) - font.first;
+    const auto *src = &font.coverage[glyph * font.glyph_size()];
+    std::uint32_t nibble = 0;
+
+    for (std::uint32_t row = 0; row < font.height; ++row, dst += stride) {
+        for (std::uint32_t column = 0; column < font.width; ++column, ++nibble) {
+            const auto alpha = (src[nibble / 2U] >> ((~nibble & 1U) * 4U)) & 0x0FU;
+
+            /* Most of a glyph is background or solid ink */
+            if (alpha == AA_OPAQUE) {
+                dst[column] = kernel.fg();
+            } else if (alpha != 0) {
+                dst[column] = kernel(dst[column], alpha);
+            }
+        }
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * aa_font.h
+ *
+ * Anti-aliased fonts: 4 bits of coverage per pixel instead of 1, so small text stays readable on
+ * the 240x240 panel. Glyphs are drawn either opaque, through a 16-color palette made once per
+ * pair of colors, or blended over whatever is already in the destination, one pixel at a time.
+ *
+ * The per-pixel blend uses the Cortex-M33 DSP extension (SMLAD: both weighted channel products
+ * and their sum in one instruction) when the compiler targets it, and plain C++ otherwise. Both
+ * kernels give the same result as aa_blend() for every input.
+ *
+ * The tables are generated by Host/font_pack (see font_aa.c), into aa_fonts.cpp.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/** Maximum coverage; a pixel at 0 is background, at AA_OPAQUE foreground. */
+inline constexpr std::uint32_t AA_OPAQUE { 15 };
+
+/** Rounds x / 15 to the nearest integer, exact for x up to 63 * 15 + 7. */
+constexpr std::uint32_t aa_div15(std::uint32_t x) {
+    return (x * 4370U) >> 16;
+}
+
+/**
+ * Blends two RGB565 colors, each channel (fg * alpha + bg * (15 - alpha)) / 15 rounded to
+ * nearest. The reference every blend path matches.
+ */
+constexpr std::uint16_t aa_blend(std::uint16_t fg, std::uint16_t bg, std::uint32_t alpha) {
+    const auto inverse = AA_OPAQUE - alpha;
+    const auto red = aa_div15(((fg >> 11) & 0x1FU) * alpha + ((bg >> 11) & 0x1FU) * inverse + 7U);
+    const auto green = aa_div15(((fg >> 5) & 0x3FU) * alpha + ((bg >> 5) & 0x3FU) * inverse + 7U);
+    const auto blue = aa_div15((fg & 0x1FU) * alpha + (bg & 0x1FU) * inverse + 7U);
+    return static_cast<std::uint16_t>((red << 11) | (green << 5) | blue);
+}
+
+/** Every coverage level of one foreground over one background. */
+struct aa_palette {
+    std::uint16_t colors[AA_OPAQUE + 1];
+
+    constexpr aa_palette(std::uint16_t fg, std::uint16_t bg) : colors {} {
+        for (std::uint32_t alpha = 0; alpha <= AA_OPAQUE; ++alpha) {
+            colors[alpha] = aa_blend(fg, bg, alpha);
+        }
+    }
+};
+
+struct aa_font {
+    /**
+     * Glyph after glyph, each width * height coverage nibbles row by row, high nibble first.
+     * Every glyph starts on a byte.
+     */
+    const std::uint8_t *coverage;
+    /** Cell size. */
+    std::uint16_t width;
+    std::uint16_t height;
+    /** Character of the first glyph, and the number of glyphs. */
+    std::uint8_t first;
+    std::uint8_t count;
+
+    /** Whether the font has a glyph for a character. */
+    constexpr bool contains(char c) const {
+        const auto index = static_cast<std::uint8_t>(c) - first;
+        return index >= 0 && index < count;
+    }
+
+    /** Bytes per glyph. */
+    constexpr std::size_t glyph_size() const {
+        return (std::size_t { width } * height + 1U) / 2U;
+    }
+
+    /** Flash taken by the coverage table, in bytes. */
+    constexpr std::size_t size() const {
+        return count * glyph_size();
+    }
+
+    /**
+     * Draws a whole cell, opaque. Characters outside the font are drawn as blank cells.
+     *
+     * @param[out] dst    the top-left pixel of the cell.
+     * @param      stride pixels from one row of dst to the next.
+     */
+    void decode(char c, std::uint16_t *dst, std::uint32_t stride, const aa_palette &palette) const;
+
+    /**
+     * Blends a glyph in fg over the pixels already in dst. Characters outside the font are
+     * skipped. Uses the DSP kernel where there is one.
+     */
+    void blend(char c, std::uint16_t *dst, std::uint32_t stride, std::uint16_t fg) const;
+
+    /** As blend(), always with the portable kernel. */
+    void blend_portable(char c, std::uint16_t *dst, std::uint32_t stride, std::uint16_t fg) const;
+};
+
+/** Font24 scaled to 12 and 16 pixels high, with coverage from the area each pixel covers. */
+extern const aa_font AAFont12;
+extern const aa_font AAFont16;
@@ -0,0 +1,1172 @@
+/*
+ * aa_fonts.cpp
+ *
+ * Anti-aliased fonts scaled from Font24. Generated by Host/font_pack/font_aa; don't edit.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "aa_font.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// AAFont12
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::uint8_t g_aa_font12_coverage[] = {
+    /* ' ' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '!' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, 0xCB,
+    0x00, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00,
+    0x00, 0x66, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '"' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x52, 0x73, 0x00, 0x00, 0xDB, 0x4F, 0x50, 0x00, 0x05, 0x30,
+    0x80, 0x00, 0x00, 0x53, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '#' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xB4, 0xC0, 0x00, 0x00, 0x5B, 0x4C, 0x00, 0x00, 0x7A, 0xD9,
+    0xE7, 0x00, 0x07, 0xAD, 0x9E, 0x70, 0x00, 0x7E, 0x9D, 0xA7, 0x00, 0x07, 0xE9, 0xDA, 0x70, 0x00,
+    0x0D, 0x3B, 0x40, 0x00, 0x00, 0xD3, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '$' */
+    0x00, 0x02, 0x60, 0x00, 0x00, 0x03, 0xAB, 0x53, 0x00, 0x03, 0xB8, 0x9F, 0x50, 0x00, 0x6C, 0x12,
+    0x73, 0x00, 0x00, 0x9F, 0xD6, 0x00, 0x00, 0x35, 0x06, 0xD5, 0x00, 0x06, 0xF3, 0x2D, 0x50, 0x00,
+    0x6C, 0xEF, 0x80, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '%' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0x20, 0x00, 0x06, 0xC1, 0x8C, 0x00, 0x00, 0x6C, 0x18,
+    0xC0, 0x00, 0x00, 0x9F, 0xFE, 0x70, 0x00, 0x3A, 0xF9, 0xD9, 0x00, 0x00, 0x5B, 0x03, 0xD0, 0x00,
+    0x03, 0xE9, 0xD9, 0x00, 0x00, 0x02, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '&' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x50, 0x00, 0x0D, 0x32,
+    0x60, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x18, 0x30, 0x06, 0xC4, 0xDF, 0xA3, 0x00,
+    0x3B, 0x89, 0xFA, 0x30, 0x00, 0x38, 0x84, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ''' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, 0x44,
+    0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '(' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x0B,
+    0xC0, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00,
+    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ')' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x10, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0x05, 0xF4,
+    0x00, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00,
+    0x05, 0xF4, 0x00, 0x00, 0x00, 0xDD, 0x20, 0x00, 0x00, 0x6C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '*' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x03, 0x76, 0xB5, 0x70, 0x00, 0x3A, 0xFF,
+    0xE7, 0x00, 0x00, 0x0C, 0xF4, 0x00, 0x00, 0x05, 0xB4, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '+' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x07, 0x7A, 0xD7, 0x83, 0x00, 0x77, 0xAD, 0x78, 0x30, 0x00, 0x04, 0xB0, 0x00, 0x00,
+    0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ',' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0x80, 0x00, 0x00, 0x04, 0xD2, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x06, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '-' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x78, 0x87, 0x70, 0x00, 0x37, 0x88, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '.' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x40, 0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x2F */
+    0x00, 0x00, 0x03, 0xD0, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x4E, 0x30, 0x00, 0x00, 0x08,
+    0x80, 0x00, 0x00, 0x02, 0xB2, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x3B, 0x20, 0x00, 0x00,
+    0x09, 0xB0, 0x00, 0x00, 0x03, 0xE3, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '0' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x00, 0xD3, 0x0B, 0x50, 0x00, 0x6A, 0x00,
+    0x3D, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x00, 0x6A, 0x00, 0x3D, 0x00, 0x03, 0xB1, 0x07, 0x90, 0x00,
+    0x09, 0x98, 0xB3, 0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '1' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8A, 0x00, 0x00, 0x06, 0xFB, 0xB0, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00,
+    0x37, 0xAD, 0x77, 0x00, 0x03, 0x78, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '2' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xA3, 0x00, 0x0E, 0x60, 0x07, 0x90, 0x00, 0x71, 0x00,
+    0x3D, 0x00, 0x00, 0x00, 0x2B, 0x30, 0x00, 0x00, 0x8D, 0x20, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+    0xAC, 0x88, 0x77, 0x00, 0x07, 0x78, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '3' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0x80, 0x00, 0x00, 0x71, 0x2D, 0x50, 0x00, 0x00, 0x02,
+    0xB3, 0x00, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x99, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
+    0x6C, 0x88, 0xD9, 0x00, 0x00, 0x78, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '4' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xC0, 0x00, 0x00, 0x08, 0xBC, 0x00, 0x00, 0x05, 0xB4,
+    0xC0, 0x00, 0x00, 0xD3, 0x4C, 0x00, 0x00, 0xA6, 0x04, 0xC0, 0x00, 0x0E, 0xFF, 0xFF, 0xD0, 0x00,
+    0x00, 0x69, 0xE7, 0x00, 0x00, 0x06, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '5' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF5, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x6A, 0x68,
+    0x20, 0x00, 0x06, 0xF9, 0x8D, 0x50, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00,
+    0xE8, 0x88, 0xD5, 0x00, 0x00, 0x78, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '6' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFD, 0x00, 0x00, 0x9D, 0x20, 0x00, 0x00, 0x3B, 0x10,
+    0x00, 0x00, 0x06, 0xCE, 0xFA, 0x30, 0x00, 0x6C, 0x10, 0x79, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x00,
+    0x0D, 0x98, 0xD9, 0x00, 0x00, 0x06, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '7' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x00, 0x06, 0xA0, 0x07, 0xD0, 0x00, 0x00, 0x00,
+    0xB5, 0x00, 0x00, 0x00, 0x4E, 0x30, 0x00, 0x00, 0x08, 0xC0, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00,
+    0x00, 0x4D, 0x20, 0x00, 0x00, 0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '8' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xE3, 0x00, 0x06, 0xC1, 0x07, 0xD0, 0x00, 0x3B, 0x10,
+    0x79, 0x00, 0x00, 0x5F, 0xFC, 0x00, 0x00, 0x3B, 0x10, 0x79, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x00,
+    0x3E, 0x98, 0xD9, 0x00, 0x00, 0x38, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '9' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xA3, 0x00, 0x06, 0xC1, 0x07, 0x90, 0x00, 0x6A, 0x00,
+    0x3D, 0x00, 0x00, 0xD9, 0x8D, 0xD0, 0x00, 0x00, 0x68, 0x5D, 0x00, 0x00, 0x00, 0x2D, 0x50, 0x00,
+    0x37, 0x8D, 0x80, 0x00, 0x03, 0x78, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ':' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF,
+    0x40, 0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xCF, 0x40, 0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ';' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+    0xF5, 0x00, 0x00, 0x00, 0x67, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x4D, 0x20, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '<' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x6D,
+    0xA3, 0x00, 0x07, 0xE9, 0x20, 0x00, 0x08, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x7E, 0x92, 0x00, 0x00,
+    0x00, 0x06, 0xDA, 0x30, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '=' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x88,
+    0x78, 0x30, 0x48, 0x78, 0x87, 0x83, 0x04, 0x87, 0x88, 0x78, 0x30, 0x48, 0x78, 0x87, 0x83, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '>' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x00, 0x3A, 0xD6,
+    0x00, 0x00, 0x00, 0x02, 0x9E, 0x70, 0x00, 0x00, 0x02, 0x9E, 0x70, 0x00, 0x3A, 0xD6, 0x00, 0x04,
+    0xBC, 0x50, 0x00, 0x00, 0x48, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '?' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x88, 0x20, 0x00, 0x03, 0xB8, 0x9E, 0x30, 0x00, 0x6A, 0x00,
+    0xB5, 0x00, 0x00, 0x00, 0x8E, 0x30, 0x00, 0x00, 0xCD, 0x20, 0x00, 0x00, 0x06, 0x20, 0x00, 0x00,
+    0x03, 0x82, 0x00, 0x00, 0x00, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '@' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xE3, 0x00, 0x00, 0xD7, 0x07, 0xD0, 0x00, 0x6A, 0x08,
+    0xFD, 0x00, 0x06, 0xA4, 0xD5, 0xD0, 0x00, 0x6A, 0x4B, 0x3D, 0x00, 0x06, 0xA0, 0x8F, 0xD0, 0x00,
+    0x3B, 0x10, 0x00, 0x00, 0x00, 0x9D, 0x89, 0xD0, 0x00, 0x00, 0x68, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'A' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x86, 0x00, 0x00, 0x03, 0x7A, 0xF4, 0x00, 0x00, 0x00, 0xC7,
+    0xC0, 0x00, 0x00, 0x5B, 0x0B, 0x50, 0x00, 0x0D, 0x98, 0xD9, 0x00, 0x06, 0xC8, 0x87, 0xB3, 0x08,
+    0xF8, 0x12, 0x7C, 0xB4, 0x88, 0x71, 0x27, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'B' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x88, 0x60, 0x00, 0x4B, 0xC8, 0x8D, 0x90, 0x00, 0x6A, 0x00,
+    0x3D, 0x00, 0x06, 0xC8, 0x8D, 0x90, 0x00, 0x6C, 0x88, 0x9E, 0x30, 0x06, 0xA0, 0x00, 0xA6, 0x04,
+    0xBC, 0x88, 0x7B, 0x30, 0x48, 0x78, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'C' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x30, 0x03, 0xE9, 0x89, 0xF6, 0x00, 0xA6, 0x00,
+    0x0A, 0x60, 0x0E, 0x20, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x0A, 0x60, 0x00, 0x53, 0x00,
+    0x3E, 0x98, 0x9E, 0x30, 0x00, 0x06, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'D' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x88, 0x20, 0x00, 0x4B, 0xC8, 0x8D, 0x90, 0x00, 0x6A, 0x00,
+    0x1B, 0x30, 0x06, 0xA0, 0x00, 0xA6, 0x00, 0x6A, 0x00, 0x0A, 0x60, 0x06, 0xA0, 0x01, 0xB3, 0x04,
+    0xBC, 0x88, 0xD9, 0x00, 0x48, 0x78, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'E' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x88, 0x77, 0x00, 0x4B, 0xC8, 0x89, 0xD0, 0x00, 0x6A, 0x26,
+    0x3D, 0x00, 0x06, 0xCA, 0xB0, 0x00, 0x00, 0x6C, 0xAB, 0x00, 0x00, 0x06, 0xA2, 0x63, 0xD0, 0x04,
+    0xBC, 0x88, 0x9D, 0x00, 0x48, 0x78, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'F' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x88, 0x78, 0x30, 0x07, 0xE9, 0x87, 0xC6, 0x00, 0x0D, 0x36,
+    0x2A, 0x60, 0x00, 0xD9, 0xD4, 0x00, 0x00, 0x0D, 0x9D, 0x40, 0x00, 0x00, 0xD3, 0x62, 0x00, 0x00,
+    0x7E, 0x98, 0x20, 0x00, 0x07, 0x78, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'G' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x30, 0x03, 0xE9, 0x89, 0xF6, 0x00, 0xA6, 0x00,
+    0x0A, 0x60, 0x0E, 0x20, 0x00, 0x00, 0x00, 0xE2, 0x0B, 0xFF, 0xE0, 0x0E, 0x60, 0x00, 0xA6, 0x00,
+    0x3E, 0x98, 0x9F, 0x60, 0x00, 0x06, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'H' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x52, 0x78, 0x70, 0x4B, 0xC5, 0x29, 0xE7, 0x00, 0x6A, 0x00,
+    0x3D, 0x00, 0x06, 0xC8, 0x89, 0xD0, 0x00, 0x6C, 0x88, 0x9D, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x04,
+    0xBC, 0x52, 0x9E, 0x70, 0x48, 0x75, 0x27, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'I' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x88, 0x77, 0x00, 0x03, 0x7A, 0xD7, 0x70, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00,
+    0x37, 0xAD, 0x77, 0x00, 0x03, 0x78, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'J' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x88, 0x78, 0x70, 0x00, 0x38, 0x8D, 0xA7, 0x00, 0x00, 0x00,
+    0xB5, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0xE2, 0x00, 0xB5, 0x00, 0x0E, 0x20, 0x0B, 0x50, 0x00,
+    0xE8, 0x89, 0xC0, 0x00, 0x00, 0x78, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'K' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x82, 0x58, 0x70, 0x4B, 0xC8, 0x2B, 0xA7, 0x00, 0x6A, 0x08,
+    0x80, 0x00, 0x06, 0xA8, 0xB0, 0x00, 0x00, 0x6F, 0x9D, 0x80, 0x00, 0x06, 0xA0, 0x2D, 0x50, 0x04,
+    0xBC, 0x82, 0x7E, 0x84, 0x48, 0x78, 0x21, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'L' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x86, 0x00, 0x00, 0x48, 0xE9, 0x60, 0x00, 0x00, 0x0D, 0x30,
+    0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x0D, 0x30, 0x05, 0x30, 0x00, 0xD3, 0x00, 0xA6, 0x04,
+    0x8E, 0x98, 0x7C, 0x60, 0x48, 0x78, 0x87, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'M' */
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x81, 0x00, 0x05, 0x84, 0x8F, 0xA0, 0x03, 0xFB, 0x40, 0xEF, 0x30,
+    0xBF, 0x60, 0x0E, 0x7B, 0x4C, 0xA6, 0x00, 0xE2, 0xCF, 0x4A, 0x60, 0x0E, 0x22, 0x60, 0xA6, 0x08,
+    0xF8, 0x52, 0x7C, 0xB4, 0x88, 0x75, 0x27, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'N' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x85, 0x06, 0x78, 0x70, 0x4B, 0xC1, 0x69, 0xE7, 0x00, 0x6F, 0xD2,
+    0x3D, 0x00, 0x06, 0xAC, 0x83, 0xD0, 0x00, 0x6A, 0x2D, 0x7D, 0x00, 0x06, 0xA0, 0x8F, 0xD0, 0x04,
+    0xBC, 0x82, 0x7D, 0x00, 0x48, 0x78, 0x21, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'O' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x20, 0x00, 0x03, 0xE9, 0x8D, 0x90, 0x00, 0xAA, 0x00,
+    0x3E, 0x30, 0x0E, 0x20, 0x00, 0xA6, 0x00, 0xE2, 0x00, 0x0A, 0x60, 0x0A, 0xA0, 0x03, 0xE3, 0x00,
+    0x3E, 0x98, 0xD9, 0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'P' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x88, 0x73, 0x00, 0x07, 0xE9, 0x89, 0xE3, 0x00, 0x0D, 0x30,
+    0x0A, 0x60, 0x00, 0xD3, 0x01, 0xB3, 0x00, 0x0D, 0xFF, 0xE7, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00,
+    0x7E, 0x98, 0x20, 0x00, 0x07, 0x78, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x20, 0x00, 0x03, 0xE9, 0x8D, 0x90, 0x00, 0xAA, 0x00,
+    0x3E, 0x30, 0x0E, 0x20, 0x00, 0xA6, 0x00, 0xE2, 0x00, 0x0A, 0x60, 0x0A, 0xA0, 0x03, 0xE3, 0x00,
+    0x3E, 0x98, 0xD9, 0x00, 0x00, 0x5F, 0xF4, 0x53, 0x00, 0x0D, 0x98, 0xDE, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'R' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x88, 0x60, 0x00, 0x4B, 0xC8, 0x8D, 0x90, 0x00, 0x6A, 0x00,
+    0x3D, 0x00, 0x06, 0xC8, 0x8D, 0x90, 0x00, 0x6C, 0x8D, 0x80, 0x00, 0x06, 0xA0, 0x2D, 0x50, 0x04,
+    0xBC, 0x82, 0x7E, 0x70, 0x48, 0x78, 0x20, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'S' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x88, 0x47, 0x00, 0x03, 0xE9, 0x8D, 0xD0, 0x00, 0x6A, 0x00,
+    0x3D, 0x00, 0x03, 0xED, 0x82, 0x00, 0x00, 0x00, 0x69, 0xF9, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x00,
+    0x6F, 0x98, 0xD9, 0x00, 0x03, 0x56, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'T' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x88, 0x78, 0x30, 0x0E, 0x8A, 0xD7, 0xC6, 0x00, 0xE2, 0x4B,
+    0x0A, 0x60, 0x07, 0x14, 0xB0, 0x53, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00,
+    0x07, 0xAD, 0x73, 0x00, 0x00, 0x78, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'U' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x52, 0x78, 0x70, 0x4B, 0xC5, 0x29, 0xE7, 0x00, 0x6A, 0x00,
+    0x3D, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x00, 0x6A, 0x00, 0x3D, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x00,
+    0x0D, 0x98, 0xD5, 0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'V' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x84, 0x78, 0x84, 0x4B, 0xC8, 0x47, 0xCB, 0x40, 0x0D, 0x30,
+    0x3D, 0x00, 0x00, 0x97, 0x07, 0x90, 0x00, 0x03, 0xB4, 0xB3, 0x00, 0x00, 0x0C, 0x7C, 0x00, 0x00,
+    0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'W' */
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x87, 0x50, 0x58, 0x88, 0x8F, 0x85, 0x05, 0x8F, 0x80, 0xE2, 0x04,
+    0x02, 0xE0, 0x06, 0xA4, 0xF4, 0xA6, 0x00, 0x6A, 0xC7, 0xCA, 0x60, 0x03, 0xEB, 0x2D, 0xE3, 0x00,
+    0x0D, 0x70, 0x7D, 0x00, 0x00, 0x71, 0x01, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'X' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x52, 0x78, 0x70, 0x4B, 0xC5, 0x29, 0xE7, 0x00, 0x09, 0x72,
+    0xB3, 0x00, 0x00, 0x08, 0xD2, 0x00, 0x00, 0x00, 0x8D, 0x20, 0x00, 0x00, 0x97, 0x2B, 0x30, 0x04,
+    0xBC, 0x52, 0x9E, 0x70, 0x48, 0x75, 0x27, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Y' */
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x87, 0x12, 0x78, 0x70, 0x4B, 0xC1, 0x29, 0xE7, 0x00, 0x09, 0x72,
+    0xB3, 0x00, 0x00, 0x3B, 0x98, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00,
+    0x07, 0xAD, 0x73, 0x00, 0x00, 0x78, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x88, 0x77, 0x00, 0x06, 0xC8, 0x89, 0xD0, 0x00, 0x6A, 0x02,
+    0xB3, 0x00, 0x03, 0x52, 0xB2, 0x00, 0x00, 0x03, 0xB2, 0x17, 0x00, 0x03, 0xB1, 0x03, 0xD0, 0x00,
+    0xE8, 0x88, 0x9D, 0x00, 0x07, 0x78, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '[' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00,
+    0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x5C */
+    0x06, 0xA0, 0x00, 0x00, 0x00, 0x3E, 0x30, 0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, 0x03, 0xB2,
+    0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x2B, 0x20, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+    0x00, 0x04, 0xE3, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ']' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00,
+    0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x0D, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '^' */
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x5D, 0x4D, 0x50, 0x00, 0x3B, 0x10,
+    0x1B, 0x30, 0x03, 0x10, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '_' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF7,
+    /* '`' */
+    0x00, 0x06, 0x20, 0x00, 0x00, 0x00, 0x6B, 0x60, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'a' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x3A, 0xFF, 0xF5, 0x00, 0x0E, 0x60, 0x0B, 0x50, 0x00,
+    0xA8, 0x89, 0xFA, 0x30, 0x00, 0x78, 0x65, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'b' */
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFA, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x6C, 0xEF,
+    0xE7, 0x00, 0x06, 0xC1, 0x01, 0xB3, 0x00, 0x6A, 0x00, 0x0A, 0x60, 0x06, 0xA0, 0x00, 0xA6, 0x04,
+    0xBF, 0x98, 0x9D, 0x00, 0x48, 0x56, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'c' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF,
+    0xEC, 0x60, 0x0A, 0xC1, 0x01, 0xC6, 0x00, 0xE2, 0x00, 0x05, 0x30, 0x0E, 0x60, 0x00, 0x53, 0x00,
+    0x3E, 0x98, 0x9E, 0x30, 0x00, 0x06, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'd' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x00, 0x3A, 0xFF,
+    0xBD, 0x00, 0x0A, 0x60, 0x07, 0xD0, 0x00, 0xE2, 0x00, 0x3D, 0x00, 0x0E, 0x20, 0x03, 0xD0, 0x00,
+    0x6C, 0x88, 0xDE, 0x70, 0x00, 0x38, 0x84, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'e' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF,
+    0xE7, 0x00, 0x0A, 0x60, 0x01, 0xB3, 0x00, 0xEF, 0xFF, 0xFF, 0x60, 0x0E, 0x20, 0x00, 0x00, 0x00,
+    0x6C, 0x88, 0x7C, 0x60, 0x00, 0x38, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'f' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x60, 0x00, 0x5B, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+    0xFD, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x05, 0xB0, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00,
+    0x7A, 0xD8, 0x73, 0x00, 0x07, 0x78, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'g' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF,
+    0xBF, 0xE0, 0x0A, 0x60, 0x07, 0xD0, 0x00, 0xE2, 0x00, 0x3D, 0x00, 0x0E, 0x20, 0x03, 0xD0, 0x00,
+    0x6C, 0x88, 0xDD, 0x00, 0x00, 0x38, 0x85, 0xD0, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0xDF, 0xFA,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'h' */
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFA, 0x00, 0x00, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x6C, 0xEF,
+    0xE3, 0x00, 0x06, 0xC1, 0x07, 0xD0, 0x00, 0x6A, 0x00, 0x3D, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x04,
+    0xBC, 0x52, 0x9E, 0x70, 0x48, 0x75, 0x27, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'i' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFB,
+    0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00,
+    0x77, 0xAD, 0x78, 0x30, 0x07, 0x78, 0x87, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'j' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+    0xF5, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00,
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0x02, 0xD5, 0x00, 0x06, 0xFF, 0xD6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'k' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x0D, 0x3B,
+    0xFD, 0x00, 0x00, 0xD5, 0xB2, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x00, 0xDB, 0xD2, 0x00, 0x00,
+    0x7E, 0x38, 0xE8, 0x30, 0x07, 0x71, 0x27, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'l' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00,
+    0x77, 0xAD, 0x78, 0x30, 0x07, 0x78, 0x87, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'm' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0xFB,
+    0xFE, 0x30, 0x0E, 0x64, 0xD2, 0xA6, 0x00, 0xE2, 0x4B, 0x0A, 0x60, 0x0E, 0x24, 0xB0, 0xA6, 0x08,
+    0xF8, 0x6D, 0x6A, 0xB4, 0x88, 0x74, 0x86, 0x58, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'n' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0xEF,
+    0xE3, 0x00, 0x06, 0xC1, 0x07, 0xD0, 0x00, 0x6A, 0x00, 0x3D, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x04,
+    0xBC, 0x52, 0x9E, 0x70, 0x48, 0x75, 0x27, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'o' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF,
+    0xA3, 0x00, 0x0A, 0xC1, 0x07, 0xE3, 0x00, 0xE2, 0x00, 0x0A, 0x60, 0x0E, 0x60, 0x01, 0xC6, 0x00,
+    0x3E, 0x98, 0xD9, 0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'p' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0xEF,
+    0xE7, 0x00, 0x06, 0xC1, 0x01, 0xB3, 0x00, 0x6A, 0x00, 0x0A, 0x60, 0x06, 0xA0, 0x00, 0xA6, 0x00,
+    0x6F, 0x98, 0x9D, 0x00, 0x06, 0xA6, 0x86, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF,
+    0xBF, 0xE0, 0x0A, 0x60, 0x07, 0xD0, 0x00, 0xE2, 0x00, 0x3D, 0x00, 0x0E, 0x20, 0x03, 0xD0, 0x00,
+    0x6C, 0x88, 0xDD, 0x00, 0x00, 0x38, 0x85, 0xD0, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0xBF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'r' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB8,
+    0xFE, 0x30, 0x00, 0x5F, 0x92, 0x53, 0x00, 0x05, 0xB0, 0x00, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00,
+    0x7A, 0xD8, 0x73, 0x00, 0x07, 0x78, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 's' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF,
+    0xFD, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x00, 0x3E, 0xFD, 0x73, 0x00, 0x03, 0x50, 0x69, 0xD0, 0x00,
+    0x6C, 0x88, 0xD9, 0x00, 0x03, 0x78, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 't' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x30, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+    0xF5, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x0D, 0x30, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00,
+    0x09, 0x98, 0x9F, 0x60, 0x00, 0x06, 0x87, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'u' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFA, 0x04,
+    0xFD, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x00, 0x6A, 0x00, 0x3D, 0x00, 0x06, 0xA0, 0x03, 0xD0, 0x00,
+    0x3B, 0x88, 0xDE, 0x70, 0x00, 0x38, 0x84, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'v' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x30,
+    0xBF, 0xE0, 0x06, 0xA0, 0x03, 0xD0, 0x00, 0x0D, 0x30, 0xB5, 0x00, 0x00, 0x5B, 0x4C, 0x00, 0x00,
+    0x03, 0xEF, 0x80, 0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'w' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFA, 0x00,
+    0xBF, 0x60, 0x0E, 0x28, 0x83, 0xD0, 0x00, 0xA6, 0xAA, 0x79, 0x00, 0x06, 0xFB, 0xBF, 0x50, 0x00,
+    0x3E, 0x34, 0xC0, 0x00, 0x00, 0x71, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'x' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB4,
+    0xFF, 0x60, 0x00, 0x97, 0x2B, 0x30, 0x00, 0x00, 0x8D, 0x20, 0x00, 0x00, 0x3B, 0x98, 0x00, 0x00,
+    0x7E, 0x72, 0xDA, 0x30, 0x07, 0x75, 0x27, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xB0,
+    0x3F, 0xF7, 0x03, 0xB1, 0x01, 0xB3, 0x00, 0x09, 0x70, 0x79, 0x00, 0x00, 0x3B, 0x4B, 0x30, 0x00,
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x02, 0xB2, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x0E, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+    0xFD, 0x00, 0x06, 0xA0, 0x2B, 0x30, 0x00, 0x00, 0x2B, 0x20, 0x00, 0x00, 0x3B, 0x21, 0x70, 0x00,
+    0x3E, 0x98, 0x9D, 0x00, 0x03, 0x78, 0x87, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '{' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xC0, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x03, 0xE8, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00,
+    0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x2D, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '|' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00,
+    0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '}' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x00, 0x2D, 0x80, 0x00, 0x00, 0x04, 0xD2, 0x00, 0x00,
+    0x00, 0x4B, 0x00, 0x00, 0x00, 0x04, 0xB0, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '~' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xED, 0x21, 0x70, 0x00, 0xE6, 0x8D, 0xD9, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const aa_font AAFont12 {
+    g_aa_font12_coverage, 9, 12, ' ', 95,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// AAFont16
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::uint8_t g_aa_font16_coverage[] = {
+    /* ' ' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '!' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00,
+    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x60, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x15, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '"' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x83, 0xFB, 0x00,
+    0x00, 0x06, 0xF8, 0x3F, 0xB0, 0x00, 0x00, 0x0A, 0x00, 0x82, 0x00, 0x00, 0x00, 0xA0, 0x08, 0x20,
+    0x00, 0x00, 0x06, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '#' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x2A, 0x10, 0x00, 0x00, 0x0B, 0x83, 0xF2, 0x00,
+    0x00, 0x00, 0xB8, 0x3F, 0x20, 0x00, 0x04, 0x5D, 0xA7, 0xF6, 0x20, 0x00, 0xBF, 0xFF, 0xFF, 0xF6,
+    0x00, 0x00, 0x2C, 0x56, 0xC1, 0x00, 0x00, 0x7C, 0xEA, 0xEC, 0xA4, 0x00, 0x07, 0xCE, 0xAE, 0xCA,
+    0x40, 0x00, 0x06, 0xD0, 0xC7, 0x00, 0x00, 0x00, 0x6D, 0x0C, 0x70, 0x00, 0x00, 0x06, 0xD0, 0xC7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '$' */
+    0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x2D, 0xFD, 0xAB, 0x00,
+    0x00, 0x1C, 0x75, 0x7F, 0xB0, 0x00, 0x01, 0xF7, 0x02, 0xA8, 0x00, 0x00, 0x09, 0xEA, 0x80, 0x00,
+    0x00, 0x00, 0x08, 0xAE, 0xF5, 0x00, 0x00, 0x1A, 0x20, 0x4A, 0xB0, 0x00, 0x01, 0xFD, 0x01, 0xAB,
+    0x00, 0x00, 0x1F, 0xEA, 0xBF, 0x50, 0x00, 0x01, 0xA4, 0xCE, 0x50, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '%' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x80, 0x00, 0x00, 0x00, 0x9E, 0xAE, 0xA1, 0x00,
+    0x00, 0x1F, 0x70, 0x6F, 0x20, 0x00, 0x01, 0xF7, 0x06, 0xF2, 0x00, 0x00, 0x09, 0xEA, 0xEF, 0xB4,
+    0x00, 0x00, 0x5D, 0xFF, 0xF5, 0x00, 0x00, 0x05, 0xDF, 0x7A, 0xE4, 0x00, 0x00, 0x0B, 0x80, 0x0D,
+    0x60, 0x00, 0x00, 0xBD, 0x25, 0xE6, 0x00, 0x00, 0x01, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x55,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '&' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0x00,
+    0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x6D, 0x02, 0xA1, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0xA1, 0x00, 0x00, 0x00, 0x04, 0xEF, 0x90, 0x9A, 0x10, 0x01, 0xFA, 0x5E, 0xFE,
+    0xA1, 0x00, 0x1F, 0x40, 0x6F, 0xB0, 0x00, 0x00, 0x4E, 0xFF, 0xCE, 0xF1, 0x00, 0x00, 0x45, 0x52,
+    0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ''' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x07, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '(' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x01, 0xAE, 0x40,
+    0x00, 0x00, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x05, 0xEA, 0x10,
+    0x00, 0x00, 0x00, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x70,
+    0x00, 0x00, 0x00, 0x02, 0xDC, 0x10, 0x00, 0x00, 0x00, 0x09, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xB0, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x60, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ')' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x20, 0x00, 0x00, 0x00, 0x01, 0xCE, 0x30, 0x00, 0x00,
+    0x00, 0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00,
+    0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 0x00, 0x2D, 0xF3, 0x00, 0x00, 0x00, 0x06, 0xFA, 0x10,
+    0x00, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '*' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x1A, 0x97, 0xC5, 0xA4, 0x00, 0x01, 0xAE, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x5F, 0xFA, 0x10,
+    0x00, 0x00, 0x05, 0xDB, 0xA1, 0x00, 0x00, 0x00, 0xB8, 0x3F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '+' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x45, 0x5A, 0xD5, 0x55, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ',' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8A, 0x10, 0x00, 0x00, 0x00, 0x2D, 0x70, 0x00, 0x00, 0x00, 0x07, 0xD2,
+    0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '-' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x05, 0x55, 0x55, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '.' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1A, 0xA5, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x15, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x2F */
+    0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x00, 0x05, 0xE6, 0x00, 0x00, 0x00, 0x01, 0xAB, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x06, 0xC1, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x60, 0x00, 0x00, 0x00, 0x05, 0xD2, 0x00,
+    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x50, 0x00, 0x00, 0x00, 0x1C, 0xD0, 0x00,
+    0x00, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '0' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA5, 0x00, 0x00, 0x00, 0x2C, 0xAA, 0xD5, 0x00,
+    0x00, 0x06, 0xD0, 0x08, 0xB0, 0x00, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6,
+    0x00, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6, 0x00, 0x01, 0xC7, 0x00, 0x3D,
+    0x40, 0x00, 0x06, 0xD0, 0x08, 0xB0, 0x00, 0x00, 0x08, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x15, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '1' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x5D, 0xFC, 0x00, 0x00,
+    0x00, 0x1F, 0xEA, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x05, 0x55, 0x55,
+    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '2' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xA5, 0x00, 0x00, 0x04, 0xFB, 0xAA, 0xDB, 0x00,
+    0x00, 0xBB, 0x10, 0x03, 0xD4, 0x00, 0x07, 0x60, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x00, 0x05, 0xC2,
+    0x00, 0x00, 0x00, 0x27, 0xC1, 0x00, 0x00, 0x00, 0x1C, 0xD2, 0x00, 0x00, 0x00, 0x2C, 0x50, 0x00,
+    0x00, 0x00, 0x1C, 0x70, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x45, 0x55, 0x55,
+    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '3' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA5, 0x00, 0x00, 0x00, 0x6E, 0xAB, 0xF5, 0x00,
+    0x00, 0x02, 0x40, 0x1A, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x00, 0x1A, 0xBA, 0x10,
+    0x00, 0x00, 0x01, 0xAB, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x15, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0x60, 0x00, 0x1A, 0x20, 0x05, 0xE6, 0x00, 0x01, 0xCF, 0xFF, 0xC8, 0x00, 0x00, 0x02, 0x55, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '4' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xF2, 0x00,
+    0x00, 0x00, 0x1C, 0x9F, 0x20, 0x00, 0x00, 0x0B, 0x83, 0xF2, 0x00, 0x00, 0x04, 0xD3, 0x3F, 0x20,
+    0x00, 0x00, 0x9A, 0x03, 0xF2, 0x00, 0x00, 0x7B, 0x10, 0x3F, 0x20, 0x00, 0x0B, 0xFF, 0xFF, 0xFF,
+    0x60, 0x00, 0x45, 0x55, 0x7F, 0x62, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x15, 0x55,
+    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '5' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0x80, 0x00, 0x01, 0xFB, 0xAA, 0xA8, 0x00,
+    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF4, 0x55, 0x20, 0x00, 0x00, 0x1F, 0xCF, 0xFC, 0x80,
+    0x00, 0x01, 0xA9, 0x00, 0x5C, 0x20, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x0D,
+    0x60, 0x00, 0x76, 0x00, 0x05, 0xC2, 0x00, 0x07, 0xCF, 0xFF, 0xC8, 0x00, 0x00, 0x02, 0x55, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '6' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xA4, 0x00, 0x00, 0x05, 0xFB, 0xAA, 0x40,
+    0x00, 0x04, 0xEA, 0x10, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x5A, 0xA5, 0x00,
+    0x00, 0x01, 0xFE, 0xAA, 0xDB, 0x00, 0x00, 0x1F, 0x70, 0x03, 0xD4, 0x00, 0x01, 0xF4, 0x00, 0x0D,
+    0x60, 0x00, 0x09, 0xA0, 0x05, 0xE6, 0x00, 0x00, 0x4B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x15, 0x55,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '7' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0xAA, 0xA4, 0x00, 0x01, 0xFB, 0xAA, 0xAE, 0x60,
+    0x00, 0x1F, 0x40, 0x05, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xB0,
+    0x00, 0x00, 0x00, 0x03, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, 0x0C, 0x70,
+    0x00, 0x00, 0x00, 0x05, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '8' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xAA, 0x10, 0x00, 0x00, 0x9E, 0xAA, 0xDD, 0x20,
+    0x00, 0x1F, 0x70, 0x03, 0xE6, 0x00, 0x01, 0xC7, 0x00, 0x3D, 0x40, 0x00, 0x02, 0xCA, 0xAD, 0x50,
+    0x00, 0x00, 0x2C, 0xAA, 0xD5, 0x00, 0x00, 0x1C, 0x70, 0x03, 0xD4, 0x00, 0x01, 0xF4, 0x00, 0x0D,
+    0x60, 0x00, 0x1F, 0xA0, 0x05, 0xE6, 0x00, 0x00, 0x4E, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x45, 0x55,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '9' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xA5, 0x00, 0x00, 0x00, 0x9E, 0xAA, 0xDB, 0x00,
+    0x00, 0x1F, 0x70, 0x03, 0xD4, 0x00, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x09, 0xA0, 0x05, 0xE6,
+    0x00, 0x00, 0x4B, 0xFF, 0xCE, 0x60, 0x00, 0x00, 0x15, 0x52, 0xD6, 0x00, 0x00, 0x00, 0x01, 0xAB,
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x01, 0xFF, 0xFB, 0x50, 0x00, 0x00, 0x05, 0x55, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ':' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1A, 0xA5, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x15, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ';' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x51,
+    0x00, 0x00, 0x00, 0x05, 0xEA, 0x10, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x60,
+    0x00, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '<' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x50,
+    0x00, 0x00, 0x00, 0x05, 0xEF, 0x10, 0x00, 0x01, 0x5D, 0xC8, 0x00, 0x00, 0x04, 0xBF, 0x72, 0x00,
+    0x00, 0x5C, 0xD9, 0x00, 0x00, 0x00, 0x05, 0xCD, 0x90, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xF7, 0x20,
+    0x00, 0x00, 0x00, 0x15, 0xDC, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '=' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x55, 0x55, 0x55, 0x50, 0x05, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAA, 0xAA, 0xAA, 0xAA, 0x10, 0x4A, 0xAA, 0xAA, 0xAA,
+    0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '>' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x30, 0x00, 0x00, 0x00,
+    0x05, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x01, 0xAE, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xEA, 0x10,
+    0x00, 0x00, 0x00, 0x02, 0xAE, 0x94, 0x00, 0x00, 0x00, 0x2A, 0xE9, 0x40, 0x00, 0x04, 0xAE, 0xA1,
+    0x00, 0x00, 0x1A, 0xEA, 0x40, 0x00, 0x00, 0x5F, 0xD2, 0x00, 0x00, 0x00, 0x02, 0x53, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '?' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xA1, 0x00,
+    0x00, 0x1C, 0x75, 0x7F, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x8B, 0x00, 0x00, 0x05, 0x10, 0x2D, 0xB0,
+    0x00, 0x00, 0x01, 0x5D, 0xC1, 0x00, 0x00, 0x00, 0x2F, 0xD2, 0x00, 0x00, 0x00, 0x01, 0xA2, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x45, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '@' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x10, 0x00, 0x00, 0x2D, 0xDA, 0xDD, 0x20,
+    0x00, 0x06, 0xE3, 0x03, 0xE6, 0x00, 0x01, 0xF4, 0x06, 0xFF, 0x60, 0x00, 0x1F, 0x45, 0xEA, 0xE6,
+    0x00, 0x01, 0xF4, 0x7C, 0x0D, 0x60, 0x00, 0x1F, 0x47, 0xC0, 0xD6, 0x00, 0x01, 0xF4, 0x09, 0xFF,
+    0x60, 0x00, 0x1F, 0x40, 0x15, 0x52, 0x00, 0x00, 0x6E, 0x30, 0x04, 0x20, 0x00, 0x02, 0xDD, 0xAA,
+    0xE6, 0x00, 0x00, 0x01, 0xAA, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'A' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x20, 0x00,
+    0x00, 0x05, 0x5A, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xF5, 0xF2, 0x00, 0x00, 0x00, 0x8A, 0x2A, 0x80,
+    0x00, 0x00, 0x2C, 0x50, 0x8B, 0x00, 0x00, 0x06, 0xEA, 0xAD, 0xE4, 0x00, 0x01, 0xFB, 0xAA, 0xAB,
+    0x90, 0x00, 0x7B, 0x10, 0x00, 0x4F, 0x10, 0xFF, 0xFD, 0x03, 0xFF, 0xFF, 0x55, 0x55, 0x40, 0x15,
+    0x55, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'B' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xF5, 0x00,
+    0x02, 0x6F, 0x75, 0x5A, 0xE4, 0x00, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0x40, 0x05, 0xE6,
+    0x00, 0x01, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x1F, 0x75, 0x55, 0xEC, 0x10, 0x01, 0xF4, 0x00, 0x04,
+    0xF1, 0x00, 0x1F, 0x40, 0x00, 0x4F, 0x10, 0x5F, 0xFF, 0xFF, 0xFE, 0x40, 0x02, 0x55, 0x55, 0x55,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'C' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF, 0xF9, 0xF1,
+    0x00, 0x1C, 0xE5, 0x55, 0xEF, 0x10, 0x04, 0xD2, 0x00, 0x04, 0xF1, 0x00, 0xB9, 0x00, 0x00, 0x15,
+    0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xB1, 0x00, 0x01,
+    0x50, 0x00, 0x1F, 0xA0, 0x00, 0xAF, 0x10, 0x00, 0x4B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x15, 0x55,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'D' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xA4, 0x00,
+    0x02, 0x6F, 0x75, 0x5A, 0xE4, 0x00, 0x01, 0xF4, 0x00, 0x0A, 0x90, 0x00, 0x1F, 0x40, 0x00, 0x4F,
+    0x10, 0x01, 0xF4, 0x00, 0x04, 0xF1, 0x00, 0x1F, 0x40, 0x00, 0x4F, 0x10, 0x01, 0xF4, 0x00, 0x07,
+    0xC1, 0x00, 0x1F, 0x40, 0x05, 0xE6, 0x00, 0x5F, 0xFF, 0xFF, 0xF8, 0x00, 0x02, 0x55, 0x55, 0x55,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'E' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x60,
+    0x02, 0x6F, 0x75, 0x55, 0xE6, 0x00, 0x01, 0xF4, 0x24, 0x0D, 0x60, 0x00, 0x1F, 0x47, 0xC0, 0x42,
+    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0x7A, 0xC0, 0x00, 0x00, 0x01, 0xF4, 0x58, 0x0D,
+    0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x60, 0x02, 0x55, 0x55, 0x55,
+    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'F' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF1,
+    0x00, 0x49, 0xE5, 0x55, 0x7F, 0x10, 0x00, 0x6D, 0x04, 0x24, 0xF1, 0x00, 0x06, 0xD0, 0xC7, 0x15,
+    0x00, 0x00, 0x6F, 0xFF, 0x70, 0x00, 0x00, 0x06, 0xE5, 0xD7, 0x00, 0x00, 0x00, 0x6D, 0x08, 0x50,
+    0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x45, 0x55, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'G' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF, 0xF9, 0xF1,
+    0x00, 0x1C, 0xE5, 0x55, 0xEF, 0x10, 0x04, 0xD2, 0x00, 0x04, 0xF1, 0x00, 0xB9, 0x00, 0x00, 0x15,
+    0x00, 0x0B, 0x90, 0x04, 0x55, 0x54, 0x00, 0xB9, 0x00, 0xCF, 0xFF, 0xB0, 0x0B, 0xB1, 0x00, 0x04,
+    0xF1, 0x00, 0x4F, 0xA0, 0x00, 0xAF, 0x10, 0x00, 0x4B, 0xFF, 0xFE, 0xA1, 0x00, 0x00, 0x15, 0x55,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'H' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x83, 0xFF, 0xFB,
+    0x02, 0x6F, 0x73, 0x15, 0xE9, 0x40, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6,
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x1F, 0x75, 0x55, 0xE6, 0x00, 0x01, 0xF4, 0x00, 0x0D,
+    0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6, 0x00, 0x5F, 0xFF, 0x83, 0xFF, 0xFB, 0x02, 0x55, 0x53, 0x15,
+    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'I' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x60,
+    0x00, 0x05, 0x5A, 0xD5, 0x52, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x05, 0x55, 0x55,
+    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'J' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB,
+    0x00, 0x00, 0x45, 0x5A, 0xD5, 0x40, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x08, 0xB0,
+    0x00, 0x04, 0x30, 0x00, 0x8B, 0x00, 0x00, 0xB9, 0x00, 0x08, 0xB0, 0x00, 0x0B, 0x90, 0x00, 0x8B,
+    0x00, 0x00, 0xB9, 0x00, 0x2D, 0x50, 0x00, 0x07, 0xCF, 0xFE, 0xA1, 0x00, 0x00, 0x02, 0x55, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'K' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF3, 0x8F, 0xFB,
+    0x02, 0x6F, 0x75, 0x18, 0xD5, 0x40, 0x01, 0xF4, 0x06, 0xC1, 0x00, 0x00, 0x1F, 0x45, 0xC2, 0x00,
+    0x00, 0x01, 0xF9, 0xFD, 0x20, 0x00, 0x00, 0x1F, 0xE5, 0xDC, 0x10, 0x00, 0x01, 0xF4, 0x02, 0xDB,
+    0x00, 0x00, 0x1F, 0x40, 0x08, 0xE4, 0x00, 0x5F, 0xFF, 0xF3, 0x0D, 0xFF, 0x52, 0x55, 0x55, 0x10,
+    0x45, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'L' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFC, 0x00, 0x00,
+    0x02, 0x59, 0xE5, 0x40, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x2A, 0x10, 0x00, 0x6D, 0x00, 0x04,
+    0xF1, 0x00, 0x06, 0xD0, 0x00, 0x4F, 0x10, 0x5F, 0xFF, 0xFF, 0xFF, 0xF1, 0x02, 0x55, 0x55, 0x55,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'M' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB1, 0x00, 0x07, 0xFF,
+    0x55, 0xCF, 0x40, 0x00, 0xDF, 0x62, 0x0B, 0xFD, 0x00, 0x8F, 0xF1, 0x00, 0xBB, 0xC5, 0x2D, 0x9F,
+    0x10, 0x0B, 0x98, 0xA7, 0xC5, 0xF1, 0x00, 0xB9, 0x2F, 0xF7, 0x4F, 0x10, 0x0B, 0x90, 0x58, 0x04,
+    0xF1, 0x00, 0xB9, 0x00, 0x00, 0x4F, 0x10, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x55, 0x55, 0x53, 0x15,
+    0x55, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'N' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF4, 0x0C, 0xFF, 0xFB,
+    0x02, 0x6F, 0xA0, 0x45, 0xE9, 0x40, 0x01, 0xFF, 0xA1, 0x0D, 0x60, 0x00, 0x1F, 0x9F, 0x30, 0xD6,
+    0x00, 0x01, 0xF5, 0xCD, 0x2D, 0x60, 0x00, 0x1F, 0x42, 0xD7, 0xD6, 0x00, 0x01, 0xF4, 0x09, 0xFF,
+    0x60, 0x00, 0x1F, 0x40, 0x1A, 0xF6, 0x00, 0x5F, 0xFF, 0xF3, 0x0D, 0x60, 0x02, 0x55, 0x55, 0x10,
+    0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'O' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF, 0xA4, 0x00,
+    0x00, 0x1C, 0xE5, 0x5A, 0xE4, 0x00, 0x04, 0xF4, 0x00, 0x0D, 0x90, 0x00, 0xBB, 0x10, 0x00, 0x7F,
+    0x10, 0x0B, 0x90, 0x00, 0x04, 0xF1, 0x00, 0xB9, 0x00, 0x00, 0x4F, 0x10, 0x07, 0xF4, 0x00, 0x0D,
+    0xC1, 0x00, 0x1F, 0xA0, 0x05, 0xE6, 0x00, 0x00, 0x4B, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x15, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'P' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x20,
+    0x00, 0x49, 0xE5, 0x55, 0xEC, 0x10, 0x00, 0x6D, 0x00, 0x04, 0xF1, 0x00, 0x06, 0xD0, 0x00, 0x4F,
+    0x10, 0x00, 0x6E, 0x55, 0x5E, 0x60, 0x00, 0x06, 0xFF, 0xFF, 0x62, 0x00, 0x00, 0x6D, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x45, 0x55, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF, 0xA4, 0x00,
+    0x00, 0x1C, 0xE5, 0x5A, 0xE4, 0x00, 0x04, 0xF4, 0x00, 0x0D, 0x90, 0x00, 0xBB, 0x10, 0x00, 0x7F,
+    0x10, 0x0B, 0x90, 0x00, 0x04, 0xF1, 0x00, 0xB9, 0x00, 0x00, 0x4F, 0x10, 0x07, 0xF4, 0x00, 0x0D,
+    0xC1, 0x00, 0x1F, 0xA0, 0x05, 0xE6, 0x00, 0x00, 0x4E, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0xBF, 0xF7,
+    0x2A, 0x10, 0x00, 0x6E, 0xAA, 0xDF, 0xC1, 0x00, 0x02, 0x40, 0x03, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'R' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xF5, 0x00,
+    0x02, 0x6F, 0x75, 0x5A, 0xE4, 0x00, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0x40, 0x05, 0xE6,
+    0x00, 0x01, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x1F, 0x75, 0xDC, 0x10, 0x00, 0x01, 0xF4, 0x02, 0xDB,
+    0x00, 0x00, 0x1F, 0x40, 0x08, 0xE4, 0x00, 0x5F, 0xFF, 0xF3, 0x0A, 0xFB, 0x02, 0x55, 0x55, 0x10,
+    0x15, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'S' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xAE, 0x60,
+    0x00, 0x1C, 0xE5, 0x5A, 0xF6, 0x00, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0xB5, 0x00, 0x42,
+    0x00, 0x00, 0x4B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x15, 0x7F, 0xE4, 0x00, 0x01, 0xF4, 0x00, 0x0D,
+    0x60, 0x00, 0x1F, 0xA0, 0x05, 0xE6, 0x00, 0x01, 0xFC, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x25, 0x55,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'T' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF1,
+    0x00, 0xBB, 0x5A, 0xD5, 0x7F, 0x10, 0x0B, 0x90, 0x7C, 0x04, 0xF1, 0x00, 0xB9, 0x07, 0xC0, 0x4F,
+    0x10, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00, 0x00, 0x02, 0x55, 0x55,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'U' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x83, 0xFF, 0xFB,
+    0x02, 0x6F, 0x73, 0x15, 0xE9, 0x40, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6,
+    0x00, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6, 0x00, 0x01, 0xF4, 0x00, 0x0D,
+    0x60, 0x00, 0x09, 0xA0, 0x05, 0xC2, 0x00, 0x00, 0x4B, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x15, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'V' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF,
+    0x52, 0x6F, 0x75, 0x25, 0x7F, 0x62, 0x00, 0x6D, 0x00, 0x0D, 0x60, 0x00, 0x06, 0xD0, 0x00, 0xD6,
+    0x00, 0x00, 0x0B, 0x80, 0x8B, 0x00, 0x00, 0x00, 0x5D, 0x4D, 0x50, 0x00, 0x00, 0x02, 0xF5, 0xF2,
+    0x00, 0x00, 0x00, 0x1A, 0xCA, 0x10, 0x00, 0x00, 0x00, 0x5D, 0x50, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'W' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x8F, 0xFF,
+    0xF5, 0xCB, 0x53, 0x03, 0x5B, 0xC5, 0x0B, 0x90, 0x03, 0x00, 0x9B, 0x00, 0x4D, 0x25, 0xD5, 0x2D,
+    0x40, 0x01, 0xF4, 0xAC, 0xA4, 0xF1, 0x00, 0x1F, 0x5F, 0x5F, 0x5F, 0x10, 0x01, 0xCF, 0x82, 0xDF,
+    0xC1, 0x00, 0x06, 0xF8, 0x08, 0xF6, 0x00, 0x00, 0x6D, 0x00, 0x0D, 0x60, 0x00, 0x02, 0x40, 0x00,
+    0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'X' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x83, 0xFF, 0xFB,
+    0x02, 0x6F, 0x73, 0x15, 0xE9, 0x40, 0x00, 0x4D, 0x31, 0xA8, 0x00, 0x00, 0x00, 0x5D, 0xBA, 0x10,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE5, 0x00, 0x00, 0x00, 0x2C, 0x52, 0xD5,
+    0x00, 0x00, 0x1C, 0x70, 0x03, 0xD4, 0x00, 0x5F, 0xFF, 0x83, 0xFF, 0xFB, 0x02, 0x55, 0x53, 0x15,
+    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFD, 0x03, 0xFF, 0xFB,
+    0x02, 0x6F, 0x70, 0x15, 0xE9, 0x40, 0x00, 0x4D, 0x31, 0xA8, 0x00, 0x00, 0x00, 0xB8, 0x3F, 0x20,
+    0x00, 0x00, 0x01, 0xCE, 0x50, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00, 0x00, 0x02, 0x55, 0x55,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'Z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x60,
+    0x00, 0x1F, 0x75, 0x55, 0xE6, 0x00, 0x01, 0xF4, 0x01, 0xA8, 0x00, 0x00, 0x1F, 0x40, 0x9A, 0x10,
+    0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x10, 0x94, 0x00, 0x00, 0x9A, 0x00, 0x0D,
+    0x60, 0x00, 0x7B, 0x10, 0x00, 0xD6, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x45, 0x55, 0x55,
+    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '[' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x7E, 0xA8, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0x00, 0x00, 0x00, 0x02, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x5C */
+    0x01, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x30, 0x00, 0x00,
+    0x00, 0x02, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA1,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, 0x00, 0x00, 0x02, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xE4, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* ']' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x4A, 0xCC, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '^' */
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x05, 0xD5, 0x00, 0x00, 0x00, 0x05, 0xFC, 0xF5, 0x00,
+    0x00, 0x00, 0xBA, 0x2A, 0xB0, 0x00, 0x00, 0x9A, 0x00, 0x0A, 0x90, 0x00, 0x1B, 0x10, 0x00, 0x1B,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '_' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+    /* '`' */
+    0x00, 0x01, 0x51, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'a' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xA1, 0x00, 0x00, 0x05, 0x55, 0x5A, 0x80,
+    0x00, 0x00, 0x04, 0x55, 0xAB, 0x00, 0x00, 0x1A, 0xEF, 0xFF, 0xB0, 0x00, 0x0B, 0xD2, 0x00, 0x8B,
+    0x00, 0x00, 0xB9, 0x00, 0x2D, 0xB0, 0x00, 0x01, 0xCF, 0xFE, 0xDF, 0xF1, 0x00, 0x02, 0x55, 0x43,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'b' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAA, 0x20, 0x00, 0x00, 0x00, 0x4A, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xFF, 0xF6, 0x20, 0x00, 0x1F, 0xE5, 0x55, 0xE6,
+    0x00, 0x01, 0xF4, 0x00, 0x04, 0xF1, 0x00, 0x1F, 0x40, 0x00, 0x4F, 0x10, 0x01, 0xF4, 0x00, 0x04,
+    0xF1, 0x00, 0x1F, 0xA0, 0x00, 0xA9, 0x00, 0x5F, 0xFC, 0xFF, 0xFB, 0x40, 0x02, 0x55, 0x25, 0x55,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'c' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF, 0xF9, 0xF1, 0x00, 0x1C, 0xE5, 0x55, 0xEF,
+    0x10, 0x0B, 0xD2, 0x00, 0x04, 0xF1, 0x00, 0xB9, 0x00, 0x00, 0x15, 0x00, 0x0B, 0xB1, 0x00, 0x01,
+    0x50, 0x00, 0x4F, 0xA0, 0x00, 0xAF, 0x10, 0x00, 0x4B, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x15, 0x55,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'd' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xA4, 0x00, 0x00, 0x00, 0x02, 0xAE, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x5D, 0xFF, 0xAE, 0x60, 0x00, 0x1F, 0x75, 0x5A, 0xF6,
+    0x00, 0x0B, 0x90, 0x00, 0x0D, 0x60, 0x00, 0xB9, 0x00, 0x00, 0xD6, 0x00, 0x0B, 0x90, 0x00, 0x0D,
+    0x60, 0x00, 0x4D, 0x20, 0x05, 0xE6, 0x00, 0x01, 0xAE, 0xFF, 0xCE, 0xFB, 0x00, 0x00, 0x45, 0x52,
+    0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'e' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xF6, 0x20, 0x00, 0x1F, 0x75, 0x55, 0xE6,
+    0x00, 0x0B, 0xB5, 0x55, 0x57, 0xF1, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x10, 0x0B, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x4D, 0x20, 0x00, 0x2A, 0x10, 0x01, 0xAE, 0xFF, 0xFE, 0xA1, 0x00, 0x00, 0x45, 0x55,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'f' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAA, 0xAA, 0x10, 0x00, 0x05, 0xDA, 0xAA, 0xA1,
+    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x45, 0xDA, 0x55, 0x52,
+    0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x45, 0x55, 0x55,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'g' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xAE, 0xFB, 0x00, 0x1F, 0x75, 0x5A, 0xF9,
+    0x40, 0x0B, 0x90, 0x00, 0x0D, 0x60, 0x00, 0xB9, 0x00, 0x00, 0xD6, 0x00, 0x0B, 0x90, 0x00, 0x0D,
+    0x60, 0x00, 0x4D, 0x20, 0x05, 0xE6, 0x00, 0x01, 0xAE, 0xFF, 0xCE, 0x60, 0x00, 0x00, 0x45, 0x52,
+    0xD6, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x60, 0x00, 0x04, 0xAA, 0xAD, 0xD2, 0x00, 0x00, 0x4A, 0xAA,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'h' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xAA, 0x20, 0x00, 0x00, 0x00, 0x4A, 0xF4, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x01, 0xF9, 0xFF, 0xF5, 0x00, 0x00, 0x1F, 0xE5, 0x5A, 0xE4,
+    0x00, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6, 0x00, 0x01, 0xF4, 0x00, 0x0D,
+    0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6, 0x00, 0x5F, 0xFF, 0x83, 0xFF, 0xFB, 0x02, 0x55, 0x53, 0x15,
+    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'i' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x5A, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x45, 0x55, 0x55,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'j' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x08, 0x50, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x05, 0x55, 0x5A, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8B,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0xB0, 0x00, 0x00, 0x00, 0x01, 0xAB, 0x00, 0x00, 0x1A, 0xAA, 0xBF, 0x50, 0x00, 0x01, 0xAA, 0xA8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'k' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x90, 0x00, 0x00, 0x00, 0x07, 0xCD, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x0C, 0xFF, 0x60, 0x00, 0x06, 0xD0, 0xCA, 0x52,
+    0x00, 0x00, 0x6E, 0xAC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x6E, 0xCD, 0x20,
+    0x00, 0x00, 0x06, 0xD2, 0xDC, 0x10, 0x00, 0x0B, 0xFD, 0x03, 0xFF, 0xF1, 0x00, 0x45, 0x40, 0x15,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'l' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAA, 0x80, 0x00, 0x00, 0x01, 0xAA, 0xCC, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x45, 0x55, 0x55,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'm' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBD, 0xF9, 0xFF, 0x90, 0x05, 0xCF, 0x7A, 0xFA, 0x7F,
+    0x10, 0x0B, 0x90, 0x7C, 0x04, 0xF1, 0x00, 0xB9, 0x07, 0xC0, 0x4F, 0x10, 0x0B, 0x90, 0x7C, 0x04,
+    0xF1, 0x00, 0xB9, 0x07, 0xC0, 0x4F, 0x10, 0xFF, 0xFD, 0x7F, 0xF5, 0xFF, 0x55, 0x55, 0x42, 0x55,
+    0x25, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'n' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF9, 0xFF, 0xF5, 0x00, 0x02, 0x6F, 0xE5, 0x5A, 0xE4,
+    0x00, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6, 0x00, 0x01, 0xF4, 0x00, 0x0D,
+    0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6, 0x00, 0x5F, 0xFF, 0x83, 0xFF, 0xFB, 0x02, 0x55, 0x53, 0x15,
+    0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'o' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF, 0xA4, 0x00, 0x00, 0x1C, 0xE5, 0x5A, 0xE4,
+    0x00, 0x0B, 0xD2, 0x00, 0x0A, 0xF1, 0x00, 0xB9, 0x00, 0x00, 0x4F, 0x10, 0x0B, 0xB1, 0x00, 0x07,
+    0xF1, 0x00, 0x4F, 0xA0, 0x05, 0xE9, 0x00, 0x00, 0x4B, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x15, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'p' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF9, 0xFF, 0xF6, 0x20, 0x02, 0x6F, 0xE5, 0x55, 0xE6,
+    0x00, 0x01, 0xF4, 0x00, 0x04, 0xF1, 0x00, 0x1F, 0x40, 0x00, 0x4F, 0x10, 0x01, 0xF4, 0x00, 0x04,
+    0xF1, 0x00, 0x1F, 0xA0, 0x00, 0xA9, 0x00, 0x01, 0xFC, 0xFF, 0xFB, 0x40, 0x00, 0x1F, 0x45, 0x55,
+    0x10, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xAF, 0xBA, 0x20, 0x00, 0x00, 0x4A, 0xAA, 0xA2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'q' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xAE, 0xFB, 0x00, 0x1F, 0x75, 0x5A, 0xF9,
+    0x40, 0x0B, 0x90, 0x00, 0x0D, 0x60, 0x00, 0xB9, 0x00, 0x00, 0xD6, 0x00, 0x0B, 0x90, 0x00, 0x0D,
+    0x60, 0x00, 0x4D, 0x20, 0x05, 0xE6, 0x00, 0x01, 0xAE, 0xFF, 0xCE, 0x60, 0x00, 0x00, 0x45, 0x52,
+    0xD6, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0x00, 0x00, 0x8A, 0xEC, 0x70, 0x00, 0x00, 0x08,
+    0xAA, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'r' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x86, 0xFF, 0x90, 0x00, 0x45, 0xDD, 0xEA, 0x7F,
+    0x10, 0x00, 0x0B, 0xD2, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x45, 0x55, 0x55,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 's' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0x60, 0x00, 0x1C, 0x75, 0x55, 0xE6,
+    0x00, 0x01, 0xF7, 0x54, 0x09, 0x40, 0x00, 0x09, 0xFF, 0xEA, 0x80, 0x00, 0x00, 0x51, 0x08, 0xAE,
+    0x60, 0x00, 0x1F, 0x40, 0x05, 0xE6, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x05, 0x55, 0x55,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 't' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x49, 0xE5, 0x55, 0x40,
+    0x00, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0xD0, 0x00, 0x9A, 0x10, 0x00, 0x08, 0xFF, 0xFE, 0xA1, 0x00, 0x00, 0x15, 0x55,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'u' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF4, 0x03, 0xFF, 0x60, 0x02, 0x6F, 0x40, 0x15, 0xE6,
+    0x00, 0x01, 0xF4, 0x00, 0x0D, 0x60, 0x00, 0x1F, 0x40, 0x00, 0xD6, 0x00, 0x01, 0xF4, 0x00, 0x0D,
+    0x60, 0x00, 0x1F, 0x40, 0x05, 0xE6, 0x00, 0x00, 0x4E, 0xFF, 0xCE, 0xFB, 0x00, 0x00, 0x45, 0x52,
+    0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'v' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFD, 0x00, 0x8F, 0xFB, 0x02, 0x6F, 0x70, 0x03, 0xE9,
+    0x40, 0x01, 0xC7, 0x00, 0x3D, 0x40, 0x00, 0x06, 0xD0, 0x08, 0xB0, 0x00, 0x00, 0x0B, 0x83, 0xF2,
+    0x00, 0x00, 0x00, 0xBD, 0xBF, 0x20, 0x00, 0x00, 0x02, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x15, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'w' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF4, 0x00, 0x8F, 0xF1, 0x02, 0xCB, 0x15, 0x23, 0xE9,
+    0x00, 0x0B, 0x92, 0xFC, 0x0D, 0x60, 0x00, 0x4D, 0x4A, 0xB5, 0xC2, 0x00, 0x01, 0xFF, 0x8C, 0xFB,
+    0x00, 0x00, 0x1F, 0xE3, 0x6F, 0x50, 0x00, 0x00, 0x6D, 0x03, 0xF2, 0x00, 0x00, 0x02, 0x40, 0x15,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'x' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x83, 0xFF, 0xF1, 0x00, 0x49, 0xE3, 0x1A, 0xD5,
+    0x00, 0x00, 0x08, 0xA7, 0xC1, 0x00, 0x00, 0x00, 0x1A, 0xD2, 0x00, 0x00, 0x00, 0x05, 0xDB, 0xA1,
+    0x00, 0x00, 0x04, 0xD3, 0x1A, 0x80, 0x00, 0x0B, 0xFF, 0x83, 0xFF, 0xF1, 0x00, 0x45, 0x53, 0x15,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'y' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x80, 0x0D, 0xFF, 0x52, 0x6F, 0x73, 0x00, 0x7F,
+    0x62, 0x00, 0x6D, 0x00, 0x0D, 0x60, 0x00, 0x02, 0xC5, 0x05, 0xC2, 0x00, 0x00, 0x08, 0xA2, 0xA8,
+    0x00, 0x00, 0x00, 0x2F, 0xCF, 0x20, 0x00, 0x00, 0x00, 0x5E, 0x70, 0x00, 0x00, 0x00, 0x05, 0xC2,
+    0x00, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x7A, 0xBF, 0xB5, 0x00, 0x00, 0x07, 0xAA, 0xAA,
+    0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 'z' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x1F, 0x75, 0x5A, 0xD2,
+    0x00, 0x01, 0xA2, 0x06, 0xC1, 0x00, 0x00, 0x00, 0x05, 0xC2, 0x00, 0x00, 0x00, 0x05, 0xD2, 0x04,
+    0x20, 0x00, 0x04, 0xD3, 0x00, 0xD6, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x05, 0x55, 0x55,
+    0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '{' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x10, 0x00, 0x00, 0x00, 0x7E, 0xA1, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x01, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 0x00, 0x01, 0xCC, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x5E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x45, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '|' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '}' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x20, 0x00, 0x00, 0x00, 0x08, 0xCC, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7D, 0x20, 0x00, 0x00, 0x00, 0x02, 0xDC, 0x10, 0x00, 0x00, 0x00, 0x7E, 0x50,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x45, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* '~' */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xA5, 0x00, 0x00,
+    0x00, 0x04, 0xFC, 0xF6, 0x3E, 0x60, 0x00, 0xBB, 0x2A, 0xED, 0xD2, 0x00, 0x00, 0x00, 0x08, 0xA1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const aa_font AAFont16 {
+    g_aa_font16_coverage, 11, 16, ' ', 95,
+};
@@ -0,0 +1,276 @@
+/*
+ * ansi_parser.cpp
+ *
+ * The escape sequence state machine.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "ansi_parser.h"
+
+#include <initializer_list>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+enum State : std::uint8_t {
+    GROUND,
+    ESCAPE,
+    ESCAPE_INTERMEDIATE,
+    CSI_ENTRY,
+    CSI_PARAM,
+    CSI_INTERMEDIATE,
+    CSI_IGNORE,
+    /** OSC, DCS, SOS, PM or APC, skipped up to BEL or ESC. */
+    STRING,
+    STATE_COUNT,
+};
+
+/** Bytes that every state treats alike. */
+enum Class : std::uint8_t {
+    C0,             /* other C0 controls */
+    BEL,
+    CANCEL,         /* CAN, SUB */
+    ESC,
+    INTERMEDIATE,   /* ' ' to '/' */
+    DIGIT,
+    SEPARATOR,      /* ':', ';' */
+    PRIVATE,        /* '<' to '?' */
+    CSI_INTRO,      /* '[' */
+    STRING_INTRO,   /* ']', 'P', 'X', '^', '_' */
+    FINAL,          /* the rest of '@' to '~' */
+    DEL,
+    HIGH,           /* 0x80 and up */
+    CLASS_COUNT,
+};
+
+/** The public actions, and those the parser handles itself. */
+enum Step : std::uint8_t {
+    IGNORE,
+    PRINT,
+    EXECUTE,
+    ESC_DISPATCH,
+    CSI_DISPATCH,
+    /** Start of a sequence; forget the last one's parameters. */
+    CLEAR,
+    /** A private marker or intermediate byte. */
+    COLLECT,
+    /** A digit or separator. */
+    PARAM,
+};
+
+/** A step and the next state, packed in a byte. */
+constexpr std::uint8_t transition(Step step, State next) {
+    return static_cast<std::uint8_t>((step << 4) | next);
+}
+
+struct class_table {
+    std::uint8_t classes[256];
+
+    constexpr class_table() : classes {} {
+        for (std::uint32_t byte = 0; byte < 256; ++byte) {
+            auto &c = classes[byte];
+
+            if (byte == 0x07) {
+                c = BEL;
+            } else if (byte == 0x18 || byte == 0x1A) {
+                c = CANCEL;
+            } else if (byte == 0x1B) {
+                c = ESC;
+            } else if (byte < 0x20) {
+                c = C0;
+            } else if (byte < 0x30) {
+                c = INTERMEDIATE;
+            } else if (byte < 0x3A) {
+                c = DIGIT;
+            } else if (byte < 0x3C) {
+                c = SEPARATOR;
+            } else if (byte < 0x40) {
+                c = PRIVATE;
+            } else if (byte == '[') {
+                c = CSI_INTRO;
+            } else if (byte == ']' || byte == 'P' || byte == 'X' || byte == '^' || byte == '_') {
+                c = STRING_INTRO;
+            } else if (byte < 0x7F) {
+                c = FINAL;
+            } else if (byte == 0x7F) {
+                c = DEL;
+            } else {
+                c = HIGH;
+            }
+        }
+    }
+};
+
+struct transition_table {
+    std::uint8_t transitions[STATE_COUNT][CLASS_COUNT];
+
+    constexpr transition_table() : transitions {} {
+        for (std::uint32_t state = 0; state < STATE_COUNT; ++state) {
+            const auto self = static_cast<State>(state);
+            auto *t = transitions[state];
+
+            /* The same in every state but STRING */
+            t[C0] = transition(EXECUTE, self);
+            t[BEL] = transition(EXECUTE, self);
+            t[CANCEL] = transition(EXECUTE, GROUND);
+            t[ESC] = transition(CLEAR, ESCAPE);
+            t[DEL] = transition(IGNORE, self);
+            t[HIGH] = transition(IGNORE, self);
+
+            switch (self) {
+                case GROUND:
+                    for (auto c : { INTERMEDIATE, DIGIT, SEPARATOR, PRIVATE, CSI_INTRO, STRING_INTRO, FINAL, HIGH }) {
+                        t[c] = transition(PRINT, GROUND);
+                    }
+                    break;
+
+                case ESCAPE:
+                    t[INTERMEDIATE] = transition(COLLECT, ESCAPE_INTERMEDIATE);
+                    for (auto c : { DIGIT, SEPARATOR, PRIVATE, FINAL }) {
+                        t[c] = transition(ESC_DISPATCH, GROUND);
+                    }
+                    t[CSI_INTRO] = transition(IGNORE, CSI_ENTRY);
+                    t[STRING_INTRO] = transition(IGNORE, STRING);
+                    break;
+
+                case ESCAPE_INTERMEDIATE:
+                    t[INTERMEDIATE] = transition(COLLECT, ESCAPE_INTERMEDIATE);
+                    for (auto c : { DIGIT, SEPARATOR, PRIVATE, CSI_INTRO, STRING_INTRO, FINAL }) {
+                        t[c] = transition(ESC_DISPATCH, GROUND);
+                    }
+                    break;
+
+                case CSI_ENTRY:
+                case CSI_PARAM:
+                    t[INTERMEDIATE] = transition(COLLECT, CSI_INTERMEDIATE);
+                    t[DIGIT] = transition(PARAM, CSI_PARAM);
+                    t[SEPARATOR] = transition(PARAM, CSI_PARAM);
+                    /* A private marker only leads a sequence */
+                    t[PRIVATE] = (self == CSI_ENTRY) ? transition(COLLECT, CSI_PARAM) : transition(IGNORE, CSI_IGNORE);
+                    for (auto c : { CSI_INTRO, STRING_INTRO, FINAL }) {
+                        t[c] = transition(CSI_DISPATCH, GROUND);
+                    }
+                    break;
+
+                case CSI_INTERMEDIATE:
+                    t[INTERMEDIATE] = transition(COLLECT, CSI_INTERMEDIATE);
+                    for (auto c : { DIGIT, SEPARATOR, PRIVATE }) {
+                        t[c] = transition(IGNORE, CSI_IGNORE);
+                    }
+                    for (auto c : { CSI_INTRO, STRING_INTRO, FINAL }) {
+                        t[c] = transition(CSI_DISPATCH, GROUND);
+                    }
+                    break;
+
+                case CSI_IGNORE:
+                    for (auto c : { INTERMEDIATE, DIGIT, SEPARATOR, PRIVATE }) {
+                        t[c] = transition(IGNORE, CSI_IGNORE);
+                    }
+                    for (auto c : { CSI_INTRO, STRING_INTRO, FINAL }) {
+                        t[c] = transition(IGNORE, GROUND);
+                    }
+                    break;
+
+                case STRING:
+                    /* Ends at BEL (xterm's OSC terminator), or at ESC for an ST */
+                    for (auto c : { C0, INTERMEDIATE, DIGIT, SEPARATOR, PRIVATE, CSI_INTRO, STRING_INTRO, FINAL }) {
+                        t[c] = transition(IGNORE, STRING);
+                    }
+                    t[BEL] = transition(IGNORE, GROUND);
+                    t[CANCEL] = transition(IGNORE, GROUND);
+                    break;
+
+                default:
+                    break;
+            }
+        }
+    }
+};
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static constexpr class_table CLASSES {};
+static constexpr transition_table TRANSITIONS {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ansi_parser::ansi_parser() :
+        _state { GROUND }, _params {}, _param_count {}, _private {}, _intermediate {} {
+
+}
+
+void ansi_parser::reset() {
+    _state = GROUND;
+    _param_count = 0;
+    _private = 0;
+    _intermediate = 0;
+}
+
+ansi_parser::Action ansi_parser::feed(std::uint8_t byte) {
+    const auto t = TRANSITIONS.transitions[_state][CLASSES.classes[byte]];
+    _state = t & 0x0FU;
+
+    switch (static_cast<Step>(t >> 4)) {
+        case IGNORE:
+            return Action::NONE;
+
+        case PRINT:
+            return Action::PRINT;
+
+        case EXECUTE:
+            return Action::EXECUTE;
+
+        case ESC_DISPATCH:
+            return Action::ESC_DISPATCH;
+
+        case CSI_DISPATCH:
+            /* Hide the scratch slot that parameters past MAX_PARAMS went to */
+            if (_param_count > MAX_PARAMS) {
+                _param_count = MAX_PARAMS;
+            }
+            return Action::CSI_DISPATCH;
+
+        case CLEAR:
+            _param_count = 0;
+            _private = 0;
+            _intermediate = 0;
+            return Action::NONE;
+
+        case COLLECT:
+            if (byte >= '<') {
+                _private = static_cast<char>(byte);
+            } else {
+                _intermediate = static_cast<char>(byte);
+            }
+            return Action::NONE;
+
+        case PARAM:
+            if (_param_count == 0) {
+                _params[_param_count++] = 0;
+            }
+
+            if (byte == ';' || byte == ':') {
+                if (_param_count <= MAX_PARAMS) {
+                    _params[_param_count++] = 0;
+                }
+            } else {
+                auto &param = _params[_param_count - 1];
+                const auto value = param * 10U + (byte - '0');
+                param = static_cast<std::uint16_t>((value > MAX_PARAM_VALUE) ? MAX_PARAM_VALUE : value);
+            }
+            return Action::NONE;
+    }
+
+    return Action::NONE;
+}
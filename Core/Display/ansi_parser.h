@@ -0,0 +1,97 @@
+/*
+ * ansi_parser.h
+ *
+ * A streaming parser for ANSI/VT100 escape sequences, after the DEC VT500 state machine. Each
+ * byte costs a class lookup and a transition lookup; the parser only collects the parameters
+ * and says what the byte completed, leaving the meaning of each sequence to the caller.
+ *
+ * Handled: C0 controls, ESC sequences, and CSI sequences with up to MAX_PARAMS numeric
+ * parameters, a private marker ('<' to '?') and an intermediate byte. OSC, DCS, SOS, PM and APC
+ * strings are recognized and skipped. Bytes from 0x80 up are printed, so UTF-8 passes through;
+ * 8-bit C1 controls are not supported.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class ansi_parser {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** CSI parameters kept; later ones are dropped. */
+    static constexpr std::size_t MAX_PARAMS { 16 };
+
+    /** Parameters saturate here. */
+    static constexpr std::uint16_t MAX_PARAM_VALUE { 9999 };
+
+    /** What a byte completed. */
+    enum class Action : std::uint8_t {
+        /** Nothing yet; the byte was part of a sequence, or ignored. */
+        NONE,
+        /** The byte is text. */
+        PRINT,
+        /** The byte is a C0 control to carry out. */
+        EXECUTE,
+        /** The byte ended an ESC sequence; see intermediate(). */
+        ESC_DISPATCH,
+        /** The byte ended a CSI sequence; see params(), private_marker() and intermediate(). */
+        CSI_DISPATCH,
+    };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ansi_parser();
+
+    /** Back to ground state, dropping any partial sequence. */
+    void reset();
+
+    /**
+     * Parses one byte.
+     *
+     * @return what the byte completed. For PRINT, EXECUTE and the dispatches, the byte itself is
+     *         the text, the control, or the sequence's final byte.
+     */
+    Action feed(std::uint8_t byte);
+
+    /** Number of parameters of the last CSI sequence; an empty sequence has none. */
+    std::size_t param_count() const { return _param_count; }
+
+    /**
+     * A parameter of the last CSI sequence.
+     *
+     * @param index        which parameter.
+     * @param default_value returned if the parameter is missing or 0, as VT100 defaults go.
+     */
+    std::uint16_t param(std::size_t index, std::uint16_t default_value) const {
+        return (index < _param_count && _params[index] != 0) ? _params[index] : default_value;
+    }
+
+    /** The private marker of the last CSI sequence, or 0. */
+    char private_marker() const { return _private; }
+
+    /** The intermediate byte of the last ESC or CSI sequence, or 0. */
+    char intermediate() const { return _intermediate; }
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint8_t _state;
+
+    /** One more than MAX_PARAMS: any parameters past the last one kept are parsed into it. */
+    std::uint16_t _params[MAX_PARAMS + 1];
+    std::size_t _param_count;
+    char _private;
+    char _intermediate;
+};
@@ -0,0 +1,193 @@
+/*
+ * canvas.cpp
+ *
+ * An RGB565 drawing surface over a block of RAM.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "canvas.h"
+
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Largest font cell that can be drawn partly off the canvas (Font24) */
+static constexpr std::uint32_t MAX_CELL_PIXELS { 17 * 24 };
+
+/* A cell drawn partly off the canvas is drawn here first. Only the display thread draws, so one
+ * buffer does, and it's kept off that thread's stack. */
+static std::uint16_t g_cell_pixels[MAX_CELL_PIXELS];
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+canvas::canvas(std::uint16_t *pixels, const rect &area) :
+        _pixels { pixels }, _area { area } {
+
+}
+
+void canvas::fill(const rect &r, std::uint16_t color) {
+    const auto clipped = r.intersection(_area);
+    if (clipped.empty()) {
+        return;
+    }
+
+    auto *row = &_pixels[(clipped.y - _area.y) * _area.width + (clipped.x - _area.x)];
+    for (std::uint32_t y = 0; y < clipped.height; ++y, row += _area.width) {
+        std::fill_n(row, clipped.width, color);
+    }
+}
+
+void canvas::blit(const rect &r, const std::uint16_t *pixels) {
+    const auto clipped = r.intersection(_area);
+    if (clipped.empty()) {
+        return;
+    }
+
+    const auto *src = &pixels[(clipped.y - r.y) * r.width + (clipped.x - r.x)];
+    auto *dst = &_pixels[(clipped.y - _area.y) * _area.width + (clipped.x - _area.x)];
+    for (std::uint32_t y = 0; y < clipped.height; ++y, src += r.width, dst += _area.width) {
+        std::memcpy(dst, src, clipped.width * sizeof(*dst));
+    }
+}
+
+std::uint32_t canvas::draw_char(std::uint32_t x, std::uint32_t y, const sFONT &font, char c,
+                                std::uint16_t fg, std::uint16_t bg) {
+    if (c < ' ' || c > '~') {
+        return x;
+    }
+
+    const rect glyph { static_cast<std::uint16_t>(x), static_cast<std::uint16_t>(y), font.Width, font.Height };
+    const auto clipped = glyph.intersection(_area);
+    if (clipped.empty()) {
+        return x + font.Width;
+    }
+
+    /* Same layout as stm32_lcd: rows of (Width + 7) / 8 bytes, most significant bit leftmost */
+    const std::uint32_t row_bytes = (font.Width + 7U) / 8U;
+    const auto *data = &font.table[(c - ' ') * font.Height * row_bytes];
+
+    for (std::uint32_t py = clipped.y; py < clipped.bottom(); ++py) {
+        const auto *bits = &data[(py - y) * row_bytes];
+        auto *dst = &_pixels[(py - _area.y) * _area.width + (clipped.x - _area.x)];
+
+        for (std::uint32_t px = clipped.x; px < clipped.right(); ++px) {
+            const auto column = px - x;
+            const bool set = (bits[column / 8U] & (0x80U >> (column % 8U))) != 0;
+            *dst++ = set ? fg : bg;
+        }
+    }
+
+    return x + font.Width;
+}
+
+std::uint32_t canvas::draw_text(std::uint32_t x, std::uint32_t y, const sFONT &font, const char *text,
+                                std::uint16_t fg, std::uint16_t bg) {
+    for (; *text != '\0'; ++text) {
+        x = draw_char(x, y, font, *text, fg, bg);
+    }
+    return x;
+}
+
+std::uint32_t canvas::draw_char(std::uint32_t x, std::uint32_t y, const packed_font &font, char c,
+                                std::uint16_t fg, std::uint16_t bg) {
+    if (!font.contains(c)) {
+        return x;
+    }
+
+    const rect cell { static_cast<std::uint16_t>(x), static_cast<std::uint16_t>(y), font.width, font.height };
+    const auto clipped = cell.intersection(_area);
+    if (clipped.empty()) {
+        return x + font.width;
+    }
+
+    if (clipped.area() == cell.area()) {
+        font.decode(c, &_pixels[(y - _area.y) * _area.width + (x - _area.x)], _area.width, fg, bg);
+    } else if (cell.area() <= MAX_CELL_PIXELS) {
+        font.decode(c, g_cell_pixels, font.width, fg, bg);
+        blit(cell, g_cell_pixels);
+    }
+
+    return x + font.width;
+}
+
+std::uint32_t canvas::draw_text(std::uint32_t x, std::uint32_t y, const packed_font &font,
+                                const char *text, std::uint16_t fg, std::uint16_t bg) {
+    for (; *text != '\0'; ++text) {
+        x = draw_char(x, y, font, *text, fg, bg);
+    }
+    return x;
+}
+
+std::uint32_t canvas::draw_char(std::uint32_t x, std::uint32_t y, const aa_font &font, char c,
+                                std::uint16_t fg, std::uint16_t bg) {
+    return draw_char(x, y, font, c, aa_palette { fg, bg });
+}
+
+std::uint32_t canvas::draw_text(std::uint32_t x, std::uint32_t y, const aa_font &font,
+                                const char *text, std::uint16_t fg, std::uint16_t bg) {
+    const aa_palette palette { fg, bg };
+    for (; *text != '\0'; ++text) {
+        x = draw_char(x, y, font, *text, palette);
+    }
+    return x;
+}
+
+std::uint32_t canvas::blend_text(std::uint32_t x, std::uint32_t y, const aa_font &font,
+                                 const char *text, std::uint16_t fg) {
+    for (; *text != '\0'; ++text) {
+        if (!font.contains(*text)) {
+            continue;
+        }
+
+        const rect cell { static_cast<std::uint16_t>(x), static_cast<std::uint16_t>(y), font.width, font.height };
+        const auto clipped = cell.intersection(_area);
+
+        if (clipped.area() == cell.area()) {
+            font.blend(*text, &_pixels[(y - _area.y) * _area.width + (x - _area.x)], _area.width, fg);
+        } else if (!clipped.empty() && cell.area() <= MAX_CELL_PIXELS) {
+            /* Blend over a copy of what's under the cell; only the part on the canvas goes back */
+            for (std::uint32_t py = clipped.y; py < clipped.bottom(); ++py) {
+                std::memcpy(&g_cell_pixels[(py - y) * font.width + (clipped.x - x)],
+                            &_pixels[(py - _area.y) * _area.width + (clipped.x - _area.x)],
+                            clipped.width * sizeof(g_cell_pixels[0]));
+            }
+            font.blend(*text, g_cell_pixels, font.width, fg);
+            blit(cell, g_cell_pixels);
+        }
+
+        x += font.width;
+    }
+    return x;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::uint32_t canvas::draw_char(std::uint32_t x, std::uint32_t y, const aa_font &font, char c,
+                                const aa_palette &palette) {
+    if (!font.contains(c)) {
+        return x;
+    }
+
+    const rect cell { static_cast<std::uint16_t>(x), static_cast<std::uint16_t>(y), font.width, font.height };
+    const auto clipped = cell.intersection(_area);
+    if (clipped.empty()) {
+        return x + font.width;
+    }
+
+    if (clipped.area() == cell.area()) {
+        font.decode(c, &_pixels[(y - _area.y) * _area.width + (x - _area.x)], _area.width, palette);
+    } else if (cell.area() <= MAX_CELL_PIXELS) {
+        font.decode(c, g_cell_pixels, font.width, palette);
+        blit(cell, g_cell_pixels);
+    }
+
+    return x + font.width;
+}
@@ -0,0 +1,160 @@
+/*
+ * canvas.h
+ *
+ * Rectangles and an RGB565 drawing surface over a block of RAM. A canvas usually covers just a
+ * strip of the screen (see compositor.h); everything drawn on it is clipped to its area, and
+ * coordinates are always screen coordinates.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "aa_font.h"
+#include "packed_font.h"
+#include "stm32_lcd.h"  /* sFONT */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+/** A screen rectangle. right() and bottom() are exclusive. */
+struct rect {
+    std::uint16_t x;
+    std::uint16_t y;
+    std::uint16_t width;
+    std::uint16_t height;
+
+    constexpr std::uint32_t right() const { return std::uint32_t { x } + width; }
+    constexpr std::uint32_t bottom() const { return std::uint32_t { y } + height; }
+    constexpr std::uint32_t area() const { return std::uint32_t { width } * height; }
+    constexpr bool empty() const { return width == 0 || height == 0; }
+
+    /** Whether the rectangles share any pixels. */
+    constexpr bool intersects(const rect &other) const {
+        return x < other.right() && other.x < right() && y < other.bottom() && other.y < bottom();
+    }
+
+    /** Whether the rectangles share pixels or an edge. */
+    constexpr bool touches(const rect &other) const {
+        return x <= other.right() && other.x <= right() && y <= other.bottom() && other.y <= bottom();
+    }
+
+    /** The pixels in both rectangles; empty if they don't intersect. */
+    constexpr rect intersection(const rect &other) const {
+        if (!intersects(other)) {
+            return {};
+        }
+        const auto left = std::max(x, other.x);
+        const auto top = std::max(y, other.y);
+        return { left, top,
+                 static_cast<std::uint16_t>(std::min(right(), other.right()) - left),
+                 static_cast<std::uint16_t>(std::min(bottom(), other.bottom()) - top) };
+    }
+
+    /** The smallest rectangle holding both. */
+    constexpr rect bounding(const rect &other) const {
+        if (empty()) {
+            return other;
+        }
+        if (other.empty()) {
+            return *this;
+        }
+        const auto left = std::min(x, other.x);
+        const auto top = std::min(y, other.y);
+        return { left, top,
+                 static_cast<std::uint16_t>(std::max(right(), other.right()) - left),
+                 static_cast<std::uint16_t>(std::max(bottom(), other.bottom()) - top) };
+    }
+};
+
+class canvas {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Converts an ARGB8888 color, e.g. UTIL_LCD_COLOR_*, to RGB565. */
+    static constexpr std::uint16_t rgb565(std::uint32_t argb) {
+        return static_cast<std::uint16_t>(((argb & 0x00F80000U) >> 8) |
+                                          ((argb & 0x0000FC00U) >> 5) |
+                                          ((argb & 0x000000F8U) >> 3));
+    }
+
+    /**
+     * @param[in] pixels RAM for area.width * area.height pixels, row by row.
+     * @param     area   the part of the screen the pixels hold.
+     */
+    canvas(std::uint16_t *pixels, const rect &area);
+
+    /** The part of the screen this canvas holds. */
+    const rect &area() const { return _area; }
+
+    /** The pixels, row by row. */
+    const std::uint16_t *pixels() const { return _pixels; }
+
+    /** Fills a rectangle with a color. */
+    void fill(const rect &r, std::uint16_t color);
+
+    /**
+     * Copies pixels into a rectangle.
+     *
+     * @param     r      where to draw.
+     * @param[in] pixels r.width * r.height pixels, row by row.
+     */
+    void blit(const rect &r, const std::uint16_t *pixels);
+
+    /**
+     * Draws a character in a font. Characters outside the font are skipped.
+     *
+     * @return the x position after the character.
+     */
+    std::uint32_t draw_char(std::uint32_t x, std::uint32_t y, const sFONT &font, char c,
+                            std::uint16_t fg, std::uint16_t bg);
+
+    /**
+     * Draws a string in a font, left to right, with no wrapping.
+     *
+     * @return the x position after the string.
+     */
+    std::uint32_t draw_text(std::uint32_t x, std::uint32_t y, const sFONT &font, const char *text,
+                            std::uint16_t fg, std::uint16_t bg);
+
+    /** As above, in a packed font. Cells entirely on the canvas are decoded straight into it. */
+    std::uint32_t draw_char(std::uint32_t x, std::uint32_t y, const packed_font &font, char c,
+                            std::uint16_t fg, std::uint16_t bg);
+    std::uint32_t draw_text(std::uint32_t x, std::uint32_t y, const packed_font &font,
+                            const char *text, std::uint16_t fg, std::uint16_t bg);
+
+    /** As above, in an anti-aliased font. */
+    std::uint32_t draw_char(std::uint32_t x, std::uint32_t y, const aa_font &font, char c,
+                            std::uint16_t fg, std::uint16_t bg);
+    std::uint32_t draw_text(std::uint32_t x, std::uint32_t y, const aa_font &font,
+                            const char *text, std::uint16_t fg, std::uint16_t bg);
+
+    /**
+     * Draws a string in an anti-aliased font over what's already on the canvas, with no
+     * background.
+     *
+     * @return the x position after the string.
+     */
+    std::uint32_t blend_text(std::uint32_t x, std::uint32_t y, const aa_font &font,
+                             const char *text, std::uint16_t fg);
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t draw_char(std::uint32_t x, std::uint32_t y, const aa_font &font, char c,
+                            const aa_palette &palette);
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint16_t *_pixels;
+    rect _area;
+};
@@ -0,0 +1,182 @@
+/*
+ * compositor.cpp
+ *
+ * Redraws only the parts of the screen that changed.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "compositor.h"
+
+#include "cycles.h"
+#include "stm32l562e_discovery_lcd.h"
+#include "vsync.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static constexpr rect SCREEN { 0, 0, compositor::SCREEN_WIDTH, compositor::SCREEN_HEIGHT };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+compositor::compositor() :
+        _layers {}, _layer_count {}, _dirty {}, _dirty_count {}, _background {}, _vsync { false },
+        _stats {}, _second_start {}, _second_frames {},
+        _tiles {}, _next_tile {} {
+
+}
+
+bool compositor::add(layer &l) {
+    if (_layer_count == MAX_LAYERS) {
+        return false;
+    }
+
+    _layers[_layer_count++] = &l;
+    return true;
+}
+
+void compositor::set_background(std::uint16_t color) {
+    _background = color;
+}
+
+void compositor::set_vsync(bool enable) {
+    _vsync = enable;
+}
+
+void compositor::invalidate(const rect &r) {
+    const auto clipped = r.intersection(SCREEN);
+    if (!clipped.empty()) {
+        add_dirty(clipped);
+    }
+}
+
+std::size_t compositor::flush() {
+    if (_dirty_count == 0) {
+        return 0;
+    }
+
+    const auto start = cycles::now();
+    const auto start_te = vsync::frames();
+    std::size_t tiles = 0;
+
+    for (std::size_t i = 0; i < _dirty_count; ++i) {
+        const auto &region = _dirty[i];
+
+        /* As many whole rows of the region as fit in a tile */
+        const auto rows = static_cast<std::uint16_t>(
+                std::min<std::uint32_t>(TILE_PIXELS / region.width, region.height));
+
+        for (std::uint32_t y = region.y; y < region.bottom(); y += rows) {
+            const auto height = static_cast<std::uint16_t>(std::min<std::uint32_t>(rows, region.bottom() - y));
+            render_tile({ region.x, static_cast<std::uint16_t>(y), region.width, height });
+            ++tiles;
+        }
+    }
+
+    _dirty_count = 0;
+    count_frame(start, start_te);
+    return tiles;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void compositor::add_dirty(rect r) {
+    /* A merge can make the new rectangle reach others, so keep going until nothing touches it */
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (std::size_t i = 0; i < _dirty_count; ++i) {
+            if (_dirty[i].touches(r)) {
+                r = r.bounding(_dirty[i]);
+                _dirty[i] = _dirty[--_dirty_count];
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if (_dirty_count < MAX_DIRTY) {
+        _dirty[_dirty_count++] = r;
+        return;
+    }
+
+    /* Full: merge with whichever rectangle grows the least */
+    std::size_t best = 0;
+    std::uint32_t best_growth = UINT32_MAX;
+    for (std::size_t i = 0; i < _dirty_count; ++i) {
+        const auto growth = _dirty[i].bounding(r).area() - _dirty[i].area();
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+
+    r = r.bounding(_dirty[best]);
+    _dirty[best] = _dirty[--_dirty_count];
+    add_dirty(r);
+}
+
+void compositor::render_tile(const rect &tile) {
+    auto *pixels = _tiles[_next_tile];
+    _next_tile ^= 1;
+
+    /* Transfers finish in order, so with at most one pending the other tile is the busy one */
+    std::uint32_t pending;
+    while (BSP_LCD_GetTransferStatus(0, &pending) == BSP_ERROR_BUSY && pending > 1) {
+        /* Wait */
+    }
+
+    canvas target { pixels, tile };
+    target.fill(tile, _background);
+
+    for (std::size_t i = 0; i < _layer_count; ++i) {
+        if (_layers[i]->bounds().intersects(tile)) {
+            _layers[i]->draw(target);
+        }
+    }
+
+    if (_vsync) {
+        /* The scan position only means anything for a tile that starts on the bus right away */
+        while (BSP_LCD_GetTransferStatus(0, nullptr) == BSP_ERROR_BUSY) {
+            /* Wait */
+        }
+        vsync::wait_for(tile);
+    }
+
+    while (BSP_LCD_FillRGBRect_DMA(0, tile.x, tile.y, reinterpret_cast<std::uint8_t *>(pixels),
+                                   tile.width, tile.height) == BSP_ERROR_BUSY) {
+        /* Wait */
+    }
+}
+
+void compositor::count_frame(std::uint64_t start, std::uint32_t start_te) {
+    const auto now = cycles::now();
+
+    /* With TE, late means the tiles were spread over more than one refresh */
+    bool late;
+    if (_vsync && vsync::scan_line()) {
+        late = vsync::frames() - start_te > 1;
+    } else {
+        late = cycles::to_us(now - start) > NOMINAL_PERIOD_US;
+    }
+
+    ++_stats.frames;
+    if (late) {
+        ++_stats.late_frames;
+    }
+
+    /* Averaged over at least a second, so the first second after construction reads 0 */
+    ++_second_frames;
+    const auto us = cycles::to_us(now - _second_start);
+    if (us >= 1000000U) {
+        _stats.fps = (_second_start == 0) ? 0 : static_cast<std::uint32_t>(_second_frames * 1000000ULL / us);
+        _second_start = now;
+        _second_frames = 0;
+    }
+}
@@ -0,0 +1,162 @@
+/*
+ * compositor.h
+ *
+ * Redraws only the parts of the screen that changed. Anything on screen that the compositor
+ * manages is a layer; when a layer changes it invalidates the rectangle it covers. On flush(),
+ * overlapping and adjacent rectangles are merged, and each merged region is rendered in tiles:
+ * every layer over a tile draws into a small RAM buffer, then the tile goes to the LCD in one
+ * window blit over DMA. RAM use is two tiles, not a 115 KB framebuffer.
+ *
+ * With vsync on, each tile's write is held until the panel's scan line has just passed it (see
+ * vsync.h), so a tile is never shown half old, half new.
+ *
+ * Draws through the BSP LCD, so a compositor should only be used from the thread that owns it.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "canvas.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/** Something the compositor draws. */
+class layer {
+public:
+    explicit layer(const rect &bounds) : _bounds { bounds } {}
+
+    /** The part of the screen the layer draws in. */
+    const rect &bounds() const { return _bounds; }
+
+    /**
+     * Draws the layer. The canvas may only hold part of the layer, and is already clipped.
+     *
+     * @param target where to draw.
+     */
+    virtual void draw(canvas &target) = 0;
+
+protected:
+    ~layer() = default;
+
+private:
+    rect _bounds;
+};
+
+class compositor {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Size of the screen in pixels. */
+    static constexpr std::uint16_t SCREEN_WIDTH { 240 };
+    static constexpr std::uint16_t SCREEN_HEIGHT { 240 };
+
+    /** Pixels per tile; a full-width tile is 16 lines. Narrower regions get taller tiles. */
+    static constexpr std::uint32_t TILE_PIXELS { SCREEN_WIDTH * 16 };
+
+    /** Maximum number of layers. */
+    static constexpr std::size_t MAX_LAYERS { 16 };
+
+    /** Maximum number of separate dirty rectangles; past this, rectangles are merged anyways. */
+    static constexpr std::size_t MAX_DIRTY { 8 };
+
+    /** Refresh period assumed for late frames when the TE line isn't running. */
+    static constexpr std::uint32_t NOMINAL_PERIOD_US { 16667 };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct frame_stats {
+        /** Flushes that drew anything. */
+        std::uint32_t frames;
+        /** Frames that took longer than one panel refresh to send. */
+        std::uint32_t late_frames;
+        /** Frames per second, over the last second or more of flushes. */
+        std::uint32_t fps;
+    };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    compositor();
+
+    /**
+     * Adds a layer on top of the others. It isn't drawn until its bounds are invalidated.
+     *
+     * @return false if there are already MAX_LAYERS layers.
+     */
+    bool add(layer &l);
+
+    /** Sets the color drawn where no layer covers a tile. */
+    void set_background(std::uint16_t color);
+
+    /**
+     * Sets whether tiles are timed against the panel refresh. Needs vsync::init(); without a
+     * running TE line tiles are sent straight away.
+     */
+    void set_vsync(bool enable);
+
+    /** Marks part of the screen to be redrawn on the next flush(). */
+    void invalidate(const rect &r);
+
+    /** Marks a layer's bounds to be redrawn on the next flush(). */
+    void invalidate(const layer &l) { invalidate(l.bounds()); }
+
+    /** Whether anything is waiting to be redrawn. */
+    bool dirty() const { return _dirty_count > 0; }
+
+    /**
+     * Redraws everything invalidated since the last flush. Tiles are queued for DMA; the last may
+     * still be on the bus when this returns.
+     *
+     * @return the number of tiles sent.
+     */
+    std::size_t flush();
+
+    /** Frame counts since construction. */
+    frame_stats stats() const { return _stats; }
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    layer *_layers[MAX_LAYERS];
+    std::size_t _layer_count;
+
+    rect _dirty[MAX_DIRTY];
+    std::size_t _dirty_count;
+
+    std::uint16_t _background;
+    bool _vsync;
+
+    frame_stats _stats;
+    std::uint64_t _second_start;
+    std::uint32_t _second_frames;
+
+    /** Double buffered so one tile is drawn while the other is on the bus. */
+    alignas(4) std::uint16_t _tiles[2][TILE_PIXELS];
+    std::size_t _next_tile;
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Adds a rectangle to the dirty list, merging it with any it overlaps or touches. */
+    void add_dirty(rect r);
+
+    /** Draws one tile and queues it for the LCD. */
+    void render_tile(const rect &tile);
+
+    /** Counts a frame that started at the given cycle count and TE frame. */
+    void count_frame(std::uint64_t start, std::uint32_t start_te);
+};
@@ -0,0 +1,461 @@
+/*
+ * display.cpp
+ *
+ * The display thread. Owns the LCD, shows everything received over BLE UART on a terminal and
+ * runs render commands queued by other threads. Also owns the touch screen, for scrolling back
+ * through the terminal's history. Images sent in the BLE UART stream (see terminal.h) are drawn
+ * as they arrive, and numbers sent for plotting are drawn on a strip chart. A status screen of
+ * the BLE link can be toggled over the terminal too.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "display.h"
+
+#include "ble.h"
+#include "bleuart.h"
+#include "compositor.h"
+#include "image_stream.h"
+#include "lcd_benchmark.h"
+#include "lcd_driver.h"
+#include "logger.h"
+#include "main.h"
+#include "mpsc_queue.h"
+#include "scroll_view.h"
+#include "scrollback.h"
+#include "status_screen.h"
+#include "stm32_lcd.h"
+#include "stm32l562e_discovery_lcd.h"
+#include "stm32l562e_discovery_ts.h"
+#include "strip_chart.h"
+#include "terminal.h"
+#include "vsync.h"
+
+#include <cmsis_os.h>
+
+#include <atomic>
+#include <cstring>
+
+namespace display {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* How long to sleep when there's nothing to read or draw */
+static constexpr std::uint32_t IDLE_DELAY_MS { 5 };
+
+/* Characters written by the benchmark */
+static constexpr std::uint32_t BENCHMARK_CHARS { 4096 };
+
+/* How often the render command counts are logged, if they changed */
+static constexpr std::uint32_t STATS_PERIOD_MS { 10000 };
+
+/* The BLE link notice: characters, right aligned in the top right corner of the terminal */
+static constexpr std::uint16_t NOTICE_COLUMNS { 12 };
+static constexpr std::uint16_t NOTICE_Y { 2 };
+
+static terminal g_terminal {};
+static scrollback g_scrollback {};
+static scroll_view g_view { g_terminal, g_scrollback };
+static image_stream g_image {};
+static strip_chart g_chart {};
+static status_screen g_status {};
+
+/* Whether the last touch sample had a finger down */
+static bool g_touching { false };
+
+static std::atomic<bool> g_benchmark_requested { false };
+
+static mpsc_queue<command, QUEUE_SIZE> g_commands {};
+
+/* Commands taken from the queue for the current frame, and which of them still need drawing */
+static command g_batch[QUEUE_SIZE];
+static bool g_skip[QUEUE_SIZE];
+
+static std::atomic<std::uint32_t> g_submitted { 0 };
+static std::atomic<std::uint32_t> g_dropped { 0 };
+static std::atomic<std::uint32_t> g_coalesced { 0 };
+
+/* When the command counts were last logged, and what they were */
+static std::uint32_t g_stats_ms { 0 };
+static queue_stats g_stats_logged {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static void poll_touch();
+static void receive(const char *data, std::size_t size);
+static void start_image(std::uint32_t x, std::uint32_t y);
+static void start_plot();
+static void link_event(void *context, hci_uart_pckt *data);
+static void link_notice(const char *notice, std::uint32_t color);
+static rect on_gram(const rect &area);
+static void toggle_status();
+static void hide_status();
+static std::size_t run_commands();
+static void coalesce(std::size_t count);
+static void log_stats(std::uint32_t now_ms);
+static void execute(const command &cmd);
+static bool contains(const rect &outer, const rect &inner);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void thread(void *arg) {
+    auto *uart = reinterpret_cast<ble_uart *>(arg);
+
+    if (!lcd_driver::install()) {
+        LOG("display: LCD not in portrait, drawing through the component driver\n");
+    }
+
+    if (vsync::init()) {
+        g_status.set_vsync(true);
+    } else {
+        LOG("display: no LCD tearing effect, drawing unsynchronized\n");
+    }
+
+    if (!g_scrollback.init()) {
+        LOG("display: no flash for the scrollback, keeping %lu lines\n",
+                static_cast<unsigned long>(scrollback::LINE_CAPACITY));
+    }
+
+    UTIL_LCD_SetFont(&Font16);
+    g_terminal.set_scrollback(&g_scrollback);
+    g_terminal.clear();
+
+    while (true) {
+        /* The view would draw over an image on its way in, the chart or the status screen */
+        if (!g_image.active() && !g_chart.active() && !g_status.active()) {
+            poll_touch();
+        }
+
+        /* Take in everything that's arrived, then draw it all in one go */
+        std::size_t received = 0;
+        while (uart->available() > 0) {
+            char chunk[64];
+            auto read = uart->read(chunk, static_cast<std::uint8_t>(sizeof(chunk)));
+            receive(chunk, read);
+            received += read;
+        }
+        g_status.received(received, osKernelGetTickCount());
+
+        if (received == 0 && g_image.active()) {
+            g_image.idle(osKernelGetTickCount());
+        }
+
+        if (g_benchmark_requested.exchange(false)) {
+            /* Keep the benchmark's text out of the scrollback */
+            g_view.reset();
+            g_status.hide();
+            g_terminal.set_scrollback(nullptr);
+            g_terminal.benchmark(BENCHMARK_CHARS);
+            lcd_benchmark::run_all();
+            UTIL_LCD_SetFont(&Font16);
+            g_terminal.set_scrollback(&g_scrollback);
+            g_terminal.clear();
+        }
+
+        /* The terminal draws last so its text wins over commands painted under it. Commands wait
+         * while something else has the screen. */
+        const bool terminal_shown = !g_chart.active() && !g_status.active() && !g_image.active() &&
+                                    !g_view.active();
+        const auto commands = terminal_shown ? run_commands() : 0;
+
+        /* While the view shows history, or the chart or status screen is up, the terminal only
+         * keeps its cells up to date */
+        auto drawn = g_view.render(osKernelGetTickCount());
+        if (g_chart.active()) {
+            drawn += g_chart.render();
+        } else if (g_status.active()) {
+            drawn += g_status.render();
+        } else if (!g_view.active()) {
+            drawn += g_terminal.render();
+        }
+
+        log_stats(osKernelGetTickCount());
+
+        if (drawn == 0 && received == 0 && commands == 0 && !g_view.flinging()) {
+            osDelay(IDLE_DELAY_MS);
+        }
+    }
+}
+
+void register_ble_callbacks() {
+    g_status.register_callbacks();
+    ble::register_callback(link_event, nullptr);
+}
+
+void request_benchmark() {
+    g_benchmark_requested = true;
+}
+
+bool submit(const command &cmd) {
+    if (!g_commands.push(cmd)) {
+        g_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    g_submitted.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool text(std::uint16_t x, std::uint16_t y, const char *text, const sFONT &font,
+          std::uint32_t color, std::uint32_t back_color) {
+    bool queued = true;
+
+    while (*text != '\0') {
+        command cmd {};
+        cmd.type = command::Type::TEXT;
+        cmd.color = color;
+        cmd.back_color = back_color;
+        cmd.text.font = &font;
+
+        while (cmd.length < TEXT_SPAN && *text != '\0') {
+            cmd.text.chars[cmd.length++] = *text++;
+        }
+
+        cmd.area = { x, y, static_cast<std::uint16_t>(cmd.length * font.Width), font.Height };
+        queued &= submit(cmd);
+        x = static_cast<std::uint16_t>(x + cmd.area.width);
+    }
+
+    return queued;
+}
+
+bool fill(const rect &area, std::uint32_t color) {
+    command cmd {};
+    cmd.type = command::Type::FILL;
+    cmd.area = area;
+    cmd.color = color;
+    return submit(cmd);
+}
+
+queue_stats stats() {
+    return { g_submitted.load(std::memory_order_relaxed),
+             g_dropped.load(std::memory_order_relaxed),
+             g_coalesced.load(std::memory_order_relaxed) };
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* The touch controller interrupts when it's touched; it's then polled until the finger lifts.
+ * The FT6x06 driver in this BSP doesn't report gestures, so flings are tracked from the samples. */
+static void poll_touch() {
+    if (TouchDetected == RESET && !g_touching) {
+        return;
+    }
+    TouchDetected = RESET;
+
+    TS_State_t state {};
+    if (BSP_TS_GetState(0, &state) != BSP_ERROR_NONE) {
+        return;
+    }
+
+    g_touching = state.TouchDetected != 0;
+    g_view.touch(g_touching, state.TouchY, osKernelGetTickCount());
+}
+
+/* Hands what arrived to the terminal, or to the image being drawn or the chart until they end */
+static void receive(const char *data, std::size_t size) {
+    while (size > 0) {
+        std::size_t used;
+
+        if (g_image.active()) {
+            used = g_image.feed(reinterpret_cast<const std::uint8_t *>(data), size, osKernelGetTickCount());
+        } else if (g_chart.active()) {
+            used = g_chart.feed(data, size);
+            if (!g_chart.active()) {
+                g_terminal.redraw();
+            }
+        } else {
+            used = g_terminal.write(data, size);
+
+            std::uint32_t x, y;
+            if (g_terminal.take_image(x, y)) {
+                start_image(x, y);
+            } else if (g_terminal.take_plot()) {
+                start_plot();
+            } else if (g_terminal.take_status()) {
+                toggle_status();
+            }
+        }
+
+        data += used;
+        size -= used;
+    }
+}
+
+/* The screen has to be up to date before the image goes over it */
+static void start_image(std::uint32_t x, std::uint32_t y) {
+    hide_status();
+    if (g_view.active()) {
+        g_view.reset();
+        g_terminal.redraw();
+    }
+    g_terminal.render();
+
+    g_image.start(x, y, &g_terminal, osKernelGetTickCount());
+}
+
+static void start_plot() {
+    g_view.reset();
+    g_status.hide();
+    g_chart.start();
+}
+
+static void toggle_status() {
+    if (g_status.active()) {
+        hide_status();
+        return;
+    }
+
+    g_view.reset();
+    g_status.show();
+}
+
+/* The terminal kept its cells while the status screen was up, so it only has to draw them */
+static void hide_status() {
+    if (g_status.active()) {
+        g_status.hide();
+        g_terminal.redraw();
+    }
+}
+
+/* On the BLE thread: queues a notice of connections and disconnections over the terminal */
+static void link_event(void *context, hci_uart_pckt *data) {
+    (void) context;
+
+    if (data->type != HCI_EVENT_PKT) {
+        return;
+    }
+
+    auto *hci_packet = reinterpret_cast<hci_event_pckt *>(data->data);
+    if (hci_packet->evt == EVT_DISCONN_COMPLETE) {
+        link_notice("disconnected", UTIL_LCD_COLOR_RED);
+    } else if (hci_packet->evt == EVT_LE_META_EVENT &&
+               reinterpret_cast<evt_le_meta_event *>(hci_packet->data)->subevent == EVT_LE_CONN_COMPLETE) {
+        link_notice("connected", UTIL_LCD_COLOR_GREEN);
+    }
+}
+
+/* The box is cleared first, so a shorter notice doesn't leave the end of a longer one. Notices
+ * are at most NOTICE_COLUMNS characters. */
+static void link_notice(const char *notice, std::uint32_t color) {
+    const auto width = static_cast<std::uint16_t>(NOTICE_COLUMNS * Font12.Width);
+    const auto length = static_cast<std::uint16_t>(std::strlen(notice) * Font12.Width);
+
+    fill({ static_cast<std::uint16_t>(compositor::SCREEN_WIDTH - width), NOTICE_Y, width, Font12.Height },
+         UTIL_LCD_COLOR_BLACK);
+    text(static_cast<std::uint16_t>(compositor::SCREEN_WIDTH - length), NOTICE_Y, notice, Font12, color,
+         UTIL_LCD_COLOR_BLACK);
+}
+
+/* Moves an area to the GRAM rows the terminal shows it from, if they're together there */
+static rect on_gram(const rect &area) {
+    const auto top = g_terminal.gram_row(area.y);
+    if (area.empty() || g_terminal.gram_row(area.bottom() - 1U) != top + area.height - 1U) {
+        return area;
+    }
+
+    return { area.x, static_cast<std::uint16_t>(top), area.width, area.height };
+}
+
+/* Runs one frame's worth of queued commands. Returns how many were taken off the queue. */
+static std::size_t run_commands() {
+    std::size_t count = 0;
+    while (count < QUEUE_SIZE && g_commands.pop(g_batch[count])) {
+        ++count;
+    }
+
+    if (count == 0) {
+        return 0;
+    }
+
+    coalesce(count);
+
+    /* Text commands change the drawing properties the terminal and benchmarks rely on */
+    sFONT *const font_before = UTIL_LCD_GetFont();
+    const auto text_color_before = UTIL_LCD_GetTextColor();
+    const auto back_color_before = UTIL_LCD_GetBackColor();
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!g_skip[i]) {
+            execute(g_batch[i]);
+        }
+    }
+    UTIL_LCD_SetFont(font_before);
+    UTIL_LCD_SetTextColor(text_color_before);
+    UTIL_LCD_SetBackColor(back_color_before);
+
+    return count;
+}
+
+/* Marks commands that don't need drawing: any painted over entirely by a single later command */
+static void coalesce(std::size_t count) {
+    for (std::size_t i = count; i-- > 0;) {
+        const auto &cmd = g_batch[i];
+        g_skip[i] = false;
+
+        for (std::size_t later = i + 1; later < count; ++later) {
+            if (!g_skip[later] && contains(g_batch[later].area, cmd.area)) {
+                g_skip[i] = true;
+                g_coalesced.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+        }
+    }
+}
+
+/* Logs the command counts every STATS_PERIOD_MS, unless nothing was queued since the last time */
+static void log_stats(std::uint32_t now_ms) {
+    if (now_ms - g_stats_ms < STATS_PERIOD_MS) {
+        return;
+    }
+    g_stats_ms = now_ms;
+
+    const auto counts = stats();
+    if (counts.submitted == g_stats_logged.submitted && counts.dropped == g_stats_logged.dropped) {
+        return;
+    }
+    g_stats_logged = counts;
+
+    LOG("display: %lu commands queued, %lu dropped, %lu coalesced\n",
+            static_cast<unsigned long>(counts.submitted), static_cast<unsigned long>(counts.dropped),
+            static_cast<unsigned long>(counts.coalesced));
+}
+
+static void execute(const command &cmd) {
+    if (cmd.area.empty()) {
+        return;
+    }
+
+    const auto area = on_gram(cmd.area);
+
+    switch (cmd.type) {
+        case command::Type::TEXT:
+            UTIL_LCD_SetFont(const_cast<sFONT *>(cmd.text.font));
+            UTIL_LCD_SetTextColor(cmd.color);
+            UTIL_LCD_SetBackColor(cmd.back_color);
+            for (std::size_t i = 0; i < cmd.length; ++i) {
+                const char c = cmd.text.chars[i];
+                UTIL_LCD_DisplayChar(area.x + i * cmd.text.font->Width, area.y,
+                                     static_cast<std::uint8_t>((c < ' ' || c > '~') ? ' ' : c));
+            }
+            break;
+
+        case command::Type::FILL:
+            UTIL_LCD_FillRect(area.x, area.y, area.width, area.height, cmd.color);
+            break;
+    }
+}
+
+static bool contains(const rect &outer, const rect &inner) {
+    return inner.x >= outer.x && inner.right() <= outer.right() &&
+           inner.y >= outer.y && inner.bottom() <= outer.bottom();
+}
+
+}  // namespace display
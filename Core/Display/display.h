@@ -0,0 +1,124 @@
+/*
+ * display.h
+ *
+ * The display thread. Owns the LCD and shows everything received over BLE UART on a terminal.
+ *
+ * Nothing else draws on the LCD directly. Other threads and ISRs (e.g. BLE link events, which
+ * put a notice in the corner of the terminal) submit render commands instead: small fixed-size
+ * records pushed onto a lock-free queue, so a producer never waits on the panel or on another
+ * producer. Once per frame the display thread takes everything queued, drops commands that later
+ * ones completely paint over, and draws the rest over the terminal. Commands wait in the queue
+ * while the chart, an image, the status screen or the scrollback has the screen. The counts are
+ * logged every so often.
+ *
+ * The screens themselves (the terminal, the scrollback, the chart, images and the status screen)
+ * run on the display thread and draw directly, and only they move the hardware scroll: it's part
+ * of their layout. Data for them comes through their own queues, e.g. BLE UART RX and the status
+ * screen's values, so the BLE thread doesn't wait on the panel for them either.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "canvas.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace display {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Characters carried by one text command. Longer text is split over several. */
+inline constexpr std::size_t TEXT_SPAN { 20 };
+
+/** Commands that can be queued between frames. */
+inline constexpr std::size_t QUEUE_SIZE { 32 };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** A queued drawing operation. Build them with the functions below. */
+struct command {
+    enum class Type : std::uint8_t {
+        TEXT,    /* a run of characters in one font and colors */
+        FILL,    /* a solid rectangle */
+    };
+
+    Type type;
+    /** TEXT: number of characters used in text.chars. */
+    std::uint8_t length;
+    /**
+     * The part of the screen painted. While the terminal scrolls in hardware, it's drawn in the
+     * GRAM rows the screen shows there, as long as they're together; keep areas within a text row
+     * to be sure.
+     */
+    rect area;
+    /** TEXT: foreground; FILL: the color. ARGB8888, like UTIL_LCD_COLOR_*. */
+    std::uint32_t color;
+    /** TEXT: background. */
+    std::uint32_t back_color;
+
+    struct {
+        const sFONT *font;
+        char chars[TEXT_SPAN];
+    } text;
+};
+
+/** Counts since boot. */
+struct queue_stats {
+    /** Commands queued. */
+    std::uint32_t submitted;
+    /** Commands dropped because the queue was full. */
+    std::uint32_t dropped;
+    /** Commands skipped because a later command in the same frame made them pointless. */
+    std::uint32_t coalesced;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * An RTOS thread that feeds BLE UART RX into the terminal, runs queued render commands and
+ * renders it all.
+ *
+ * @param[in] arg the ble_uart instance to read from. The display thread must be its only reader.
+ */
+void thread(void *arg);
+
+/** Registers the status screen and link notices for BLE events. Call before the BLE thread starts. */
+void register_ble_callbacks();
+
+/** Asks the display thread to run the terminal and LCD benchmarks. */
+void request_benchmark();
+
+/**
+ * Queues a command. Safe from any thread or ISR.
+ *
+ * @return false if the queue was full; the command is dropped.
+ */
+bool submit(const command &cmd);
+
+/**
+ * Queues a line of text, split into as many commands as it takes. Characters outside the font
+ * are drawn as spaces. Doesn't wrap.
+ *
+ * @param[in] text a C-string, copied into the commands.
+ * @return         false if any part of it was dropped.
+ */
+bool text(std::uint16_t x, std::uint16_t y, const char *text, const sFONT &font,
+          std::uint32_t color, std::uint32_t back_color);
+
+/** Queues a solid rectangle. */
+bool fill(const rect &area, std::uint32_t color);
+
+/** Gets the render command counts. */
+queue_stats stats();
+
+}  // namespace display
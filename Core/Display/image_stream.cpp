@@ -0,0 +1,408 @@
+/*
+ * image_stream.cpp
+ *
+ * Draws an image as its bytes arrive.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "image_stream.h"
+
+#include "cycles.h"
+#include "logger.h"
+#include "stm32l562e_discovery_lcd.h"
+#include "terminal.h"
+
+#include <algorithm>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Header sizes, magic included */
+static constexpr std::uint8_t MAGIC_SIZE { 4 };
+static constexpr std::uint8_t QOI_HEADER_SIZE { 14 };
+static constexpr std::uint8_t RLE_HEADER_SIZE { 8 };
+
+/* QOI ops that aren't told apart by their top two bits */
+static constexpr std::uint8_t QOI_OP_RGB { 0xFE };
+static constexpr std::uint8_t QOI_OP_RGBA { 0xFF };
+
+/* Seven 0x00 and a 0x01 */
+static constexpr std::uint8_t QOI_END_SIZE { 8 };
+
+/* Images are decoded one at a time, so they share the strips */
+alignas(4) static std::uint16_t g_strips[2][image_stream::SCREEN_WIDTH * image_stream::STRIP_ROWS];
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::uint32_t big_endian(const std::uint8_t *bytes);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+image_stream::image_stream() :
+        _state { State::IDLE }, _format { Format::QOI }, _screen { nullptr }, _x {}, _y {},
+        _width {}, _height {}, _visible_width {}, _visible_height {},
+        _bytes {}, _have {}, _need {}, _op {}, _pixel {}, _index {}, _count {}, _run { false },
+        _row {}, _column {}, _remaining {}, _strip {}, _strip_row {}, _line { nullptr }, _line_width {},
+        _size {}, _start_ms {}, _last_ms {}, _busy_cycles {} {
+
+}
+
+void image_stream::start(std::uint32_t x, std::uint32_t y, const terminal *screen, std::uint32_t ms) {
+    /* The strips may still be on their way from the last image */
+    while (BSP_LCD_GetTransferStatus(0, nullptr) == BSP_ERROR_BUSY) {
+        /* Wait */
+    }
+
+    _state = State::HEADER;
+    _screen = screen;
+    _x = x;
+    _y = y;
+    _have = 0;
+    _need = MAGIC_SIZE;
+    _strip = 0;
+
+    _size = 0;
+    _start_ms = ms;
+    _last_ms = ms;
+    _busy_cycles = 0;
+}
+
+std::size_t image_stream::feed(const std::uint8_t *data, std::size_t size, std::uint32_t ms) {
+    _last_ms = ms;
+
+    if (_state == State::DISCARD) {
+        return size;
+    }
+
+    const auto start = cycles::now();
+    std::size_t used = 0;
+
+    while (used < size && _state != State::IDLE) {
+        const auto byte = data[used++];
+
+        switch (_state) {
+            case State::HEADER:
+                header(byte);
+                break;
+
+            case State::QOI_OP:
+                qoi_op(byte);
+                break;
+
+            case State::QOI_ARGS:
+                _bytes[_have++] = byte;
+                if (_have == _need) {
+                    qoi_args();
+                }
+                break;
+
+            case State::QOI_END:
+                if (++_have == _need) {
+                    _state = State::IDLE;
+                }
+                break;
+
+            case State::RLE_COUNT:
+                rle_count(byte);
+                break;
+
+            case State::RLE_PIXELS:
+                rle_pixel(byte);
+                break;
+
+            case State::DISCARD:
+            case State::IDLE:
+                break;
+        }
+    }
+
+    _size += used;
+
+    /* The image isn't drawn until the last strip is */
+    const bool done = _state == State::IDLE;
+    if (done) {
+        while (BSP_LCD_GetTransferStatus(0, nullptr) == BSP_ERROR_BUSY) {
+            /* Wait */
+        }
+    }
+
+    _busy_cycles += cycles::now() - start;
+
+    if (done) {
+        report();
+    }
+
+    return (_state == State::DISCARD) ? size : used;
+}
+
+void image_stream::idle(std::uint32_t ms) {
+    if (_state == State::IDLE || ms - _last_ms < TIMEOUT_MS) {
+        return;
+    }
+
+    if (_state != State::DISCARD) {
+        LOG("image: timed out after %lu of %lu rows\n",
+                static_cast<unsigned long>(_row), static_cast<unsigned long>(_height));
+    }
+    _state = State::IDLE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void image_stream::header(std::uint8_t byte) {
+    _bytes[_have++] = byte;
+
+    if (_have == MAGIC_SIZE) {
+        if (std::memcmp(_bytes, "qoif", MAGIC_SIZE) == 0) {
+            _format = Format::QOI;
+            _need = QOI_HEADER_SIZE;
+        } else if (std::memcmp(_bytes, "R565", MAGIC_SIZE) == 0) {
+            _format = Format::RLE565;
+            _need = RLE_HEADER_SIZE;
+        } else {
+            fail("unknown format");
+            return;
+        }
+    }
+
+    if (_have < _need) {
+        return;
+    }
+
+    if (_format == Format::QOI) {
+        _width = big_endian(&_bytes[4]);
+        _height = big_endian(&_bytes[8]);
+        if (_bytes[12] != 3 && _bytes[12] != 4) {
+            fail("bad QOI channels");
+            return;
+        }
+    } else {
+        _width = _bytes[4] | (_bytes[5] << 8);
+        _height = _bytes[6] | (_bytes[7] << 8);
+    }
+
+    if (_width == 0 || _height == 0 || _width > MAX_SIZE || _height > MAX_SIZE) {
+        fail("bad size");
+        return;
+    }
+
+    _visible_width = (_x < SCREEN_WIDTH) ? std::min(_width, SCREEN_WIDTH - _x) : 0;
+    _visible_height = (_y < SCREEN_HEIGHT) ? std::min(_height, SCREEN_HEIGHT - _y) : 0;
+
+    _row = 0;
+    _column = 0;
+    _remaining = _width * _height;
+    _strip_row = 0;
+    start_row();
+
+    _have = 0;
+    if (_format == Format::QOI) {
+        _pixel = { 0, 0, 0, 255 };
+        std::fill_n(_index, 64, Rgba {});
+        _state = State::QOI_OP;
+    } else {
+        _state = State::RLE_COUNT;
+    }
+}
+
+void image_stream::qoi_op(std::uint8_t byte) {
+    if (byte == QOI_OP_RGB || byte == QOI_OP_RGBA) {
+        _op = byte;
+        _have = 0;
+        _need = (byte == QOI_OP_RGB) ? 3 : 4;
+        _state = State::QOI_ARGS;
+        return;
+    }
+
+    switch (byte >> 6) {
+        case 0:
+            /* QOI_OP_INDEX */
+            _pixel = _index[byte];
+            qoi_emit(1);
+            break;
+
+        case 1:
+            /* QOI_OP_DIFF, each channel -2 to 1 */
+            _pixel.r = static_cast<std::uint8_t>(_pixel.r + ((byte >> 4) & 0x03) - 2);
+            _pixel.g = static_cast<std::uint8_t>(_pixel.g + ((byte >> 2) & 0x03) - 2);
+            _pixel.b = static_cast<std::uint8_t>(_pixel.b + (byte & 0x03) - 2);
+            qoi_emit(1);
+            break;
+
+        case 2:
+            /* QOI_OP_LUMA, with a byte to come */
+            _op = byte;
+            _have = 0;
+            _need = 1;
+            _state = State::QOI_ARGS;
+            break;
+
+        default:
+            /* QOI_OP_RUN, 1 to 62 */
+            qoi_emit((byte & 0x3FU) + 1);
+            break;
+    }
+}
+
+void image_stream::qoi_args() {
+    if (_op == QOI_OP_RGB || _op == QOI_OP_RGBA) {
+        _pixel.r = _bytes[0];
+        _pixel.g = _bytes[1];
+        _pixel.b = _bytes[2];
+        if (_op == QOI_OP_RGBA) {
+            _pixel.a = _bytes[3];
+        }
+    } else {
+        const auto green = (_op & 0x3F) - 32;
+        _pixel.r = static_cast<std::uint8_t>(_pixel.r + green - 8 + (_bytes[0] >> 4));
+        _pixel.g = static_cast<std::uint8_t>(_pixel.g + green);
+        _pixel.b = static_cast<std::uint8_t>(_pixel.b + green - 8 + (_bytes[0] & 0x0F));
+    }
+
+    _state = State::QOI_OP;
+    qoi_emit(1);
+}
+
+void image_stream::rle_count(std::uint8_t byte) {
+    _run = byte >= 0x80;
+    _count = _run ? byte - 0x7FU : byte + 1U;
+    _have = 0;
+    _state = State::RLE_PIXELS;
+}
+
+void image_stream::rle_pixel(std::uint8_t byte) {
+    _bytes[_have++] = byte;
+    if (_have < 2) {
+        return;
+    }
+    _have = 0;
+
+    const auto pixel = static_cast<std::uint16_t>(_bytes[0] | (_bytes[1] << 8));
+    if (_run) {
+        emit(pixel, _count);
+        _count = 0;
+    } else {
+        emit(pixel, 1);
+        --_count;
+    }
+
+    if (_remaining == 0) {
+        _state = State::IDLE;
+    } else if (_count == 0) {
+        _state = State::RLE_COUNT;
+    }
+}
+
+void image_stream::qoi_emit(std::uint32_t count) {
+    _index[(_pixel.r * 3 + _pixel.g * 5 + _pixel.b * 7 + _pixel.a * 11) % 64] = _pixel;
+
+    emit(static_cast<std::uint16_t>(((_pixel.r & 0xF8U) << 8) | ((_pixel.g & 0xFCU) << 3) | (_pixel.b >> 3)), count);
+
+    if (_remaining == 0) {
+        _have = 0;
+        _need = QOI_END_SIZE;
+        _state = State::QOI_END;
+    }
+}
+
+void image_stream::emit(std::uint16_t pixel, std::uint32_t count) {
+    count = std::min(count, _remaining);
+    _remaining -= count;
+
+    while (count-- > 0) {
+        if (_column < _line_width) {
+            _line[_column] = pixel;
+        }
+        if (++_column == _width) {
+            end_row();
+        }
+    }
+}
+
+void image_stream::end_row() {
+    _column = 0;
+    ++_row;
+
+    if (_row - _strip_row == STRIP_ROWS || _row == _height) {
+        flush();
+    }
+    start_row();
+}
+
+void image_stream::flush() {
+    const auto last = std::min(_row, _visible_height);
+    auto *strip = g_strips[_strip];
+    std::uint32_t queued = 0;
+
+    /* Rows that wrap around the scroll area in GRAM go as separate rectangles */
+    for (auto first = _strip_row; first < last && _visible_width > 0;) {
+        const auto y = gram_row(first);
+        auto end = first + 1;
+        while (end < last && gram_row(end) == y + (end - first)) {
+            ++end;
+        }
+
+        while (BSP_LCD_FillRGBRect_DMA(0, _x, y, reinterpret_cast<std::uint8_t *>(&strip[(first - _strip_row) * _visible_width]),
+                                       _visible_width, end - first) == BSP_ERROR_BUSY) {
+            /* Wait */
+        }
+        ++queued;
+        first = end;
+    }
+
+    _strip_row = _row;
+    if (queued == 0) {
+        return;
+    }
+
+    /* The queue is in order, so once only this strip's rectangles are pending the other is free */
+    _strip ^= 1;
+    std::uint32_t pending;
+    while (BSP_LCD_GetTransferStatus(0, &pending) == BSP_ERROR_BUSY && pending > queued) {
+        /* Wait */
+    }
+}
+
+std::uint32_t image_stream::gram_row(std::uint32_t row) const {
+    return (_screen != nullptr) ? _screen->gram_row(_y + row) : _y + row;
+}
+
+void image_stream::start_row() {
+    _line = &g_strips[_strip][(_row - _strip_row) * _visible_width];
+    _line_width = (_row < _visible_height) ? _visible_width : 0;
+}
+
+void image_stream::report() const {
+    const auto arrival_ms = _last_ms - _start_ms + 1;
+    const auto busy_us = cycles::to_us(_busy_cycles) + 1;
+    const auto pixels = static_cast<std::uint64_t>(_width) * _height;
+
+    /* Two logs, as one would carry too many arguments */
+    LOG("image: %lux%lu %s, %lu B in %lu ms (%lu B/s)\n",
+            static_cast<unsigned long>(_width), static_cast<unsigned long>(_height),
+            (_format == Format::QOI) ? "QOI" : "R565",
+            static_cast<unsigned long>(_size), static_cast<unsigned long>(arrival_ms),
+            static_cast<unsigned long>(_size * 1000ULL / arrival_ms));
+    LOG("image: decoded and drawn in %lu us (%lu kpx/s)\n",
+            static_cast<unsigned long>(busy_us), static_cast<unsigned long>(pixels * 1000ULL / busy_us));
+}
+
+void image_stream::fail(const char *reason) {
+    LOG("image: %s, dropping it\n", reason);
+    _state = State::DISCARD;
+}
+
+static std::uint32_t big_endian(const std::uint8_t *bytes) {
+    return (static_cast<std::uint32_t>(bytes[0]) << 24) | (static_cast<std::uint32_t>(bytes[1]) << 16) |
+           (static_cast<std::uint32_t>(bytes[2]) << 8) | bytes[3];
+}
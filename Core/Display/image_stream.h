@@ -0,0 +1,214 @@
+/*
+ * image_stream.h
+ *
+ * Draws an image as its bytes arrive, so it never has to be in RAM as a whole the way
+ * BSP_LCD_DrawBitmap() needs: pixels are decoded into one of two strips of STRIP_ROWS rows, and a
+ * full strip goes to the LCD by DMA while the other fills. That's all the RAM an image takes,
+ * about 4 KB with the QOI index, whatever its size.
+ *
+ * Two compressed formats, told apart by their first four bytes:
+ *   "qoif"  QOI (https://qoiformat.org), with 3 or 4 channels; alpha is ignored.
+ *   "R565"  width and height, 16-bit little endian, then packets of RGB565 pixels, each little
+ *           endian: a byte n below 0x80 and n + 1 pixels, or a byte n from 0x80 and one pixel
+ *           repeated n - 0x7F times.
+ * Parts of an image off the screen are decoded and dropped.
+ *
+ * When an image is done, the time it took to arrive and the time spent decoding and sending it
+ * to the LCD are reported over the logger.
+ *
+ * Only used from the thread that owns the LCD.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class terminal;
+
+class image_stream {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Size of the screen in pixels. */
+    static constexpr std::uint32_t SCREEN_WIDTH { 240 };
+    static constexpr std::uint32_t SCREEN_HEIGHT { 240 };
+
+    /** Rows decoded before they're sent to the LCD. */
+    static constexpr std::uint32_t STRIP_ROWS { 4 };
+
+    /** Larger images are refused; keeps the pixel count in 32 bits. */
+    static constexpr std::uint32_t MAX_SIZE { 4096 };
+
+    /** An image that stops arriving for this long is abandoned. */
+    static constexpr std::uint32_t TIMEOUT_MS { 2000 };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    image_stream();
+
+    /**
+     * Expects an image, to be drawn with its top left corner at x, y on the screen.
+     *
+     * @param x      where the image's left edge goes.
+     * @param y      where the image's top edge goes.
+     * @param screen the terminal whose screen it's drawn on, to follow its hardware scrolling, or
+     *               nullptr to draw straight to GRAM.
+     * @param ms     the time now, in milliseconds.
+     */
+    void start(std::uint32_t x, std::uint32_t y, const terminal *screen, std::uint32_t ms);
+
+    /** Whether an image has been started and hasn't ended. */
+    bool active() const { return _state != State::IDLE; }
+
+    /**
+     * Decodes the next bytes of the image and draws what they complete. Stops after the image's
+     * last byte; anything after it isn't part of the image. A broken header abandons the image,
+     * but its bytes are still taken until they stop arriving, see idle().
+     *
+     * @param[in] data the bytes.
+     * @param     size the number of bytes.
+     * @param     ms   the time now, in milliseconds.
+     *
+     * @return the number of bytes taken.
+     */
+    std::size_t feed(const std::uint8_t *data, std::size_t size, std::uint32_t ms);
+
+    /**
+     * Abandons the image if nothing has arrived for TIMEOUT_MS. Call while active() and nothing
+     * is being received.
+     *
+     * @param ms the time now, in milliseconds.
+     */
+    void idle(std::uint32_t ms);
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    enum class State : std::uint8_t {
+        IDLE,
+        /** The first four bytes, then the rest of the header for the format they name. */
+        HEADER,
+        /** QOI: an op, then the bytes it's waiting for, then the end marker. */
+        QOI_OP,
+        QOI_ARGS,
+        QOI_END,
+        /** R565: a packet's count, then its pixels. */
+        RLE_COUNT,
+        RLE_PIXELS,
+        /** The header was broken; bytes are dropped until they stop. */
+        DISCARD,
+    };
+
+    enum class Format : std::uint8_t {
+        QOI,
+        RLE565,
+    };
+
+    struct Rgba {
+        std::uint8_t r;
+        std::uint8_t g;
+        std::uint8_t b;
+        std::uint8_t a;
+    };
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    State _state;
+    Format _format;
+
+    /** Where the image goes. */
+    const terminal *_screen;
+    std::uint32_t _x;
+    std::uint32_t _y;
+
+    /** The image, and how much of it is on the screen. */
+    std::uint32_t _width;
+    std::uint32_t _height;
+    std::uint32_t _visible_width;
+    std::uint32_t _visible_height;
+
+    /** The header as it arrives, then the bytes the current op or packet needs. */
+    std::uint8_t _bytes[14];
+    std::uint8_t _have;
+    std::uint8_t _need;
+
+    /** QOI: the op waiting for its bytes, the previous pixel, and recently seen pixels. */
+    std::uint8_t _op;
+    Rgba _pixel;
+    Rgba _index[64];
+
+    /** R565: pixels left in the packet, and whether it's a run rather than literals. */
+    std::uint32_t _count;
+    bool _run;
+
+    /** Decoding position, and pixels still to come. */
+    std::uint32_t _row;
+    std::uint32_t _column;
+    std::uint32_t _remaining;
+
+    /** The strip being filled, its first row, and where the current row goes in it. */
+    std::uint32_t _strip;
+    std::uint32_t _strip_row;
+    std::uint16_t *_line;
+    std::uint32_t _line_width;
+
+    /** For the report at the end. */
+    std::uint32_t _size;
+    std::uint32_t _start_ms;
+    std::uint32_t _last_ms;
+    std::uint64_t _busy_cycles;
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Takes a byte of the header; starts decoding once it's all there. */
+    void header(std::uint8_t byte);
+
+    /** Takes a QOI op, or the bytes an op was waiting for. */
+    void qoi_op(std::uint8_t byte);
+    void qoi_args();
+
+    /** Takes an R565 packet's count, or a byte of its pixels. */
+    void rle_count(std::uint8_t byte);
+    void rle_pixel(std::uint8_t byte);
+
+    /** Emits the QOI pixel, count times, and remembers it in the index. */
+    void qoi_emit(std::uint32_t count);
+
+    /** Emits a pixel count times, capped at the pixels left. */
+    void emit(std::uint16_t pixel, std::uint32_t count);
+
+    /** Moves to the next row, sending the strip if it's full or the image is done. */
+    void end_row();
+
+    /** Sends the decoded rows of the strip to the LCD and switches to the other strip. */
+    void flush();
+
+    /** The GRAM row a row of the image is drawn in. */
+    std::uint32_t gram_row(std::uint32_t row) const;
+
+    /** Points at where the current row goes in the strip. */
+    void start_row();
+
+    /** Reports on an image that's done. */
+    void report() const;
+
+    /** Gives up on the image, dropping its bytes until they stop. */
+    void fail(const char *reason);
+};
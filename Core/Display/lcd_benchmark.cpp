@@ -0,0 +1,536 @@
+/*
+ * lcd_benchmark.cpp
+ *
+ * Benchmarks for the LCD drawing paths.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "lcd_benchmark.h"
+
+#include "canvas.h"
+#include "cycles.h"
+#include "image_stream.h"
+#include "logger.h"
+#include "st7789h2_fixed.h"
+#include "stm32_lcd.h"
+#include "stm32l562e_discovery_lcd.h"
+#include "strip_chart.h"
+
+#include <cstdint>
+#include <cstdio>
+
+namespace lcd_benchmark {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static constexpr std::uint32_t SCREEN_SIZE { 240 };
+
+/* Glyphs drawn per font and path */
+static constexpr std::uint32_t GLYPH_COUNT { 2000 };
+
+/* Screen clears and cell fills timed */
+static constexpr std::uint32_t CLEAR_COUNT { 20 };
+static constexpr std::uint32_t FILL_COUNT { 2000 };
+static constexpr std::uint32_t FILL_WIDTH { 11 };
+static constexpr std::uint32_t FILL_HEIGHT { 16 };
+
+/* Blits are done in strips of this many lines, double buffered */
+static constexpr std::uint32_t STRIP_HEIGHT { 8 };
+static constexpr std::uint32_t BLIT_COUNT { 10 };
+alignas(4) static std::uint16_t g_strips[2][SCREEN_SIZE * STRIP_HEIGHT];
+
+/* Font decoding draws into the strips, taken as one canvas tall enough for Font24 */
+static constexpr std::uint16_t DECODE_WIDTH { 2 * SCREEN_SIZE * STRIP_HEIGHT / 24 };
+
+/* Images are fed in chunks the size the display thread reads */
+static constexpr std::size_t IMAGE_CHUNK_SIZE { 64 };
+
+/* Full screen image headers, and op patterns repeated for their pixels: 16 pixels each */
+static constexpr std::uint8_t QOI_HEADER[] = { 'q', 'o', 'i', 'f', 0, 0, 0, 240, 0, 0, 0, 240, 3, 0 };
+static constexpr std::uint8_t QOI_PATTERN[] = {
+    0xFE, 0x20, 0x80, 0xC0,                                 /* RGB */
+    0x7B, 0x6A, 0x5F, 0x6A, 0x7B, 0x55, 0x66, 0x59,         /* DIFF x 8 */
+    0xA4, 0x88, 0x9C, 0x77,                                 /* LUMA x 2 */
+    0x05, 0x2A,                                             /* INDEX x 2 */
+    0xC2,                                                   /* RUN of 3 */
+};
+static constexpr std::uint8_t RLE_HEADER[] = { 'R', '5', '6', '5', 240, 0, 240, 0 };
+static constexpr std::uint8_t RLE_PATTERN[] = {
+    0x07, 0x1F, 0x00, 0xE0, 0x07, 0x00, 0xF8, 0xFF, 0xFF,   /* 8 literals */
+    0x00, 0x00, 0x10, 0x84, 0xEF, 0x7B, 0x1F, 0xF8,
+    0x87, 0x20, 0x01,                                       /* a run of 8 */
+};
+
+/* Samples plotted, and how many arrive together in a burst */
+static constexpr std::uint32_t PLOT_SAMPLES { 2000 };
+static constexpr std::uint32_t PLOT_BURST { 10 };
+
+/* Driver calls timed per path, and the 16-bit BMP drawn */
+static constexpr std::uint32_t DRIVER_COUNT { 2000 };
+static constexpr std::uint32_t BITMAP_SIZE { 16 };
+static constexpr std::uint32_t BITMAP_HEADER { 54 };
+alignas(4) static std::uint8_t g_bitmap[BITMAP_HEADER + 2 * BITMAP_SIZE * BITMAP_SIZE];
+
+/* Bus words written through the counting IO, and the IO it passes them on to */
+static std::uint32_t g_bus_words;
+static ST7789H2_IO_t g_bus;
+
+/* Typical text: a few dozen distinct characters */
+static constexpr char GLYPH_TEXT[] = "The quick brown fox jumps over the lazy dog 0123456789. ";
+
+/* The display is set up in portrait */
+using fixed_driver = st7789h2_fixed<ST7789H2_ORIENTATION_PORTRAIT>;
+
+/* The component driver, behind the same calls as st7789h2_fixed */
+struct runtime_driver {
+    ST7789H2_Object_t &object;
+
+    std::int32_t set_cursor(std::uint32_t x, std::uint32_t y) {
+        return ST7789H2_SetCursor(&object, x, y);
+    }
+    std::int32_t draw_vline(std::uint32_t x, std::uint32_t y, std::uint32_t length, std::uint32_t color) {
+        return ST7789H2_DrawVLine(&object, x, y, length, color);
+    }
+    std::int32_t fill_rgb_rect(std::uint32_t x, std::uint32_t y, std::uint8_t *data,
+                               std::uint32_t width, std::uint32_t height) {
+        return ST7789H2_FillRGBRect(&object, x, y, data, width, height);
+    }
+    std::int32_t draw_bitmap(std::uint32_t x, std::uint32_t y, std::uint8_t *bmp) {
+        return ST7789H2_DrawBitmap(&object, x, y, bmp);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static std::uint64_t draw_glyphs(sFONT &font);
+template <typename Font>
+static std::uint64_t decode_glyphs(const Font &font, std::uint16_t width, std::uint16_t height);
+static std::uint64_t blend_glyphs(const aa_font &font, bool portable);
+static void prepare_strip(std::uint16_t *strip, std::uint32_t y, std::uint32_t frame);
+static std::uint64_t blit_screens(bool async);
+static std::uint64_t stream_image(image_stream &stream, const std::uint8_t *header, std::size_t header_size,
+                                  const std::uint8_t *pattern, std::size_t pattern_size, std::uint32_t &size);
+static std::uint64_t plot_samples(strip_chart &chart, std::uint32_t per_frame);
+template <typename Call>
+static void compare_drivers(const char *name, Call call, runtime_driver &runtime, fixed_driver &fixed,
+                            runtime_driver &counted_runtime, fixed_driver &counted_fixed);
+static void make_bitmap();
+static std::int32_t count_write(std::uint16_t address, std::uint16_t reg, std::uint8_t *data, std::uint32_t length);
+static std::int32_t count_fill(std::uint16_t address, std::uint16_t reg, std::uint16_t value, std::uint32_t length);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void glyphs() {
+    sFONT *const fonts[] = { &Font12, &Font16, &Font24 };
+    sFONT *const font_before = UTIL_LCD_GetFont();
+
+    UTIL_LCD_SetTextColor(UTIL_LCD_COLOR_WHITE);
+    UTIL_LCD_SetBackColor(UTIL_LCD_COLOR_BLACK);
+
+    for (auto *font : fonts) {
+        UTIL_LCD_SetGlyphCache(0);
+        const auto uncached_us = cycles::to_us(draw_glyphs(*font)) + 1;
+
+        UTIL_LCD_SetGlyphCache(1);
+        UTIL_LCD_ClearGlyphCache();
+        const auto cached_us = cycles::to_us(draw_glyphs(*font)) + 1;
+
+        std::uint32_t hits, misses;
+        UTIL_LCD_GetGlyphCacheStats(&hits, &misses);
+
+        LOG("glyphs: Font%u %lu/s uncached, %lu/s cached (%lu hits, %lu misses)\n",
+                static_cast<unsigned>(font->Height),
+                static_cast<unsigned long>(GLYPH_COUNT * 1000000ULL / uncached_us),
+                static_cast<unsigned long>(GLYPH_COUNT * 1000000ULL / cached_us),
+                static_cast<unsigned long>(hits), static_cast<unsigned long>(misses));
+    }
+
+    UTIL_LCD_SetFont(font_before);
+}
+
+void fonts() {
+    struct pair {
+        const sFONT &font;
+        const packed_font &packed;
+    };
+    static const pair pairs[] = {
+        { Font8, PackedFont8 }, { Font12, PackedFont12 }, { Font16, PackedFont16 },
+        { Font20, PackedFont20 }, { Font24, PackedFont24 },
+    };
+
+    for (const auto &p : pairs) {
+        const auto &font = p.font;
+        const auto &packed = p.packed;
+        const auto sfont_us = cycles::to_us(decode_glyphs(font, font.Width, font.Height)) + 1;
+        const auto packed_us = cycles::to_us(decode_glyphs(packed, packed.width, packed.height)) + 1;
+        const std::uint32_t sfont_bytes = 95U * font.Height * ((font.Width + 7U) / 8U);
+
+        LOG("fonts: Font%u sFONT %lu B %lu/s, packed %lu B %lu/s\n",
+                static_cast<unsigned>(font.Height),
+                static_cast<unsigned long>(sfont_bytes),
+                static_cast<unsigned long>(GLYPH_COUNT * 1000000ULL / sfont_us),
+                static_cast<unsigned long>(packed.size()),
+                static_cast<unsigned long>(GLYPH_COUNT * 1000000ULL / packed_us));
+    }
+}
+
+void aa_fonts() {
+    const aa_font *const fonts[] = { &AAFont12, &AAFont16 };
+
+    for (const auto *font : fonts) {
+        const auto palette_us = cycles::to_us(decode_glyphs(*font, font->width, font->height)) + 1;
+        const auto dsp_us = cycles::to_us(blend_glyphs(*font, false)) + 1;
+        const auto portable_us = cycles::to_us(blend_glyphs(*font, true)) + 1;
+
+        LOG("aa fonts: AAFont%u %lu B, %lu/s palette, blended %lu/s DSP, %lu/s portable\n",
+                static_cast<unsigned>(font->height),
+                static_cast<unsigned long>(font->size()),
+                static_cast<unsigned long>(GLYPH_COUNT * 1000000ULL / palette_us),
+                static_cast<unsigned long>(GLYPH_COUNT * 1000000ULL / dsp_us),
+                static_cast<unsigned long>(GLYPH_COUNT * 1000000ULL / portable_us));
+    }
+}
+
+void fills() {
+    static constexpr std::uint32_t colors[] = { UTIL_LCD_COLOR_BLACK, UTIL_LCD_COLOR_BLUE };
+
+    auto start = cycles::now();
+    for (std::uint32_t i = 0; i < CLEAR_COUNT; ++i) {
+        UTIL_LCD_Clear(colors[i % 2]);
+    }
+    const auto clear_us = cycles::to_us(cycles::now() - start) / CLEAR_COUNT + 1;
+
+    const std::uint32_t columns = SCREEN_SIZE / FILL_WIDTH;
+    const std::uint32_t rows = SCREEN_SIZE / FILL_HEIGHT;
+
+    start = cycles::now();
+    for (std::uint32_t i = 0; i < FILL_COUNT; ++i) {
+        const auto cell = i % (columns * rows);
+        UTIL_LCD_FillRect((cell % columns) * FILL_WIDTH, (cell / columns) * FILL_HEIGHT,
+                FILL_WIDTH, FILL_HEIGHT, colors[i % 2]);
+    }
+    const auto fill_us = cycles::to_us(cycles::now() - start) + 1;
+
+    LOG("fills: clear %lu us (%lu Mpixel/s), %lux%lu rect %lu/s\n",
+            static_cast<unsigned long>(clear_us),
+            static_cast<unsigned long>(SCREEN_SIZE * SCREEN_SIZE / clear_us),
+            static_cast<unsigned long>(FILL_WIDTH), static_cast<unsigned long>(FILL_HEIGHT),
+            static_cast<unsigned long>(FILL_COUNT * 1000000ULL / fill_us));
+}
+
+void blits() {
+    const auto sync_us = cycles::to_us(blit_screens(false)) / BLIT_COUNT + 1;
+    const auto async_us = cycles::to_us(blit_screens(true)) / BLIT_COUNT + 1;
+
+    LOG("blits: full screen in %lu-line strips %lu us sync, %lu us DMA\n",
+            static_cast<unsigned long>(STRIP_HEIGHT),
+            static_cast<unsigned long>(sync_us), static_cast<unsigned long>(async_us));
+}
+
+void images() {
+    static image_stream stream {};
+    std::uint32_t qoi_size, rle_size;
+
+    const auto qoi_us = cycles::to_us(stream_image(stream, QOI_HEADER, sizeof(QOI_HEADER),
+                                                   QOI_PATTERN, sizeof(QOI_PATTERN), qoi_size)) + 1;
+    const auto rle_us = cycles::to_us(stream_image(stream, RLE_HEADER, sizeof(RLE_HEADER),
+                                                   RLE_PATTERN, sizeof(RLE_PATTERN), rle_size)) + 1;
+
+    LOG("images: full screen QOI %lu B %lu us (%lu kpx/s), R565 %lu B %lu us (%lu kpx/s)\n",
+            static_cast<unsigned long>(qoi_size), static_cast<unsigned long>(qoi_us),
+            static_cast<unsigned long>(SCREEN_SIZE * SCREEN_SIZE * 1000ULL / qoi_us),
+            static_cast<unsigned long>(rle_size), static_cast<unsigned long>(rle_us),
+            static_cast<unsigned long>(SCREEN_SIZE * SCREEN_SIZE * 1000ULL / rle_us));
+}
+
+void plots() {
+    static strip_chart chart {};
+
+    const auto single_us = cycles::to_us(plot_samples(chart, 1)) + 1;
+    const auto burst_us = cycles::to_us(plot_samples(chart, PLOT_BURST)) + 1;
+
+    LOG("plots: %lu samples/s one a frame, %lu/s %lu a frame\n",
+            static_cast<unsigned long>(PLOT_SAMPLES * 1000000ULL / single_us),
+            static_cast<unsigned long>(PLOT_SAMPLES * 1000000ULL / burst_us),
+            static_cast<unsigned long>(PLOT_BURST));
+}
+
+void drivers() {
+    auto &object = *static_cast<ST7789H2_Object_t *>(Lcd_CompObj[0]);
+    runtime_driver runtime { object };
+    fixed_driver fixed { object };
+
+    if (!fixed.matches()) {
+        LOG("drivers: the LCD isn't in portrait, skipped\n");
+        return;
+    }
+
+    /* A copy of the object whose bus counts the words written, then writes them */
+    auto counted = object;
+    counted.Ctx.handle = &counted;
+    g_bus = object.IO;
+    counted.IO.WriteReg = count_write;
+    counted.IO.FillReg = (object.IO.FillReg != nullptr) ? count_fill : nullptr;
+    runtime_driver counted_runtime { counted };
+    fixed_driver counted_fixed { counted };
+
+    make_bitmap();
+    auto *cell = reinterpret_cast<std::uint8_t *>(g_strips[0]);
+
+    /* Neither path waits for DMA */
+    while (BSP_LCD_GetTransferStatus(0, nullptr) == BSP_ERROR_BUSY) {
+        /* Wait */
+    }
+
+    /* Terminal cells, clear of the last column, which both paths write twice */
+    const std::uint32_t columns = SCREEN_SIZE / FILL_WIDTH;
+    const std::uint32_t rows = SCREEN_SIZE / FILL_HEIGHT;
+    const auto x = [columns](std::uint32_t i) { return (i % columns) * FILL_WIDTH; };
+    const auto y = [columns, rows](std::uint32_t i) { return ((i / columns) % rows) * FILL_HEIGHT; };
+
+    compare_drivers("cursor", [&](auto &driver, std::uint32_t i) {
+        driver.set_cursor(x(i), y(i));
+    }, runtime, fixed, counted_runtime, counted_fixed);
+
+    compare_drivers("vline", [&](auto &driver, std::uint32_t i) {
+        driver.draw_vline(x(i), y(i), FILL_HEIGHT, UTIL_LCD_COLOR_WHITE);
+    }, runtime, fixed, counted_runtime, counted_fixed);
+
+    compare_drivers("cell", [&](auto &driver, std::uint32_t i) {
+        driver.fill_rgb_rect(x(i), y(i), cell, FILL_WIDTH, FILL_HEIGHT);
+    }, runtime, fixed, counted_runtime, counted_fixed);
+
+    compare_drivers("bitmap", [&](auto &driver, std::uint32_t i) {
+        driver.draw_bitmap(x(i), y(i), g_bitmap);
+    }, runtime, fixed, counted_runtime, counted_fixed);
+}
+
+void run_all() {
+    glyphs();
+    fonts();
+    aa_fonts();
+    fills();
+    blits();
+    images();
+    plots();
+    drivers();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Draws GLYPH_COUNT characters of GLYPH_TEXT across the screen, returns the cycles it took */
+static std::uint64_t draw_glyphs(sFONT &font) {
+    const std::uint32_t columns = SCREEN_SIZE / font.Width;
+    const std::uint32_t rows = SCREEN_SIZE / font.Height;
+
+    UTIL_LCD_SetFont(&font);
+
+    const auto start = cycles::now();
+
+    for (std::uint32_t i = 0; i < GLYPH_COUNT; ++i) {
+        const auto cell = i % (columns * rows);
+        UTIL_LCD_DisplayChar((cell % columns) * font.Width, (cell / columns) * font.Height,
+                static_cast<std::uint8_t>(GLYPH_TEXT[i % (sizeof(GLYPH_TEXT) - 1)]));
+    }
+
+    return cycles::now() - start;
+}
+
+/* Decodes GLYPH_COUNT characters of GLYPH_TEXT into a RAM canvas, returns the cycles it took */
+template <typename Font>
+static std::uint64_t decode_glyphs(const Font &font, std::uint16_t width, std::uint16_t height) {
+    canvas target { &g_strips[0][0], { 0, 0, DECODE_WIDTH, height } };
+    const std::uint32_t columns = DECODE_WIDTH / width;
+
+    const auto start = cycles::now();
+
+    for (std::uint32_t i = 0; i < GLYPH_COUNT; ++i) {
+        target.draw_char((i % columns) * width, 0, font, GLYPH_TEXT[i % (sizeof(GLYPH_TEXT) - 1)],
+                0xFFFF, 0x0000);
+    }
+
+    return cycles::now() - start;
+}
+
+/* Blends GLYPH_COUNT characters over the strips, returns the cycles it took */
+static std::uint64_t blend_glyphs(const aa_font &font, bool portable) {
+    const std::uint32_t columns = DECODE_WIDTH / font.width;
+
+    const auto start = cycles::now();
+
+    for (std::uint32_t i = 0; i < GLYPH_COUNT; ++i) {
+        const char c = GLYPH_TEXT[i % (sizeof(GLYPH_TEXT) - 1)];
+        auto *cell = &g_strips[0][(i % columns) * font.width];
+
+        if (portable) {
+            font.blend_portable(c, cell, DECODE_WIDTH, 0xFFE0);
+        } else {
+            font.blend(c, cell, DECODE_WIDTH, 0xFFE0);
+        }
+    }
+
+    return cycles::now() - start;
+}
+
+/* Fills a strip with a moving gradient; stands in for rendering work */
+static void prepare_strip(std::uint16_t *strip, std::uint32_t y, std::uint32_t frame) {
+    for (std::uint32_t row = 0; row < STRIP_HEIGHT; ++row) {
+        for (std::uint32_t x = 0; x < SCREEN_SIZE; ++x) {
+            const auto red = ((x + frame * 8) >> 3) & 0x1F;
+            const auto green = ((y + row) >> 2) & 0x3F;
+            strip[row * SCREEN_SIZE + x] = static_cast<std::uint16_t>((red << 11) | (green << 5) | (frame & 0x1F));
+        }
+    }
+}
+
+/* Blits BLIT_COUNT full screens, returns the cycles it took */
+static std::uint64_t blit_screens(bool async) {
+    const auto start = cycles::now();
+
+    for (std::uint32_t frame = 0; frame < BLIT_COUNT; ++frame) {
+        for (std::uint32_t y = 0; y < SCREEN_SIZE; y += STRIP_HEIGHT) {
+            auto *strip = g_strips[(y / STRIP_HEIGHT) % 2];
+
+            if (!async) {
+                prepare_strip(strip, y, frame);
+                BSP_LCD_FillRGBRect(0, 0, y, reinterpret_cast<std::uint8_t *>(strip), SCREEN_SIZE, STRIP_HEIGHT);
+                continue;
+            }
+
+            /* The queue is in order, so once at most one strip is pending this buffer is free */
+            std::uint32_t pending;
+            while (BSP_LCD_GetTransferStatus(0, &pending) == BSP_ERROR_BUSY && pending > 1) {
+                /* Wait */
+            }
+
+            prepare_strip(strip, y, frame);
+            while (BSP_LCD_FillRGBRect_DMA(0, 0, y, reinterpret_cast<std::uint8_t *>(strip),
+                                           SCREEN_SIZE, STRIP_HEIGHT) == BSP_ERROR_BUSY) {
+                /* Wait */
+            }
+        }
+    }
+
+    while (BSP_LCD_GetTransferStatus(0, nullptr) == BSP_ERROR_BUSY) {
+        /* Wait */
+    }
+
+    return cycles::now() - start;
+}
+
+/* Streams a full screen image made of a header and a pattern repeated, returns the cycles it took */
+static std::uint64_t stream_image(image_stream &stream, const std::uint8_t *header, std::size_t header_size,
+                                  const std::uint8_t *pattern, std::size_t pattern_size, std::uint32_t &size) {
+    const auto start = cycles::now();
+    std::uint8_t chunk[IMAGE_CHUNK_SIZE];
+    std::size_t at = 0;
+
+    stream.start(0, 0, nullptr, HAL_GetTick());
+    size = static_cast<std::uint32_t>(stream.feed(header, header_size, HAL_GetTick()));
+
+    /* The pattern runs on past the last pixel into QOI's end marker, which isn't checked */
+    while (stream.active()) {
+        for (auto &byte : chunk) {
+            byte = pattern[at++ % pattern_size];
+        }
+        size += static_cast<std::uint32_t>(stream.feed(chunk, sizeof(chunk), HAL_GetTick()));
+    }
+
+    return cycles::now() - start;
+}
+
+/* Plots a triangle wave sent as text, rendering every per_frame samples, returns the cycles it took */
+static std::uint64_t plot_samples(strip_chart &chart, std::uint32_t per_frame) {
+    chart.start();
+    const auto start = cycles::now();
+
+    for (std::uint32_t i = 0; i < PLOT_SAMPLES; ++i) {
+        const auto value = static_cast<int>((i * 7) % 400) - 200;
+        char line[16];
+        const auto length = std::snprintf(line, sizeof(line), "%d.5\n", (value < 0) ? -value - 100 : value - 100);
+        chart.feed(line, static_cast<std::size_t>(length));
+
+        if ((i + 1) % per_frame == 0) {
+            chart.render();
+        }
+    }
+    chart.render();
+
+    const auto elapsed = cycles::now() - start;
+    chart.stop();
+    return elapsed;
+}
+
+/* Logs the cycles a call takes on each path, averaged over DRIVER_COUNT, and the bus words it writes */
+template <typename Call>
+static void compare_drivers(const char *name, Call call, runtime_driver &runtime, fixed_driver &fixed,
+                            runtime_driver &counted_runtime, fixed_driver &counted_fixed) {
+    auto start = cycles::now();
+    for (std::uint32_t i = 0; i < DRIVER_COUNT; ++i) {
+        call(runtime, i);
+    }
+    const auto runtime_cycles = (cycles::now() - start) / DRIVER_COUNT;
+
+    start = cycles::now();
+    for (std::uint32_t i = 0; i < DRIVER_COUNT; ++i) {
+        call(fixed, i);
+    }
+    const auto fixed_cycles = (cycles::now() - start) / DRIVER_COUNT;
+
+    g_bus_words = 0;
+    call(counted_runtime, 0);
+    const auto runtime_words = g_bus_words;
+
+    g_bus_words = 0;
+    call(counted_fixed, 0);
+    const auto fixed_words = g_bus_words;
+
+    LOG("drivers: %s %lu cycles runtime, %lu fixed; %lu bus words runtime, %lu fixed\n", name,
+            static_cast<unsigned long>(runtime_cycles), static_cast<unsigned long>(fixed_cycles),
+            static_cast<unsigned long>(runtime_words), static_cast<unsigned long>(fixed_words));
+}
+
+/* Fills in a BITMAP_SIZE square 16-bit BMP: the header fields the drivers read, and a gradient */
+static void make_bitmap() {
+    const auto put = [](std::uint32_t at, std::uint32_t value) {
+        for (std::uint32_t i = 0; i < 4; ++i) {
+            g_bitmap[at + i] = static_cast<std::uint8_t>(value >> (8 * i));
+        }
+    };
+
+    g_bitmap[0] = 'B';
+    g_bitmap[1] = 'M';
+    put(2, sizeof(g_bitmap));
+    put(10, BITMAP_HEADER);
+    put(14, 40);
+    put(18, BITMAP_SIZE);
+    put(22, BITMAP_SIZE);
+    put(26, 1 | (16 << 16));
+
+    auto *pixels = reinterpret_cast<std::uint16_t *>(&g_bitmap[BITMAP_HEADER]);
+    for (std::uint32_t i = 0; i < BITMAP_SIZE * BITMAP_SIZE; ++i) {
+        pixels[i] = static_cast<std::uint16_t>(((i % BITMAP_SIZE) << 12) | ((i / BITMAP_SIZE) << 1));
+    }
+}
+
+/* The counting bus: a command and its words */
+static std::int32_t count_write(std::uint16_t address, std::uint16_t reg, std::uint8_t *data, std::uint32_t length) {
+    g_bus_words += 1 + length;
+    return g_bus.WriteReg(address, reg, data, length);
+}
+
+static std::int32_t count_fill(std::uint16_t address, std::uint16_t reg, std::uint16_t value, std::uint32_t length) {
+    g_bus_words += 1 + length;
+    return g_bus.FillReg(address, reg, value, length);
+}
+
+}  // namespace lcd_benchmark
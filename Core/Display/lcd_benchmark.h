@@ -0,0 +1,68 @@
+/*
+ * lcd_benchmark.h
+ *
+ * Benchmarks for the LCD drawing paths. Results are reported over the logger. Each benchmark
+ * draws over the whole screen, so only run them from the thread that owns the LCD.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+namespace lcd_benchmark {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Glyphs/s drawn by UTIL_LCD_DisplayChar for Font12/16/24, with and without the glyph cache.
+ * Font24 is bigger than the default cache's slots, so it's drawn uncached both times.
+ */
+void glyphs();
+
+/**
+ * Glyphs/s decoded into a RAM canvas from the sFONT tables and from the packed fonts, and the
+ * flash each takes.
+ */
+void fonts();
+
+/**
+ * Glyphs/s drawn into a RAM canvas in the anti-aliased fonts: opaque through a palette, and
+ * blended over the canvas with the DSP and the portable kernels.
+ */
+void aa_fonts();
+
+/** Time to clear the whole screen, and to fill terminal-cell-sized rectangles. */
+void fills();
+
+/**
+ * Time to blit the whole screen in strips, waiting on each strip versus preparing the next strip
+ * while DMA sends the previous one.
+ */
+void blits();
+
+/**
+ * Full screen images streamed through an image_stream in BLE-read-sized chunks, in each format,
+ * with every kind of op or packet: the fastest the display can take them in.
+ */
+void images();
+
+/**
+ * Samples/s plotted by a strip_chart from text, drawing after every sample and after every burst
+ * of them, as BLE delivers them.
+ */
+void plots();
+
+/**
+ * Cycles a call takes through the ST7789H2 component driver, which picks GRAM offsets and MADCTL
+ * values by orientation at run time, and through st7789h2_fixed, where they're compile time
+ * constants, for the calls the terminal and images make; and the bus words each writes.
+ */
+void drivers();
+
+/** Runs every benchmark. */
+void run_all();
+
+}  // namespace lcd_benchmark
@@ -0,0 +1,108 @@
+/*
+ * lcd_driver.cpp
+ *
+ * The fixed portrait ST7789H2 driver, behind the BSP LCD.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "lcd_driver.h"
+
+#include "st7789h2_fixed.h"
+
+namespace lcd_driver {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using portrait_driver = st7789h2_fixed<ST7789H2_ORIENTATION_PORTRAIT>;
+
+/* The component driver's table, as the BSP uses it */
+static LCD_Drv_t &g_component { *reinterpret_cast<LCD_Drv_t *>(&ST7789H2_Driver) };
+
+/* The component driver's table with the drawing functions swapped */
+static LCD_Drv_t g_driver {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::int32_t draw_bitmap(void *object, std::uint32_t x, std::uint32_t y, std::uint8_t *bmp);
+static std::int32_t fill_rgb_rect(void *object, std::uint32_t x, std::uint32_t y, std::uint8_t *data,
+                                  std::uint32_t width, std::uint32_t height);
+static std::int32_t draw_hline(void *object, std::uint32_t x, std::uint32_t y, std::uint32_t length,
+                               std::uint32_t color);
+static std::int32_t draw_vline(void *object, std::uint32_t x, std::uint32_t y, std::uint32_t length,
+                               std::uint32_t color);
+static std::int32_t fill_rect(void *object, std::uint32_t x, std::uint32_t y, std::uint32_t width,
+                              std::uint32_t height, std::uint32_t color);
+static std::int32_t set_pixel(void *object, std::uint32_t x, std::uint32_t y, std::uint32_t color);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool install() {
+    auto *object = static_cast<ST7789H2_Object_t *>(Lcd_CompObj[0]);
+    if (object == nullptr || Lcd_Drv[0] != &g_component || !portrait_driver { *object }.matches()) {
+        return false;
+    }
+
+    g_driver = g_component;
+    g_driver.DrawBitmap = draw_bitmap;
+    g_driver.FillRGBRect = fill_rgb_rect;
+    g_driver.DrawHLine = draw_hline;
+    g_driver.DrawVLine = draw_vline;
+    g_driver.FillRect = fill_rect;
+    g_driver.SetPixel = set_pixel;
+
+    /* The BSP waits for its DMA transfers before calling the table, as the fixed driver needs */
+    Lcd_Drv[0] = &g_driver;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::int32_t draw_bitmap(void *object, std::uint32_t x, std::uint32_t y, std::uint8_t *bmp) {
+    portrait_driver driver { *static_cast<ST7789H2_Object_t *>(object) };
+    return driver.matches() ? driver.draw_bitmap(x, y, bmp) : g_component.DrawBitmap(object, x, y, bmp);
+}
+
+static std::int32_t fill_rgb_rect(void *object, std::uint32_t x, std::uint32_t y, std::uint8_t *data,
+                                  std::uint32_t width, std::uint32_t height) {
+    portrait_driver driver { *static_cast<ST7789H2_Object_t *>(object) };
+    return driver.matches() ? driver.fill_rgb_rect(x, y, data, width, height)
+                            : g_component.FillRGBRect(object, x, y, data, width, height);
+}
+
+static std::int32_t draw_hline(void *object, std::uint32_t x, std::uint32_t y, std::uint32_t length,
+                               std::uint32_t color) {
+    portrait_driver driver { *static_cast<ST7789H2_Object_t *>(object) };
+    return driver.matches() ? driver.draw_hline(x, y, length, color)
+                            : g_component.DrawHLine(object, x, y, length, color);
+}
+
+static std::int32_t draw_vline(void *object, std::uint32_t x, std::uint32_t y, std::uint32_t length,
+                               std::uint32_t color) {
+    portrait_driver driver { *static_cast<ST7789H2_Object_t *>(object) };
+    return driver.matches() ? driver.draw_vline(x, y, length, color)
+                            : g_component.DrawVLine(object, x, y, length, color);
+}
+
+static std::int32_t fill_rect(void *object, std::uint32_t x, std::uint32_t y, std::uint32_t width,
+                              std::uint32_t height, std::uint32_t color) {
+    portrait_driver driver { *static_cast<ST7789H2_Object_t *>(object) };
+    return driver.matches() ? driver.fill_rect(x, y, width, height, color)
+                            : g_component.FillRect(object, x, y, width, height, color);
+}
+
+static std::int32_t set_pixel(void *object, std::uint32_t x, std::uint32_t y, std::uint32_t color) {
+    portrait_driver driver { *static_cast<ST7789H2_Object_t *>(object) };
+    return driver.matches() ? driver.set_pixel(x, y, color) : g_component.SetPixel(object, x, y, color);
+}
+
+}  // namespace lcd_driver
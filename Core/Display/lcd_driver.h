@@ -0,0 +1,34 @@
+/*
+ * lcd_driver.h
+ *
+ * Puts st7789h2_fixed behind the BSP LCD. The board's display is always portrait, so the BSP's
+ * drawing functions (BSP_LCD_FillRect and the rest, and so UTIL_LCD, the terminal, the chart and
+ * the render commands) draw through st7789h2_fixed<ST7789H2_ORIENTATION_PORTRAIT> rather than
+ * the component driver, which looks the orientation up on every call. Control functions and
+ * reads stay with the component driver, and so do the BSP's DMA transfers, which set their window
+ * from the DMA interrupt.
+ *
+ * If the component is ever put in another orientation (BSP_LCD_SetOrientation()), the calls go
+ * back to the component driver until it's portrait again.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+namespace lcd_driver {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Swaps the BSP's driver table for one drawing through the fixed portrait driver. Call after
+ * BSP_LCD_Init(), from the thread that owns the LCD.
+ *
+ * @return false if the LCD isn't initialized in portrait; the component driver is left in place.
+ */
+bool install();
+
+}  // namespace lcd_driver
@@ -0,0 +1,68 @@
+/*
+ * packed_font.cpp
+ *
+ * Decoding of packed fonts.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "packed_font.h"
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void packed_font::decode(char c, std::uint16_t *dst, std::uint32_t stride,
+                         std::uint16_t fg, std::uint16_t bg) const {
+    if (!contains(c)) {
+        for (std::uint32_t row = 0; row < height; ++row, dst += stride) {
+            std::fill_n(dst, width, bg);
+        }
+        return;
+    }
+
+    decode_glyph(static_cast<std::uint8_t>(c) - first, dst, stride, fg, bg);
+}
+
+void packed_font::decode_glyph(std::uint32_t glyph, std::uint16_t *dst, std::uint32_t stride,
+                               std::uint16_t fg, std::uint16_t bg) const {
+    const auto &box = boxes[box_indices[glyph]];
+    if (box.width == 0) {
+        for (std::uint32_t row = 0; row < height; ++row, dst += stride) {
+            std::fill_n(dst, width, bg);
+        }
+        return;
+    }
+
+    const std::uint32_t box_bottom = box.y + box.height;
+    const std::uint32_t right_margin = width - box.x - box.width;
+
+    /* Left-aligned bit reservoir, holding at most 31 bits; a box row is at most 24 */
+    const auto *src = &bits[offsets[glyph] / 8U];
+    const std::uint32_t skip = offsets[glyph] % 8U;
+    std::uint32_t reservoir = static_cast<std::uint32_t>(*src++) << (24U + skip);
+    std::uint32_t available = 8U - skip;
+
+    for (std::uint32_t row = 0; row < height; ++row, dst += stride) {
+        if (row < box.y || row >= box_bottom) {
+            std::fill_n(dst, width, bg);
+            continue;
+        }
+
+        while (available < box.width) {
+            reservoir |= static_cast<std::uint32_t>(*src++) << (24U - available);
+            available += 8U;
+        }
+
+        auto *pixel = std::fill_n(dst, box.x, bg);
+        for (std::uint32_t i = 0; i < box.width; ++i) {
+            *pixel++ = (reservoir & 0x80000000U) ? fg : bg;
+            reservoir <<= 1;
+        }
+        available -= box.width;
+        std::fill_n(pixel, right_margin, bg);
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * packed_font.h
+ *
+ * A compact font format for the fixed-width ST fonts. The sFONT tables in Utilities/Fonts store
+ * every cell in full, each row padded to whole bytes; a packed font stores only the pixels in each
+ * glyph's ink box, bit-packed back to back, plus where the box sits in the cell. Everything
+ * outside the box is background.
+ *
+ * The tables are generated from the sFONT tables by Host/font_pack (see font_pack.c), into
+ * packed_fonts.cpp.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/** A glyph's ink box: where it sits in the cell, and its size (0 for a glyph with no ink). */
+struct packed_box {
+    std::uint8_t x;
+    std::uint8_t y;
+    std::uint8_t width;
+    std::uint8_t height;
+};
+
+struct packed_font {
+    /** Per glyph, the bit in bits its box starts at. Box rows run on without padding, MSB first. */
+    const std::uint16_t *offsets;
+    /** Per glyph, its box in boxes. Glyphs mostly share a few dozen boxes. */
+    const std::uint8_t *box_indices;
+    const packed_box *boxes;
+    const std::uint8_t *bits;
+    /** Size of bits, in bytes, and number of boxes. */
+    std::uint16_t bits_size;
+    std::uint16_t box_count;
+    /** Cell size, the same as the sFONT it came from. */
+    std::uint16_t width;
+    std::uint16_t height;
+    /** Character of the first glyph, and the number of glyphs. */
+    std::uint8_t first;
+    std::uint16_t count;
+
+    /** Whether the font has a glyph for a character. */
+    constexpr bool contains(char c) const {
+        const auto index = static_cast<std::uint8_t>(c) - first;
+        return index >= 0 && index < count;
+    }
+
+    /** Flash taken by the tables, in bytes. */
+    constexpr std::size_t size() const {
+        return count * (sizeof(*offsets) + sizeof(*box_indices)) +
+               box_count * sizeof(packed_box) + bits_size;
+    }
+
+    /**
+     * Expands a whole cell to RGB565. Characters outside the font are drawn as blank cells.
+     *
+     * @param[out] dst    the top-left pixel of the cell.
+     * @param      stride pixels from one row of dst to the next.
+     */
+    void decode(char c, std::uint16_t *dst, std::uint32_t stride,
+                std::uint16_t fg, std::uint16_t bg) const;
+
+    /** As decode(), by glyph number rather than character. glyph must be below count. */
+    void decode_glyph(std::uint32_t glyph, std::uint16_t *dst, std::uint32_t stride,
+                      std::uint16_t fg, std::uint16_t bg) const;
+};
+
+/** Font8 to Font24, packed. */
+extern const packed_font PackedFont8;
+extern const packed_font PackedFont12;
+extern const packed_font PackedFont16;
+extern const packed_font PackedFont20;
+extern const packed_font PackedFont24;
@@ -0,0 +1,518 @@
+/*
+ * packed_fonts.cpp
+ *
+ * Font8 to Font24 as packed fonts. Generated by Host/font_pack; don't edit.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "packed_font.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Font8
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::uint16_t g_font8_offsets[] = {
+        0,     0,     6,    12,    47,    68,    92,   112,   115,   129,   143,   155,
+      180,   186,   189,   190,   218,   236,   266,   284,   302,   326,   344,   362,
+      380,   398,   416,   420,   428,   448,   457,   477,   495,   523,   553,   583,
+      601,   631,   661,   691,   715,   745,   763,   787,   817,   847,   877,   907,
+      931,   961,   989,  1019,  1037,  1067,  1097,  1127,  1157,  1187,  1217,  1241,
+     1255,  1283,  1297,  1306,  1311,  1315,  1331,  1361,  1373,  1397,  1409,  1427,
+     1451,  1481,  1499,  1523,  1553,  1571,  1591,  1611,  1627,  1657,  1681,  1697,
+     1709,  1734,  1754,  1774,  1794,  1810,  1840,  1856,  1877,  1884,  1905,
+};
+
+static const std::uint8_t g_font8_box_indices[] = {
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  16,  16,   5,  16,  16,  16,  16,  16,  18,  19,  20,  21,   6,  16,
+     22,  17,  17,  16,  17,  17,  17,   5,  17,  16,   5,  17,  17,  17,  17,   5,
+     17,  22,  17,  16,  17,  17,  17,  17,  17,  17,   5,   8,  15,   9,  23,  24,
+     25,  26,  17,  27,   5,  27,  16,  28,  17,  16,  29,  17,  16,  30,  30,  26,
+     31,  28,  26,  27,  11,  30,  30,  30,  26,  31,  26,   4,  32,   4,  33,
+};
+
+static const packed_box g_font8_boxes[] = {
+    {  0,  0,  0,  0 }, {  2,  0,  1,  6 }, {  1,  0,  3,  2 }, {  0,  0,  5,  7 },
+    {  1,  0,  3,  7 }, {  1,  0,  4,  6 }, {  1,  1,  4,  5 }, {  2,  0,  1,  3 },
+    {  2,  0,  2,  7 }, {  1,  0,  2,  7 }, {  1,  0,  3,  4 }, {  0,  1,  5,  5 },
+    {  2,  4,  2,  3 }, {  1,  3,  3,  1 }, {  2,  5,  1,  1 }, {  0,  0,  4,  7 },
+    {  1,  0,  3,  6 }, {  0,  0,  5,  6 }, {  2,  2,  1,  4 }, {  2,  2,  2,  4 },
+    {  0,  1,  4,  5 }, {  1,  1,  3,  3 }, {  1,  0,  4,  7 }, {  1,  0,  3,  3 },
+    {  0,  7,  5,  1 }, {  2,  0,  2,  2 }, {  1,  2,  4,  4 }, {  1,  2,  3,  4 },
+    {  1,  2,  4,  6 }, {  1,  0,  3,  8 }, {  0,  2,  5,  4 }, {  0,  2,  5,  6 },
+    {  2,  0,  1,  7 }, {  1,  3,  4,  2 },
+};
+
+static const std::uint8_t g_font8_bits[] = {
+    0xF6, 0xD2, 0xAB, 0xEA, 0xFA, 0xA8, 0x9E, 0x67, 0x24, 0x43, 0xC2, 0x27, 0x4C, 0xAF, 0xED, 0x54,
+    0xCA, 0xAC, 0xBA, 0xA4, 0x27, 0xC8, 0x46, 0xBC, 0x48, 0x89, 0x12, 0x15, 0xB6, 0xA6, 0x10, 0x84,
+    0x27, 0xD5, 0x4A, 0x75, 0x4A, 0x38, 0x9A, 0xBC, 0x9F, 0xCC, 0x6A, 0x73, 0x5B, 0xBD, 0x29, 0x25,
+    0x55, 0xA9, 0xDA, 0xCE, 0x94, 0x61, 0x2C, 0x21, 0xE3, 0xC2, 0x1A, 0x42, 0xA5, 0x04, 0xD3, 0x37,
+    0x30, 0xEC, 0x22, 0x9D, 0x1D, 0xF9, 0x2E, 0x4A, 0x7D, 0xEC, 0x91, 0xF9, 0x29, 0x4A, 0x7D, 0xF4,
+    0xB1, 0x09, 0xFF, 0xD2, 0xC4, 0x23, 0x9D, 0x11, 0x74, 0xDD, 0x4B, 0xD2, 0x9E, 0xF4, 0x92, 0xEE,
+    0x45, 0x54, 0x9B, 0x53, 0x1C, 0xAD, 0xF1, 0x08, 0x42, 0x7F, 0xBD, 0xEE, 0xB1, 0xDE, 0xDA, 0xD5,
+    0xAF, 0xAD, 0x33, 0x32, 0xDE, 0x4A, 0x5C, 0x8E, 0x34, 0xCC, 0xCB, 0x1F, 0x92, 0x97, 0x27, 0xBE,
+    0xA3, 0x7F, 0xEA, 0x42, 0x11, 0xDB, 0x4A, 0x52, 0x93, 0x6E, 0x29, 0x52, 0x8D, 0xB8, 0xD6, 0xB5,
+    0x56, 0xD4, 0x42, 0x2B, 0x7B, 0x8A, 0x88, 0x47, 0x7C, 0x92, 0x4F, 0xF5, 0x57, 0x08, 0x84, 0x44,
+    0x3A, 0xAB, 0xA5, 0x7F, 0x2C, 0x5D, 0xF8, 0x43, 0x92, 0x9F, 0x79, 0x39, 0x8B, 0xCC, 0xBF, 0xF1,
+    0x95, 0xD2, 0xEF, 0x32, 0xE2, 0xD8, 0x43, 0x92, 0x9E, 0xA1, 0x92, 0xE8, 0x72, 0x49, 0xF8, 0x42,
+    0xDC, 0xAD, 0xE4, 0x92, 0xFA, 0xAD, 0x6B, 0xE4, 0xA7, 0x2D, 0x32, 0xDE, 0x4A, 0x5C, 0x8E, 0x3C,
+    0xCB, 0x89, 0xFA, 0x27, 0x34, 0x72, 0x3C, 0x84, 0x9B, 0x69, 0x49, 0xF2, 0x93, 0x1B, 0x75, 0xAA,
+    0xA5, 0x9A, 0x76, 0xA5, 0x10, 0x8C, 0xFA, 0x5F, 0x29, 0x64, 0x8F, 0xF8, 0x93, 0x4A, 0x2D, 0x00,
+};
+
+const packed_font PackedFont8 {
+    g_font8_offsets, g_font8_box_indices, g_font8_boxes, g_font8_bits,
+    sizeof(g_font8_bits), 34, 5, 8, ' ', 95,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Font12
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::uint16_t g_font12_offsets[] = {
+        0,     0,     8,    23,    68,   104,   144,   174,   178,   198,   218,   243,
+      292,   304,   309,   313,   358,   398,   438,   478,   518,   566,   606,   646,
+      686,   726,   766,   778,   799,   841,   856,   898,   926,   976,  1032,  1080,
+     1120,  1168,  1216,  1264,  1312,  1368,  1408,  1448,  1504,  1544,  1600,  1656,
+     1696,  1736,  1781,  1837,  1877,  1933,  1989,  2045,  2101,  2157,  2213,  2253,
+     2283,  2319,  2349,  2369,  2376,  2380,  2416,  2464,  2494,  2542,  2572,  2612,
+     2660,  2716,  2756,  2796,  2844,  2884,  2926,  2968,  2998,  3046,  3094,  3124,
+     3154,  3196,  3238,  3280,  3322,  3358,  3414,  3444,  3474,  3483,  3513,
+};
+
+static const std::uint8_t g_font12_box_indices[] = {
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,   3,
+      5,   5,   5,   5,  15,   5,   5,   5,   5,   5,  16,  17,  18,  19,  18,  20,
+     21,  22,  23,   5,  23,  23,  15,  15,  22,   5,   5,  22,   5,  22,  22,   5,
+      5,   3,  22,   5,  22,  22,  22,  22,  22,  22,   5,  24,   4,  24,  25,  26,
+     27,  28,  23,   6,  15,   6,   5,  29,  22,   5,  30,  23,   5,  31,  31,   6,
+     32,  29,   6,   6,  33,  31,  31,  31,  34,  35,   6,  24,  36,  24,  37,
+};
+
+static const packed_box g_font12_boxes[] = {
+    {  0,  0,  0,  0 }, {  3,  1,  1,  8 }, {  1,  1,  5,  3 }, {  1,  1,  5,  9 },
+    {  1,  1,  4,  9 }, {  1,  1,  5,  8 }, {  1,  3,  5,  6 }, {  3,  1,  1,  4 },
+    {  3,  1,  2, 10 }, {  2,  1,  2, 10 }, {  1,  1,  5,  5 }, {  0,  2,  7,  7 },
+    {  2,  7,  3,  4 }, {  1,  5,  5,  1 }, {  2,  7,  2,  2 }, {  1,  1,  6,  8 },
+    {  2,  3,  2,  6 }, {  2,  3,  3,  7 }, {  0,  2,  6,  7 }, {  1,  4,  5,  3 },
+    {  2,  2,  4,  7 }, {  1,  0,  5, 10 }, {  0,  1,  7,  8 }, {  0,  1,  6,  8 },
+    {  2,  1,  3, 10 }, {  1,  1,  5,  4 }, {  0, 11,  7,  1 }, {  3,  1,  2,  2 },
+    {  1,  3,  6,  6 }, {  1,  3,  6,  8 }, {  1,  1,  4, 10 }, {  0,  3,  7,  6 },
+    {  0,  3,  6,  8 }, {  1,  2,  6,  7 }, {  0,  3,  6,  6 }, {  0,  3,  7,  8 },
+    {  3,  1,  1,  9 }, {  1,  5,  5,  2 },
+};
+
+static const std::uint8_t g_font12_bits[] = {
+    0xF9, 0xDC, 0xA4, 0x52, 0xAB, 0xEA, 0xFA, 0xA9, 0x42, 0x78, 0x87, 0x9E, 0x22, 0x45, 0x10, 0x3E,
+    0x08, 0xA2, 0x32, 0x11, 0x59, 0x37, 0xD6, 0xAA, 0x96, 0x95, 0x56, 0x89, 0xF2, 0x29, 0x42, 0x04,
+    0x08, 0xFE, 0x20, 0x40, 0x86, 0xB4, 0xFF, 0x84, 0x22, 0x11, 0x08, 0x84, 0x41, 0xD1, 0x8C, 0x63,
+    0x18, 0xB9, 0x84, 0x21, 0x08, 0x42, 0x7D, 0xD1, 0x08, 0x88, 0x88, 0xFD, 0xD1, 0x09, 0x82, 0x18,
+    0xB8, 0x62, 0x8A, 0x4A, 0x2F, 0xC2, 0x1D, 0xE8, 0x43, 0x82, 0x18, 0xB8, 0xE8, 0x87, 0xA3, 0x18,
+    0xBB, 0xF1, 0x08, 0x84, 0x22, 0x11, 0xD1, 0x8B, 0xA3, 0x18, 0xB9, 0xD1, 0x8C, 0x5E, 0x11, 0x73,
+    0xC3, 0xDB, 0x01, 0xE8, 0x18, 0x8C, 0x40, 0xC0, 0x81, 0xFC, 0x1F, 0xC0, 0x81, 0x81, 0x18, 0x8C,
+    0x1A, 0x44, 0x90, 0x31, 0xD1, 0x8C, 0xEB, 0x59, 0xC2, 0x2E, 0x30, 0x20, 0xA1, 0x42, 0x8F, 0x91,
+    0x77, 0xF9, 0x14, 0x5E, 0x45, 0x14, 0x7E, 0x7C, 0x61, 0x08, 0x42, 0x2E, 0xF1, 0x24, 0x51, 0x45,
+    0x14, 0xBC, 0xFD, 0x15, 0x1C, 0x51, 0x04, 0x7F, 0xFD, 0x15, 0x1C, 0x51, 0x04, 0x38, 0x7A, 0x28,
+    0x20, 0x9E, 0x28, 0x9C, 0xEE, 0x89, 0x13, 0xE4, 0x48, 0x91, 0x77, 0xF9, 0x08, 0x42, 0x10, 0x9F,
+    0x78, 0x84, 0x29, 0x4A, 0x4C, 0xEE, 0x89, 0x22, 0x87, 0x09, 0x11, 0x73, 0xE2, 0x10, 0x84, 0x25,
+    0x3F, 0xEE, 0xD9, 0xB2, 0xA5, 0x48, 0x91, 0x77, 0xEE, 0xC9, 0x92, 0xA5, 0x4A, 0x93, 0x76, 0x74,
+    0x63, 0x18, 0xC6, 0x2E, 0xF2, 0x52, 0x97, 0x21, 0x1C, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x3F, 0xC4,
+    0x48, 0x91, 0x3C, 0x48, 0x8B, 0x8B, 0x67, 0x07, 0x04, 0x39, 0xB7, 0xF9, 0x22, 0x04, 0x08, 0x10,
+    0x20, 0xE7, 0x74, 0x48, 0x91, 0x22, 0x44, 0x88, 0xE7, 0x74, 0x48, 0x8A, 0x14, 0x28, 0x20, 0x47,
+    0x74, 0x48, 0x95, 0x2A, 0x54, 0xA8, 0xA6, 0x34, 0x45, 0x04, 0x08, 0x28, 0x8B, 0x1F, 0x74, 0x45,
+    0x0A, 0x08, 0x10, 0x20, 0xE7, 0xE2, 0x22, 0x11, 0x11, 0xFF, 0x92, 0x49, 0x24, 0xF0, 0x88, 0x84,
+    0x42, 0x23, 0xC9, 0x24, 0x92, 0x79, 0x08, 0xA8, 0xFF, 0x97, 0x22, 0x7A, 0x28, 0x9F, 0xC1, 0x05,
+    0x99, 0x45, 0x14, 0x7E, 0x7C, 0x61, 0x08, 0xB8, 0x60, 0x9A, 0x9A, 0x28, 0xA2, 0x7D, 0xD1, 0xFC,
+    0x20, 0xF3, 0xA3, 0xE8, 0x42, 0x11, 0xF6, 0xE6, 0x8A, 0x28, 0x9E, 0x09, 0xCC, 0x08, 0x16, 0x32,
+    0x44, 0x89, 0x17, 0x72, 0x03, 0x84, 0x21, 0x09, 0xF2, 0x0F, 0x11, 0x11, 0x11, 0xEC, 0x10, 0x5D,
+    0x27, 0x14, 0x4B, 0x76, 0x10, 0x84, 0x21, 0x09, 0xFE, 0x8A, 0x95, 0x2A, 0x55, 0xFF, 0x63, 0x24,
+    0x48, 0x91, 0x77, 0x74, 0x63, 0x18, 0xBB, 0x66, 0x51, 0x45, 0x17, 0x90, 0xE1, 0xB9, 0xA2, 0x8A,
+    0x27, 0x82, 0x1F, 0x6C, 0x42, 0x11, 0xF7, 0xC5, 0xC1, 0x8F, 0x90, 0xF9, 0x04, 0x10, 0x44, 0xEC,
+    0xC8, 0x91, 0x22, 0x4C, 0x6F, 0xBA, 0x24, 0x45, 0x0A, 0x08, 0xEE, 0x89, 0x52, 0xA5, 0x45, 0x33,
+    0x48, 0xC3, 0x12, 0xCF, 0xBA, 0x22, 0x45, 0x06, 0x08, 0x10, 0xF3, 0xF2, 0x22, 0x23, 0xF2, 0x92,
+    0x51, 0x24, 0x7F, 0xF1, 0x24, 0x8A, 0x4A, 0x26, 0xC0,
+};
+
+const packed_font PackedFont12 {
+    g_font12_offsets, g_font12_box_indices, g_font12_boxes, g_font12_bits,
+    sizeof(g_font12_bits), 38, 7, 12, ' ', 95,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Font16
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::uint16_t g_font16_offsets[] = {
+        0,     0,    20,    55,   143,   234,   314,   377,   392,   440,   488,   544,
+      593,   608,   615,   619,   723,   793,   873,   943,  1023,  1093,  1163,  1233,
+     1303,  1373,  1443,  1457,  1493,  1574,  1601,  1682,  1745,  1811,  1901,  1973,
+     2054,  2135,  2207,  2288,  2369,  2450,  2522,  2603,  2684,  2765,  2864,  2945,
+     3026,  3098,  3197,  3287,  3350,  3422,  3503,  3584,  3683,  3764,  3854,  3917,
+     3965,  4069,  4117,  4159,  4170,  4179,  4235,  4325,  4381,  4471,  4534,  4624,
+     4714,  4804,  4884,  4962,  5052,  5132,  5202,  5265,  5328,  5418,  5508,  5571,
+     5620,  5700,  5763,  5826,  5903,  5966,  6066,  6115,  6163,  6187,  6235,
+};
+
+static const std::uint8_t g_font16_box_indices[] = {
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,   5,  16,  17,  16,  16,  16,  18,  16,  16,  19,  20,  21,  22,  21,   6,
+     23,  24,  25,  21,  21,  25,  21,  21,  21,  26,  21,  21,  21,  27,  21,  21,
+     25,  28,  24,   6,  25,  21,  21,  27,  21,  24,   6,  29,  15,   9,  30,  31,
+     32,  33,  34,  35,  34,  36,  37,  38,  34,   5,  39,  34,   5,  40,  36,  36,
+     38,  38,  36,  41,  17,  36,  36,  42,  36,  43,  41,   9,  44,   8,  45,
+};
+
+static const packed_box g_font16_boxes[] = {
+    {  0,  0,  0,  0 }, {  4,  1,  2, 10 }, {  3,  2,  7,  5 }, {  2,  1,  8, 11 },
+    {  2,  0,  7, 13 }, {  2,  1,  8, 10 }, {  2,  2,  7,  9 }, {  5,  2,  3,  5 },
+    {  4,  1,  4, 12 }, {  3,  1,  4, 12 }, {  2,  1,  8,  7 }, {  2,  3,  7,  7 },
+    {  4,  9,  3,  5 }, {  2,  6,  7,  1 }, {  4,  9,  2,  2 }, {  2,  0,  8, 13 },
+    {  2,  1,  7, 10 }, {  1,  1,  8, 10 }, {  1,  1,  7, 10 }, {  4,  4,  2,  7 },
+    {  4,  4,  4,  9 }, {  1,  2,  9,  9 }, {  1,  5,  9,  3 }, {  2,  1,  6, 11 },
+    {  1,  2, 10,  9 }, {  1,  2,  8,  9 }, {  2,  2,  8,  9 }, {  0,  2, 11,  9 },
+    {  1,  2,  9, 11 }, {  5,  1,  4, 12 }, {  2,  0,  7,  6 }, {  0, 15, 11,  1 },
+    {  4,  0,  3,  3 }, {  2,  4,  8,  7 }, {  1,  1,  9, 10 }, {  1,  4,  8,  7 },
+    {  1,  4,  9,  7 }, {  2,  1,  9, 10 }, {  1,  4,  9, 10 }, {  2,  1,  6, 13 },
+    {  1,  4, 10,  7 }, {  2,  4,  7,  7 }, {  0,  4, 11,  7 }, {  1,  4, 10, 10 },
+    {  5,  1,  2, 12 }, {  2,  5,  7,  3 },
+};
+
+static const std::uint8_t g_font16_bits[] = {
+    0xFF, 0xFF, 0x3E, 0xFD, 0xD1, 0x22, 0x44, 0x6C, 0x6C, 0x6C, 0x6D, 0xFE, 0xD9, 0xFE, 0xD8, 0xD8,
+    0xD8, 0xD8, 0x21, 0xFE, 0x3C, 0x7C, 0x1E, 0x1E, 0x0F, 0x8F, 0x1F, 0xE1, 0x02, 0x18, 0x24, 0x24,
+    0x18, 0xC7, 0x9E, 0x31, 0x82, 0x42, 0x41, 0x8F, 0x30, 0x60, 0xC0, 0xC3, 0xBD, 0xD9, 0x9D, 0xFE,
+    0x92, 0x33, 0x6E, 0xCC, 0xCC, 0xE6, 0x33, 0xCC, 0x63, 0x33, 0x33, 0x36, 0xEC, 0x18, 0x18, 0xFF,
+    0xFF, 0x3C, 0x7E, 0x66, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x35, 0xA4, 0xFF, 0xE0, 0x60, 0x60,
+    0xC0, 0xC1, 0x81, 0x83, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x07, 0x1B, 0x63, 0xC7, 0x8F, 0x1E,
+    0x3C, 0x6D, 0x8E, 0x0C, 0x7C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x7F, 0x9E, 0x67, 0x8F,
+    0x18, 0x61, 0x86, 0x18, 0x60, 0xFE, 0xFD, 0x86, 0x06, 0x0C, 0x7C, 0x0E, 0x06, 0x07, 0x86, 0xFC,
+    0x38, 0x71, 0xE2, 0xCD, 0x93, 0x66, 0xFE, 0x18, 0xFB, 0xF6, 0x0C, 0x18, 0x3E, 0x46, 0x0C, 0x1C,
+    0x37, 0xC3, 0xDC, 0x30, 0xC1, 0xBB, 0x9E, 0x3C, 0x6C, 0xCF, 0x7F, 0x86, 0x0C, 0x30, 0x60, 0xC1,
+    0x86, 0x0C, 0x18, 0xFB, 0x1E, 0x3C, 0x6F, 0xB1, 0xE3, 0xC7, 0x8D, 0xF3, 0xCC, 0xD8, 0xF1, 0xE7,
+    0x76, 0x0C, 0x30, 0xEF, 0x1E, 0x07, 0x99, 0x80, 0x03, 0x24, 0x40, 0x0C, 0x18, 0x10, 0x30, 0x60,
+    0x0C, 0x01, 0x00, 0x60, 0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x0C, 0x01, 0x00, 0x60, 0x0C, 0x18, 0x10,
+    0x30, 0x60, 0x1F, 0x63, 0xC6, 0x0C, 0x71, 0x83, 0x00, 0x0C, 0x1C, 0x8C, 0x30, 0xCF, 0x4D, 0x33,
+    0xC0, 0x89, 0xCF, 0xC0, 0xF0, 0x24, 0x19, 0x86, 0x61, 0xF8, 0xC3, 0x30, 0xDE, 0x7F, 0xF3, 0x1B,
+    0x1B, 0x1B, 0xF3, 0x1B, 0x1B, 0x1F, 0xF1, 0xF5, 0x87, 0x81, 0xC0, 0x60, 0x30, 0x18, 0x16, 0x11,
+    0xF3, 0xF8, 0xC6, 0x61, 0xB0, 0xD8, 0x6C, 0x36, 0x1B, 0x1B, 0xF9, 0xFE, 0xC2, 0xC2, 0xC8, 0xF8,
+    0xC8, 0xC2, 0xC3, 0xFF, 0xFF, 0x60, 0xB0, 0x59, 0x0F, 0x86, 0x43, 0x01, 0x81, 0xF0, 0x3D, 0x31,
+    0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6, 0x3E, 0x7B, 0xD8, 0xCC, 0x66, 0x33, 0xF9, 0x8C, 0xC6,
+    0x63, 0x7B, 0xFF, 0xC6, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x3F, 0xCF, 0xE0, 0xC0, 0x60, 0x30,
+    0x19, 0x8C, 0xC6, 0x63, 0x1F, 0x1E, 0xF6, 0x33, 0x31, 0xB0, 0xF0, 0x7C, 0x33, 0x18, 0xDE, 0x7F,
+    0xC1, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x4C, 0x26, 0x1F, 0xFF, 0x07, 0x60, 0xCE, 0x39, 0xEF, 0x35,
+    0x66, 0xEC, 0xC9, 0x98, 0x37, 0xDF, 0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C, 0xC6, 0xF3,
+    0x1F, 0x18, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0x63, 0x1F, 0x3F, 0x98, 0xD8, 0xD8, 0xD8, 0xDF,
+    0x98, 0x18, 0x3F, 0x0F, 0x8C, 0x6C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xB1, 0x8F, 0x83, 0x33, 0xF7,
+    0xF0, 0xC6, 0x31, 0x8C, 0x63, 0xE0, 0xCC, 0x31, 0x8C, 0x67, 0xCE, 0xFF, 0x1E, 0x3E, 0x0F, 0x83,
+    0xE3, 0xC7, 0xFB, 0xFE, 0x66, 0x66, 0x64, 0x60, 0x60, 0x60, 0x61, 0xFB, 0xDE, 0xC6, 0x63, 0x31,
+    0x98, 0xCC, 0x66, 0x33, 0x18, 0xF9, 0xEF, 0x63, 0x31, 0x8D, 0x86, 0xC3, 0x60, 0xA0, 0x70, 0x38,
+    0xFB, 0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E, 0xE1, 0xDC, 0x31, 0x9E, 0xF6, 0x31, 0xB0,
+    0x70, 0x38, 0x1C, 0x1B, 0x18, 0xDE, 0xFF, 0x3D, 0x86, 0x33, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03,
+    0x03, 0xF3, 0xFC, 0x38, 0xC3, 0x04, 0x18, 0x63, 0x87, 0xFF, 0xE6, 0x66, 0x66, 0x66, 0x66, 0x7E,
+    0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x1F, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0xF8, 0x82, 0x85, 0x11, 0x41, 0x83, 0xFF, 0xE2, 0x2F, 0x80, 0xC0, 0xCF, 0xD8, 0xD9,
+    0xCE, 0xFC, 0x06, 0x03, 0x01, 0xB8, 0xE6, 0x61, 0xB0, 0xD8, 0x6E, 0x6E, 0xE1, 0xEB, 0x1E, 0x0E,
+    0x06, 0x0B, 0x19, 0xF0, 0x38, 0x0C, 0x06, 0x3B, 0x33, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEE, 0x7C,
+    0x63, 0x60, 0xFF, 0xF8, 0x06, 0x19, 0xF8, 0x7E, 0x60, 0x30, 0x7F, 0x0C, 0x06, 0x03, 0x01, 0x80,
+    0xC1, 0xFC, 0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x1F, 0x38, 0x0C, 0x06,
+    0x03, 0x71, 0xCC, 0xC6, 0x63, 0x31, 0x98, 0xDE, 0xF1, 0x81, 0x80, 0x07, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x8F, 0xF1, 0x86, 0x03, 0xF0, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x3F, 0xB8, 0x0C, 0x06, 0x03,
+    0x79, 0xB0, 0xF0, 0x78, 0x36, 0x19, 0x9D, 0xF7, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x8F, 0xFF, 0xF1, 0xB6, 0x6D, 0x9B, 0x66, 0xD9, 0xB6, 0xED, 0xFB, 0x8E, 0x66, 0x33, 0x19, 0x8C,
+    0xC6, 0xF7, 0x9F, 0x18, 0xD8, 0x3C, 0x1E, 0x0D, 0x8C, 0x7C, 0xEE, 0x39, 0x98, 0x6C, 0x36, 0x1B,
+    0x99, 0xB8, 0xC0, 0x60, 0x7C, 0x0E, 0xEC, 0xEC, 0x36, 0x1B, 0x0C, 0xCE, 0x3B, 0x01, 0x80, 0xC1,
+    0xFF, 0x71, 0xCC, 0xC0, 0x60, 0x30, 0x18, 0x3F, 0x8F, 0xF1, 0xF8, 0x7C, 0x1F, 0x1F, 0xE3, 0x03,
+    0x03, 0x0F, 0xE3, 0x03, 0x03, 0x03, 0x03, 0x11, 0xEE, 0x73, 0x19, 0x8C, 0xC6, 0x63, 0x33, 0x8E,
+    0xFE, 0xF6, 0x33, 0x18, 0xD8, 0x6C, 0x1C, 0x0E, 0x3C, 0x7B, 0x06, 0x64, 0xCD, 0xD8, 0xEE, 0x1D,
+    0xC3, 0x19, 0xEF, 0x36, 0x0E, 0x07, 0x03, 0x83, 0x67, 0xBF, 0xCF, 0x61, 0x8C, 0xC3, 0x30, 0x58,
+    0x1E, 0x03, 0x00, 0xC0, 0x60, 0x7C, 0x3F, 0xC3, 0x0C, 0x71, 0x86, 0x1F, 0xE6, 0xCC, 0xCC, 0xD8,
+    0xCC, 0xCC, 0x7F, 0xFF, 0xFF, 0xF8, 0xCC, 0xCC, 0xC6, 0xCC, 0xCD, 0x8C, 0x24, 0x86,
+};
+
+const packed_font PackedFont16 {
+    g_font16_offsets, g_font16_box_indices, g_font16_boxes, g_font16_bits,
+    sizeof(g_font16_bits), 46, 11, 16, ' ', 95,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Font20
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::uint16_t g_font20_offsets[] = {
+        0,     0,    39,    87,   247,   375,   492,   591,   609,   673,   737,   809,
+      909,   933,   951,   960,  1088,  1205,  1309,  1426,  1556,  1673,  1790,  1907,
+     2024,  2141,  2258,  2285,  2340,  2461,  2527,  2648,  2744,  2842,  2986,  3106,
+     3226,  3358,  3478,  3598,  3730,  3850,  3946,  4078,  4210,  4330,  4474,  4594,
+     4714,  4834,  4984,  5116,  5236,  5356,  5476,  5608,  5764,  5896,  6016,  6112,
+     6176,  6304,  6368,  6422,  6450,  6462,  6552,  6695,  6785,  6928,  7018,  7135,
+     7278,  7408,  7512,  7648,  7778,  7882,  7990,  8080,  8170,  8313,  8456,  8546,
+     8618,  8738,  8828,  8927,  9026,  9116,  9259,  9331,  9427,  9459,  9555,
+};
+
+static const std::uint8_t g_font20_box_indices[] = {
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,   4,
+      5,  15,   5,  16,   5,   5,   5,   5,   5,   5,  17,  18,  19,  20,  21,  22,
+     23,  24,  25,  25,  26,  25,  25,  27,  25,  22,  27,  27,  25,  24,  25,  25,
+     25,  28,  27,  25,  25,  25,  26,  29,  26,  25,  22,   8,   4,   9,  30,  31,
+     32,  33,  34,  33,  35,  33,  36,  37,  38,  15,  39,  38,  15,  40,  33,  33,
+     41,  37,  33,  42,  25,  33,  43,  43,  33,  41,  42,  44,  45,  46,  47,
+};
+
+static const packed_box g_font20_boxes[] = {
+    {  0,  0,  0,  0 }, {  5,  1,  3, 13 }, {  3,  2,  8,  6 }, {  2,  0, 10, 16 },
+    {  3,  0,  8, 16 }, {  2,  1,  9, 13 }, {  3,  3,  9, 11 }, {  6,  2,  3,  6 },
+    {  6,  1,  4, 16 }, {  4,  1,  4, 16 }, {  3,  1,  8,  9 }, {  2,  3, 10, 10 },
+    {  5, 11,  4,  6 }, {  2,  7,  9,  2 }, {  6, 11,  3,  3 }, {  3,  1,  8, 13 },
+    {  1,  1, 10, 13 }, {  6,  5,  3,  9 }, {  5,  5,  5, 11 }, {  1,  3, 11, 11 },
+    {  1,  5, 11,  6 }, {  2,  3, 11, 11 }, {  3,  2,  8, 12 }, {  3,  1,  7, 14 },
+    {  1,  2, 12, 12 }, {  2,  2, 10, 12 }, {  1,  2, 11, 12 }, {  2,  2, 11, 12 },
+    {  2,  2, 10, 15 }, {  1,  2, 13, 12 }, {  2,  1,  9,  6 }, {  0, 18, 14,  2 },
+    {  5,  1,  4,  3 }, {  2,  5, 10,  9 }, {  1,  1, 11, 13 }, {  2,  1, 11, 13 },
+    {  3,  1,  9, 13 }, {  2,  5, 11, 13 }, {  2,  1, 10, 13 }, {  2,  1,  8, 17 },
+    {  1,  5, 12,  9 }, {  1,  5, 11, 13 }, {  3,  5,  8,  9 }, {  1,  5, 11,  9 },
+    {  4,  1,  6, 16 }, {  6,  1,  2, 16 }, {  3,  1,  6, 16 }, {  2,  6, 10,  4 },
+};
+
+static const std::uint8_t g_font20_bits[] = {
+    0xFF, 0xFF, 0xFA, 0x40, 0x7F, 0xCF, 0xCF, 0xCE, 0x84, 0x84, 0x84, 0x66, 0x19, 0x86, 0x61, 0x98,
+    0x66, 0x7F, 0xFF, 0xF9, 0x98, 0x66, 0x7F, 0xFF, 0xF9, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x30,
+    0x30, 0x7E, 0xFF, 0x87, 0x81, 0xF0, 0xFC, 0x0F, 0x87, 0x87, 0xFD, 0xF8, 0x30, 0x30, 0x30, 0xE0,
+    0x88, 0x44, 0x22, 0x0E, 0x30, 0x79, 0xF3, 0xC1, 0x8E, 0x08, 0x84, 0x42, 0x20, 0xE1, 0xF3, 0xF9,
+    0x80, 0xC0, 0x30, 0x3C, 0xFF, 0xF9, 0xEC, 0x67, 0xFC, 0xF7, 0xFF, 0x49, 0x19, 0xB3, 0x36, 0x66,
+    0x66, 0x63, 0x33, 0x19, 0xE6, 0x33, 0x31, 0x99, 0x99, 0x9B, 0x33, 0x66, 0x0C, 0x0C, 0x0C, 0x6D,
+    0xFF, 0x9E, 0x1E, 0x3F, 0x33, 0x06, 0x01, 0x80, 0x60, 0x18, 0x7F, 0xFF, 0xF8, 0x60, 0x18, 0x06,
+    0x01, 0x83, 0xB3, 0x66, 0x47, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18,
+    0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07,
+    0x83, 0xC1, 0xE0, 0xD8, 0xCF, 0xE3, 0xE0, 0xC7, 0xC7, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC7, 0xFF, 0xF9, 0xF1, 0xFD, 0xC7, 0xC1, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xFF, 0xFF, 0xC7, 0xC7, 0xF9, 0x87, 0x00, 0xC0, 0x70, 0xF8, 0x3E, 0x01, 0xC0, 0x30, 0x0F, 0x07,
+    0xFF, 0x9F, 0xC0, 0x70, 0x78, 0x3C, 0x36, 0x33, 0x19, 0x98, 0xD8, 0x6F, 0xFF, 0xFC, 0x0C, 0x1F,
+    0x0F, 0xBF, 0x9F, 0xCC, 0x06, 0x03, 0xF1, 0xFC, 0xC7, 0x01, 0x80, 0xC0, 0x78, 0x7F, 0xF3, 0xF0,
+    0x3E, 0x7F, 0x78, 0x30, 0x38, 0x1B, 0xCF, 0xF7, 0x1F, 0x07, 0x83, 0x63, 0xBF, 0x87, 0x9F, 0xFF,
+    0xFE, 0x0C, 0x06, 0x06, 0x03, 0x01, 0x81, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x3E, 0x3F, 0xB8,
+    0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8, 0xEF, 0xE3, 0xE1, 0xE1, 0xFD, 0xC6, 0xC1,
+    0xE0, 0xF8, 0xEF, 0xF3, 0xD8, 0x1C, 0x0C, 0x1E, 0xFE, 0x7C, 0x3F, 0xE0, 0x0F, 0xF9, 0xCE, 0x70,
+    0x00, 0x0E, 0x66, 0x31, 0x00, 0x06, 0x03, 0xC1, 0xE0, 0x70, 0x38, 0x1E, 0x00, 0xE0, 0x07, 0x00,
+    0x78, 0x03, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x3C, 0x01, 0xE0,
+    0x0E, 0x00, 0x70, 0x07, 0x81, 0xC0, 0xE0, 0x78, 0x3C, 0x06, 0x00, 0x7C, 0xFE, 0xC3, 0xC3, 0x03,
+    0x0E, 0x1C, 0x18, 0x00, 0x00, 0x38, 0x38, 0x1C, 0xC9, 0x0C, 0x18, 0x31, 0xE4, 0xC9, 0x93, 0x1E,
+    0x02, 0x04, 0x27, 0x8F, 0xC0, 0xFC, 0x01, 0xC0, 0x36, 0x03, 0x60, 0x66, 0x06, 0x30, 0xFF, 0x0F,
+    0xF1, 0x81, 0xBC, 0x3F, 0xC3, 0xFF, 0x8F, 0xF1, 0x86, 0x61, 0x98, 0xE7, 0xF1, 0xFE, 0x61, 0xD8,
+    0x36, 0x0F, 0xFF, 0xFF, 0x87, 0xB3, 0xFD, 0xC7, 0xE0, 0xF0, 0x0C, 0x03, 0x00, 0xC0, 0x38, 0x37,
+    0x1C, 0xFE, 0x1F, 0x3F, 0xC7, 0xFC, 0x61, 0xCC, 0x1D, 0x81, 0xB0, 0x36, 0x06, 0xC0, 0xD8, 0x3B,
+    0x0E, 0xFF, 0x9F, 0xE3, 0xFF, 0xFF, 0xD8, 0x36, 0x0D, 0x98, 0x7E, 0x1F, 0x86, 0x61, 0x83, 0x60,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x36, 0x0D, 0x98, 0x7E, 0x1F, 0x86, 0x61, 0x80, 0x60, 0x3F,
+    0x0F, 0xC0, 0x7B, 0x3F, 0xE6, 0x1D, 0x81, 0xB0, 0x06, 0x00, 0xC7, 0xF8, 0xFF, 0x03, 0x30, 0x67,
+    0xFC, 0x3E, 0x3C, 0xFF, 0x3D, 0x86, 0x61, 0x98, 0x67, 0xF9, 0xFE, 0x61, 0x98, 0x66, 0x1B, 0xCF,
+    0xF3, 0xFF, 0xFF, 0xC6, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x3F, 0xFF, 0xC3, 0xF8, 0x7F,
+    0x01, 0x80, 0x30, 0x06, 0x00, 0xCC, 0x19, 0x83, 0x30, 0x66, 0x1C, 0xFF, 0x07, 0xC3, 0xEF, 0xFD,
+    0xF6, 0x38, 0xCC, 0x1B, 0x03, 0xE0, 0x76, 0x0C, 0x61, 0x8C, 0x30, 0xCF, 0x9F, 0xF1, 0xFF, 0x0F,
+    0xC0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xCC, 0x33, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xC3,
+    0xDC, 0x39, 0xE7, 0x9A, 0x59, 0xBD, 0x9B, 0xD9, 0x99, 0x99, 0x99, 0x81, 0xBE, 0x7F, 0xE7, 0xF9,
+    0xFF, 0x7D, 0xC6, 0x79, 0x9E, 0x66, 0xD9, 0xB6, 0x67, 0x99, 0xE6, 0x3B, 0xEE, 0xF9, 0x87, 0x83,
+    0xF1, 0xCE, 0xE1, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF8, 0x77, 0x38, 0xFC, 0x1E, 0x3F, 0xCF, 0xF9,
+    0x87, 0x60, 0xD8, 0x36, 0x1D, 0xFE, 0x7F, 0x18, 0x06, 0x03, 0xF0, 0xFC, 0x07, 0x83, 0xF1, 0xCE,
+    0xE1, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF8, 0x77, 0x38, 0xFC, 0x1E, 0x07, 0xB3, 0xFC, 0xCE, 0xFF,
+    0x1F, 0xF1, 0x87, 0x30, 0x66, 0x1C, 0xFF, 0x1F, 0xC3, 0x1C, 0x61, 0x8C, 0x3B, 0xE3, 0xFC, 0x33,
+    0xED, 0xFF, 0xE1, 0xF0, 0x3E, 0x01, 0xF8, 0x1F, 0x80, 0x7C, 0x0F, 0x87, 0xFF, 0xB7, 0xCF, 0xFF,
+    0xFF, 0xCC, 0xF3, 0x3C, 0xCC, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x0F, 0xCF, 0x3F, 0xCF,
+    0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0xCE, 0x3F, 0x07, 0x8F, 0x1F, 0xE3, 0xD8,
+    0x33, 0x06, 0x31, 0x86, 0x30, 0x6C, 0x0D, 0x81, 0xB0, 0x1C, 0x03, 0x80, 0x70, 0xF8, 0xFF, 0xC7,
+    0xD8, 0x0C, 0xCE, 0x66, 0x73, 0x33, 0x99, 0xB6, 0xC5, 0xB4, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x60,
+    0xCF, 0x1F, 0xE3, 0xD8, 0x31, 0x8C, 0x1B, 0x01, 0xC0, 0x38, 0x0D, 0x83, 0x18, 0xC1, 0xBC, 0x7F,
+    0x8F, 0xF3, 0xFC, 0xF6, 0x18, 0xCC, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0xFC,
+    0xFF, 0xFF, 0xC3, 0xC6, 0x0C, 0x18, 0x18, 0x30, 0x63, 0xC3, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0xCC,
+    0xCC, 0xCC, 0xCC, 0xFF, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06,
+    0x06, 0x06, 0x03, 0x03, 0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF, 0x08, 0x0E, 0x0D, 0x8C,
+    0x6C, 0x1C, 0x07, 0xFF, 0xFF, 0xFF, 0xE1, 0x84, 0xFC, 0x7F, 0x80, 0x63, 0xF9, 0xFE, 0xE1, 0xB0,
+    0xEF, 0xFD, 0xF7, 0xE0, 0x1C, 0x01, 0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x33, 0x03, 0x60, 0x6C,
+    0x0D, 0xC3, 0x7F, 0xEE, 0xF0, 0x3D, 0xBF, 0xEC, 0x1E, 0x07, 0x80, 0x60, 0x1C, 0x1B, 0xFE, 0x7E,
+    0x00, 0xE0, 0x1C, 0x01, 0x80, 0x30, 0xF6, 0x7F, 0xCC, 0x3B, 0x03, 0x60, 0x6C, 0x0D, 0xC3, 0x9F,
+    0xF8, 0xF7, 0x1E, 0x1F, 0xE6, 0x1B, 0xFF, 0xFF, 0xF0, 0x06, 0x0D, 0xFF, 0x1F, 0x07, 0xE7, 0xF3,
+    0x01, 0x83, 0xFD, 0xFE, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x07, 0xFB, 0xFC, 0x3D, 0xDF, 0xFB, 0x0E,
+    0xC0, 0xD8, 0x1B, 0x03, 0x30, 0xE7, 0xFC, 0x3D, 0x80, 0x30, 0x0E, 0x3F, 0x87, 0xE3, 0x80, 0xE0,
+    0x18, 0x06, 0x01, 0xBC, 0x7F, 0x9C, 0x66, 0x19, 0x86, 0x61, 0x98, 0x6F, 0x3F, 0xCF, 0x18, 0x18,
+    0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x0C, 0x0C, 0x00, 0x00, 0x7F,
+    0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFE, 0xFC, 0xE0, 0x38, 0x06, 0x01,
+    0x80, 0x6F, 0x9B, 0xE6, 0xC1, 0xE0, 0x78, 0x1B, 0x06, 0x63, 0x9F, 0xE7, 0xFE, 0x3E, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x3F, 0xFF, 0xFF, 0x73, 0xFF, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x9B, 0xDD, 0xFD, 0xDF, 0xBC, 0xFF, 0x9C, 0x66, 0x19, 0x86, 0x61, 0x98, 0x6F,
+    0x3F, 0xCF, 0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E, 0x3B, 0xC7, 0xFE,
+    0x70, 0xCC, 0x0D, 0x81, 0xB0, 0x37, 0x0C, 0xFF, 0x9B, 0xC3, 0x00, 0x60, 0x1F, 0x03, 0xE0, 0x0F,
+    0x77, 0xFE, 0xC3, 0xB0, 0x36, 0x06, 0xC0, 0xCC, 0x39, 0xFF, 0x0F, 0x60, 0x0C, 0x01, 0x80, 0xF8,
+    0x1F, 0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x0F, 0xFF, 0xF0, 0xFC,
+    0x1F, 0x83, 0xF0, 0xFF, 0xFF, 0x0C, 0x03, 0x00, 0xC0, 0xFF, 0xBF, 0xE3, 0x00, 0xC0, 0x30, 0x0C,
+    0x03, 0x0C, 0xFF, 0x1F, 0x38, 0xEE, 0x39, 0x86, 0x61, 0x98, 0x66, 0x19, 0x8E, 0x7F, 0xCF, 0x7F,
+    0x1F, 0xE3, 0xD8, 0x31, 0x8C, 0x31, 0x83, 0x60, 0x6C, 0x07, 0x00, 0xE1, 0xE3, 0xFC, 0x7B, 0x26,
+    0x64, 0xCD, 0xF8, 0xEE, 0x1D, 0xC3, 0x18, 0x63, 0x3C, 0xFF, 0x3C, 0xCC, 0x1E, 0x03, 0x01, 0xE0,
+    0xCC, 0xF3, 0xFC, 0xFF, 0x1F, 0xE3, 0xD8, 0x31, 0x8C, 0x31, 0x83, 0x60, 0x7C, 0x07, 0x00, 0xC0,
+    0x18, 0x06, 0x07, 0xF0, 0xFE, 0x1F, 0xFF, 0xF8, 0xC1, 0x83, 0x06, 0x0C, 0x7F, 0xFF, 0xE3, 0x9E,
+    0x61, 0x86, 0x18, 0x63, 0x9C, 0x38, 0x61, 0x86, 0x18, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x78,
+    0x61, 0x86, 0x18, 0x61, 0xC3, 0x9C, 0x61, 0x86, 0x19, 0xE7, 0x07, 0x07, 0xE7, 0x9F, 0x83, 0xC0,
+};
+
+const packed_font PackedFont20 {
+    g_font20_offsets, g_font20_box_indices, g_font20_boxes, g_font20_bits,
+    sizeof(g_font20_bits), 48, 14, 20, ' ', 95,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Font24
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::uint16_t g_font24_offsets[] = {
+        0,     0,    45,   101,   277,   448,   598,   741,   762,   870,   978,  1078,
+     1222,  1257,  1277,  1289,  1489,  1639,  1789,  1954,  2104,  2269,  2434,  2584,
+     2734,  2884,  3034,  3078,  3156,  3338,  3416,  3598,  3724,  3894,  4118,  4300,
+     4468,  4650,  4818,  4986,  5168,  5364,  5504,  5686,  5896,  6078,  6302,  6498,
+     6666,  6834,  7038,  7234,  7374,  7542,  7738,  7948,  8186,  8382,  8578,  8732,
+     8822,  9022,  9112,  9200,  9232,  9252,  9384,  9579,  9711,  9906, 10038, 10218,
+    10426, 10636, 10816, 10996, 11176, 11356, 11532, 11686, 11818, 12026, 12234, 12366,
+    12476, 12656, 12810, 12964, 13107, 13239, 13479, 13589, 13697, 13733, 13841,
+};
+
+static const std::uint8_t g_font24_box_indices[] = {
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+      5,   5,  16,   5,  16,  16,   5,   5,   5,   5,  17,  18,  19,  20,  21,  22,
+     23,  24,  25,  26,  25,  27,  26,  28,  29,  30,  28,  31,  25,  24,  29,  26,
+     26,  32,  29,  30,  26,  29,  31,  33,  29,  29,  34,  35,  15,  36,  37,  38,
+     39,  40,  41,  40,  42,  40,  43,  44,  45,  43,  46,  43,  43,  47,  48,  40,
+     49,  44,  40,  50,  43,  48,  48,  51,  40,  52,  50,  53,  54,  53,  55,
+};
+
+static const packed_box g_font24_boxes[] = {
+    {  0,  0,  0,  0 }, {  6,  2,  3, 15 }, {  4,  3,  8,  7 }, {  2,  2, 11, 16 },
+    {  3,  1,  9, 19 }, {  3,  2, 10, 15 }, {  3,  4, 11, 13 }, {  6,  3,  3,  7 },
+    {  7,  2,  6, 18 }, {  3,  2,  6, 18 }, {  3,  2, 10, 10 }, {  2,  4, 12, 12 },
+    {  6, 14,  5,  7 }, {  3,  9, 10,  2 }, {  6, 14,  4,  3 }, {  3,  0, 10, 20 },
+    {  2,  2, 11, 15 }, {  6,  6,  4, 11 }, {  6,  6,  6, 13 }, {  0,  4, 14, 13 },
+    {  1,  7, 13,  6 }, {  1,  4, 14, 13 }, {  3,  3,  9, 14 }, {  3,  2, 10, 17 },
+    {  0,  3, 16, 14 }, {  1,  3, 13, 14 }, {  2,  3, 12, 14 }, {  1,  3, 12, 14 },
+    {  2,  3, 13, 14 }, {  1,  3, 14, 14 }, {  3,  3, 10, 14 }, {  1,  3, 15, 14 },
+    {  2,  3, 12, 17 }, {  0,  3, 17, 14 }, {  2,  3, 11, 14 }, {  7,  2,  5, 18 },
+    {  4,  2,  5, 18 }, {  3,  1, 11,  8 }, {  0, 22, 16,  2 }, {  6,  1,  5,  4 },
+    {  2,  6, 12, 11 }, {  1,  2, 13, 15 }, {  2,  2, 13, 15 }, {  2,  2, 12, 15 },
+    {  2,  6, 13, 16 }, {  1,  2, 14, 15 }, {  3,  2,  9, 20 }, {  0,  6, 16, 11 },
+    {  1,  6, 14, 11 }, {  1,  6, 13, 16 }, {  3,  6, 10, 11 }, {  1,  6, 13, 11 },
+    {  1,  6, 15, 16 }, {  5,  2,  6, 18 }, {  7,  2,  2, 18 }, {  2,  8, 11,  5 },
+};
+
+static const std::uint8_t g_font24_bits[] = {
+    0xFF, 0xFF, 0xFF, 0xE9, 0x01, 0xFF, 0x3F, 0x3F, 0x3A, 0x12, 0x12, 0x12, 0x10, 0xCC, 0x19, 0x83,
+    0x30, 0x66, 0x0C, 0xCF, 0xFF, 0xFF, 0xC6, 0x61, 0x98, 0xFF, 0xFF, 0xFC, 0xCC, 0x19, 0x83, 0x30,
+    0x66, 0x0C, 0xC0, 0x60, 0x30, 0x7B, 0x7F, 0xE1, 0xF0, 0xFC, 0x07, 0xC1, 0xF8, 0x1F, 0x83, 0xE1,
+    0xF1, 0xFF, 0xDB, 0xC0, 0xC0, 0x60, 0x30, 0x18, 0x3C, 0x1F, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7,
+    0xFC, 0xFC, 0xFF, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xE0, 0xF0, 0x7E, 0x1F, 0xC6, 0x30, 0xC0,
+    0x18, 0x01, 0x80, 0x38, 0x0F, 0x9F, 0xBF, 0xE3, 0xCC, 0x38, 0xFF, 0xCF, 0xBF, 0xFD, 0x24, 0x83,
+    0x1C, 0xE7, 0x9C, 0x73, 0x8E, 0x38, 0xE3, 0x8E, 0x1C, 0x70, 0xE3, 0x87, 0x0F, 0x0E, 0x1C, 0x70,
+    0xE3, 0x87, 0x1C, 0x71, 0xC7, 0x1C, 0xE3, 0x9E, 0x73, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0xED, 0xFF,
+    0xF3, 0xF0, 0x78, 0x1E, 0x0C, 0xC3, 0x30, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x3F, 0xFF,
+    0xFF, 0xC1, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0xE6, 0x73, 0x19, 0x8C, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x60, 0x18, 0x0E, 0x03, 0x01, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01, 0x80, 0x60, 0x30,
+    0x0C, 0x06, 0x01, 0x80, 0xE0, 0x30, 0x1C, 0x06, 0x01, 0x80, 0x0F, 0x07, 0xE3, 0x0C, 0xC3, 0x60,
+    0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x06, 0xC3, 0x30, 0xC7, 0xE0, 0xF0, 0x08, 0x1E, 0x1F,
+    0x87, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x7F, 0xFF, 0xF8,
+    0xF8, 0x7F, 0xDC, 0x1B, 0x01, 0xE0, 0x30, 0x06, 0x01, 0x80, 0x60, 0x38, 0x0E, 0x03, 0x00, 0xC0,
+    0x30, 0x0F, 0xFF, 0xFF, 0xC7, 0x87, 0xF1, 0x8E, 0x01, 0x80, 0x60, 0x30, 0x78, 0x1F, 0x00, 0xE0,
+    0x0C, 0x03, 0x00, 0xF0, 0x7F, 0xF9, 0xF8, 0x03, 0x80, 0xF0, 0x1E, 0x06, 0xC1, 0x98, 0x33, 0x0C,
+    0x61, 0x8C, 0x61, 0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x1F, 0xC3, 0xFB, 0xFE, 0x7F, 0xCC, 0x01,
+    0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x30, 0x03, 0x00, 0x60, 0x0C, 0x01, 0xE0, 0x6F, 0xFC, 0x7E,
+    0x01, 0xF1, 0xFC, 0xE0, 0x70, 0x18, 0x0C, 0x03, 0x78, 0xFF, 0xB8, 0x6C, 0x0F, 0x03, 0xC0, 0xD8,
+    0x77, 0xF8, 0x7C, 0xFF, 0xFF, 0xFC, 0x0F, 0x07, 0x01, 0x80, 0x60, 0x38, 0x0C, 0x03, 0x01, 0xC0,
+    0x60, 0x18, 0x0E, 0x03, 0x00, 0xC0, 0xFC, 0x7F, 0xB8, 0x7C, 0x0F, 0x03, 0x61, 0x8F, 0xC3, 0xF1,
+    0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x87, 0x7F, 0x8F, 0xC3, 0xE1, 0xFE, 0xE1, 0xB0, 0x3C, 0x0F, 0x03,
+    0x61, 0xDF, 0xF1, 0xEC, 0x03, 0x01, 0x80, 0xE0, 0x73, 0xF8, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x3F,
+    0xFC, 0xF3, 0xCF, 0x00, 0x00, 0x00, 0x39, 0xC6, 0x18, 0xC2, 0x00, 0x01, 0xC0, 0x0F, 0x00, 0xF0,
+    0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+    0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xC0, 0x03, 0xC0,
+    0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x00,
+    0xE0, 0x00, 0xF8, 0xFE, 0xC3, 0xE0, 0xF0, 0x60, 0x70, 0x70, 0xF0, 0x70, 0x30, 0x00, 0x00, 0x0E,
+    0x07, 0x01, 0xF0, 0xFE, 0x71, 0xD8, 0x3C, 0x3F, 0x1F, 0xCE, 0xF3, 0x3C, 0xCF, 0x33, 0xC7, 0xF0,
+    0xFC, 0x01, 0x80, 0x70, 0xCF, 0xF1, 0xF0, 0x7E, 0x00, 0x7F, 0x00, 0x07, 0x00, 0x0D, 0x80, 0x0D,
+    0x80, 0x18, 0xC0, 0x18, 0xC0, 0x30, 0xC0, 0x3F, 0xE0, 0x7F, 0xE0, 0x60, 0x30, 0xC0, 0x33, 0xF1,
+    0xFF, 0xF1, 0xFF, 0xFF, 0x1F, 0xFC, 0x30, 0x71, 0x81, 0x8C, 0x0C, 0x60, 0xE3, 0xFE, 0x1F, 0xF8,
+    0xC0, 0xE6, 0x03, 0x30, 0x19, 0x80, 0xFF, 0xFD, 0xFF, 0xC0, 0xFB, 0x3F, 0xF7, 0x07, 0x60, 0x3C,
+    0x03, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x06, 0x03, 0x70, 0x73, 0xFE, 0x0F, 0xCF, 0xF8,
+    0x7F, 0xF0, 0xC1, 0xC6, 0x06, 0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0,
+    0xC6, 0x0E, 0xFF, 0xE7, 0xFE, 0x3F, 0xFF, 0xFF, 0xCC, 0x0C, 0xC0, 0xCC, 0xCC, 0xCC, 0x0F, 0xC0,
+    0xFC, 0x0C, 0xC0, 0xCC, 0xCC, 0x0C, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0x0C, 0xC0,
+    0xCC, 0xCC, 0xCC, 0x0F, 0xC0, 0xFC, 0x0C, 0xC0, 0xCC, 0x0C, 0x00, 0xC0, 0x3F, 0xC3, 0xFC, 0x03,
+    0xEC, 0x7F, 0xE7, 0x07, 0x30, 0x1B, 0x00, 0xD8, 0x00, 0xC0, 0x06, 0x1F, 0xF0, 0xFF, 0x80, 0x6E,
+    0x03, 0x38, 0x38, 0xFF, 0xC1, 0xF8, 0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0,
+    0xC3, 0xFF, 0x0F, 0xFC, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3, 0xFF, 0xFF,
+    0xFF, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x0F, 0xFF, 0xFF,
+    0x1F, 0xF8, 0xFF, 0xC0, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x18, 0x18, 0xC0, 0xC6, 0x06,
+    0x30, 0x31, 0x83, 0x0F, 0xF8, 0x1F, 0x03, 0xF9, 0xF7, 0xF3, 0xE3, 0x06, 0x06, 0x18, 0x0C, 0x60,
+    0x19, 0x80, 0x37, 0x00, 0x7F, 0x00, 0xE7, 0x01, 0x87, 0x03, 0x06, 0x06, 0x0E, 0x3F, 0x8F, 0xFF,
+    0x1F, 0xFF, 0x07, 0xF8, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x18,
+    0xC0, 0xC6, 0x06, 0x30, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xE0, 0x7C, 0xE0, 0x70, 0xF0, 0xF0,
+    0xF0, 0xF0, 0xD9, 0xB0, 0xD9, 0xB0, 0xCF, 0x30, 0xCF, 0x30, 0xC6, 0x30, 0xC0, 0x30, 0xC0, 0x33,
+    0xF9, 0xFF, 0xF9, 0xFF, 0xC7, 0xFF, 0x1F, 0xCE, 0x0C, 0x3C, 0x30, 0xF8, 0xC3, 0x63, 0x0D, 0xCC,
+    0x33, 0xB0, 0xC6, 0xC3, 0x1F, 0x0C, 0x3C, 0x30, 0x73, 0xF8, 0xCF, 0xE3, 0x03, 0xC0, 0xFF, 0x1C,
+    0x39, 0x81, 0xB8, 0x1F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x81, 0xD8, 0x19, 0xC3, 0x8F, 0xF0,
+    0x3C, 0x3F, 0xF3, 0xFF, 0x8C, 0x1C, 0xC0, 0xCC, 0x0C, 0xC0, 0xCC, 0x18, 0xFF, 0x8F, 0xE0, 0xC0,
+    0x0C, 0x00, 0xC0, 0x3F, 0xC3, 0xFC, 0x03, 0xC0, 0xFF, 0x1C, 0x39, 0x81, 0xB8, 0x1F, 0x00, 0xF0,
+    0x0F, 0x00, 0xF0, 0x0F, 0x81, 0xD8, 0x19, 0xC3, 0x8F, 0xF0, 0x7C, 0x07, 0xCC, 0xFF, 0xCC, 0x3B,
+    0xFF, 0x0F, 0xFE, 0x0C, 0x1C, 0x30, 0x30, 0xC0, 0xC3, 0x07, 0x0F, 0xF8, 0x3F, 0x80, 0xC7, 0x03,
+    0x0E, 0x0C, 0x18, 0x30, 0x73, 0xF8, 0xFF, 0xE1, 0xCF, 0xB7, 0xFF, 0x87, 0xC0, 0xF0, 0x3F, 0x01,
+    0xF8, 0x1F, 0x80, 0xFC, 0x0F, 0x03, 0xE1, 0xFF, 0xED, 0xF3, 0xFF, 0xFF, 0xFF, 0x18, 0xF1, 0x8F,
+    0x18, 0xF1, 0x8C, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0xFF, 0x0F, 0xF3, 0xF3,
+    0xFF, 0xCF, 0xCC, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+    0x0C, 0x0C, 0x18, 0x60, 0x7F, 0x80, 0x78, 0x3F, 0xBF, 0xFF, 0x7F, 0x30, 0x18, 0x30, 0x60, 0x60,
+    0xC0, 0xC1, 0x80, 0xC6, 0x01, 0x8C, 0x01, 0xB0, 0x03, 0x60, 0x06, 0xC0, 0x07, 0x00, 0x0E, 0x00,
+    0x08, 0x0F, 0xE3, 0xFF, 0xF1, 0xFC, 0xC0, 0x18, 0x60, 0x0C, 0x30, 0x86, 0x0C, 0xE6, 0x06, 0x73,
+    0x03, 0x6D, 0x81, 0xB6, 0xC0, 0xF3, 0xE0, 0x38, 0xE0, 0x1C, 0x70, 0x0C, 0x18, 0x06, 0x0C, 0x3F,
+    0x3F, 0xFC, 0xFC, 0xC0, 0xC1, 0x86, 0x03, 0x30, 0x07, 0x80, 0x0C, 0x00, 0x30, 0x01, 0xE0, 0x0C,
+    0xC0, 0x61, 0x83, 0x03, 0x3F, 0x3F, 0xFC, 0xFF, 0xE3, 0xFF, 0x8F, 0xCC, 0x0C, 0x18, 0x60, 0x33,
+    0x00, 0xCC, 0x01, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x7F, 0x81, 0xFE,
+    0x1F, 0xFB, 0xFF, 0x60, 0x6C, 0x19, 0x86, 0x31, 0x80, 0x60, 0x18, 0x06, 0x19, 0x83, 0x60, 0x78,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8F, 0xFF, 0x00,
+    0xC0, 0x38, 0x06, 0x01, 0xC0, 0x30, 0x0C, 0x01, 0x80, 0x60, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x03,
+    0x00, 0xC0, 0x38, 0x06, 0x01, 0xC0, 0x30, 0x0F, 0xFF, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6,
+    0x31, 0x8F, 0xFF, 0x04, 0x01, 0xC0, 0x7C, 0x1D, 0xC3, 0x18, 0xC1, 0xB0, 0x1C, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC7, 0x0E, 0x33, 0xF0, 0x7F, 0x80, 0x0C, 0x00, 0xC1, 0xFC, 0x7F, 0xCE, 0x0C, 0xC0,
+    0xCC, 0x1C, 0x7F, 0xF3, 0xEF, 0xF0, 0x07, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x7C, 0x1F, 0xF8, 0xE0,
+    0xC6, 0x03, 0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x83, 0x7F, 0xFB, 0xDF, 0x01, 0xF6, 0x7F,
+    0xEE, 0x0F, 0xC0, 0x78, 0x07, 0x80, 0x18, 0x01, 0xC0, 0x6E, 0x0E, 0x7F, 0xC1, 0xF8, 0x03, 0xC0,
+    0x1E, 0x00, 0x30, 0x01, 0x83, 0xEC, 0x7F, 0xE3, 0x07, 0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33,
+    0x01, 0x8C, 0x1C, 0x7F, 0xF8, 0xFB, 0xC7, 0xE1, 0xFF, 0x98, 0x1B, 0x00, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x03, 0x00, 0x18, 0x0D, 0xFF, 0xC7, 0xF0, 0x1F, 0xC3, 0xFC, 0x60, 0x06, 0x03, 0xFF, 0xBF, 0xF8,
+    0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x3F, 0xF3, 0xFF, 0x07, 0xDE, 0xFF,
+    0xF6, 0x0E, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x18, 0x38, 0xFF, 0xC1, 0xF6, 0x00,
+    0x30, 0x01, 0x80, 0x1C, 0x3F, 0xC1, 0xF8, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0D, 0xF0,
+    0x3F, 0xE0, 0xE1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0xFC, 0xFF,
+    0xF3, 0xF0, 0x60, 0x06, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x7E, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x06, 0x03, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x06,
+    0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x81, 0xFF, 0xDF, 0x8F, 0x00,
+    0xF0, 0x03, 0x00, 0x30, 0x03, 0x3E, 0x33, 0xE3, 0x30, 0x36, 0x03, 0xE0, 0x3C, 0x03, 0xE0, 0x37,
+    0x03, 0x38, 0xF1, 0xFF, 0x1F, 0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+    0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xFF, 0x77, 0x8F, 0xFF, 0xC3,
+    0x9C, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xC3, 0x18, 0xCF, 0xDE, 0xFF,
+    0xDE, 0xFF, 0x7C, 0x3F, 0xF8, 0x38, 0x70, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3,
+    0x03, 0x3F, 0x3F, 0xFC, 0xFC, 0x3C, 0x0F, 0xF1, 0xC3, 0xB8, 0x1F, 0x00, 0xF0, 0x0F, 0x00, 0xF8,
+    0x1D, 0xC3, 0x8F, 0xF0, 0x3C, 0x3D, 0xF1, 0xFF, 0xE3, 0x83, 0x18, 0x0C, 0xC0, 0x66, 0x03, 0x30,
+    0x19, 0x80, 0xCE, 0x0C, 0x7F, 0xE3, 0x7C, 0x18, 0x00, 0xC0, 0x06, 0x00, 0xFE, 0x07, 0xF0, 0x07,
+    0xDE, 0xFF, 0xF6, 0x0E, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x18, 0x38, 0xFF, 0xC1,
+    0xF6, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x03, 0xF8, 0x1F, 0xFE, 0x7B, 0xEF, 0xC7, 0xCC, 0x70, 0x06,
+    0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x03, 0xFF, 0x3F, 0xF0, 0xFF, 0x7F, 0xF0, 0x3C, 0x0F, 0xF0,
+    0x7F, 0x81, 0xFC, 0x0F, 0x07, 0xFF, 0xBF, 0xC3, 0x00, 0x30, 0x03, 0x00, 0x30, 0x0F, 0xFC, 0xFF,
+    0xC3, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x07, 0x1F, 0xF0, 0xFC, 0xF0, 0xF3,
+    0xC3, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x70, 0x7F, 0xF0,
+    0xFB, 0xFE, 0x1F, 0xF8, 0x7C, 0xC0, 0xC3, 0x03, 0x06, 0x18, 0x18, 0x60, 0x33, 0x00, 0xCC, 0x03,
+    0xF0, 0x07, 0x80, 0x1E, 0x0F, 0x07, 0xF8, 0x3D, 0x88, 0xCC, 0xE6, 0x67, 0x31, 0xAB, 0x0F, 0x78,
+    0x7B, 0xC3, 0x8C, 0x0C, 0x60, 0x63, 0x1F, 0x3F, 0xF3, 0xE6, 0x18, 0x33, 0x01, 0xE0, 0x0C, 0x01,
+    0xE0, 0x33, 0x06, 0x19, 0xF3, 0xFF, 0x3F, 0xF8, 0x7F, 0xF0, 0xF9, 0x80, 0xC1, 0x83, 0x03, 0x06,
+    0x03, 0x18, 0x06, 0x30, 0x06, 0xC0, 0x0F, 0x80, 0x0E, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x60, 0x01,
+    0x80, 0x3F, 0xC0, 0x7F, 0x81, 0xFF, 0xFF, 0xF8, 0x36, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x86, 0xC1,
+    0xFF, 0xFF, 0xF8, 0xE7, 0x98, 0x61, 0x86, 0x18, 0x63, 0x9C, 0x38, 0x61, 0x86, 0x18, 0x61, 0xE3,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x18, 0x61, 0x86, 0x18, 0x61, 0xC3, 0x9C, 0x61, 0x86, 0x18,
+    0x67, 0x9C, 0x1C, 0x07, 0xC7, 0xDD, 0xF1, 0xF0, 0x1C,
+};
+
+const packed_font PackedFont24 {
+    g_font24_offsets, g_font24_box_indices, g_font24_boxes, g_font24_bits,
+    sizeof(g_font24_bits), 56, 17, 24, ' ', 95,
+};
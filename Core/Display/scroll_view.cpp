@@ -0,0 +1,276 @@
+/*
+ * scroll_view.cpp
+ *
+ * Touch scrolling through the terminal's scrollback.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "scroll_view.h"
+
+#include "cycles.h"
+#include "logger.h"
+#include "stm32l562e_discovery_lcd.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Lines the window can overlap, and so lines remembered */
+static constexpr std::uint32_t SHOWN_LINES { terminal::ROWS + 1 };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+scroll_view::scroll_view(terminal &screen, scrollback &lines) :
+        _screen { screen }, _lines { lines }, _active { false }, _hw_scroll { false },
+        _top {}, _shown_top {}, _shown_valid { false }, _shown {},
+        _touching { false }, _dragging { false }, _press_y {}, _touch_y {}, _touch_ms {},
+        _flinging { false }, _velocity {}, _carry {}, _last_ms {},
+        _frames {}, _rows_drawn {}, _slowest_us {} {
+
+}
+
+void scroll_view::touch(bool down, std::uint32_t y, std::uint32_t ms) {
+    const auto touch_y = static_cast<std::int32_t>(y);
+
+    if (!down) {
+        if (!_touching) {
+            return;
+        }
+        _touching = false;
+
+        if (!_dragging) {
+            /* A tap goes back to the live screen */
+            if (_active) {
+                _top = live_top();
+                _flinging = false;
+            }
+        } else if (ms - _touch_ms < FLING_HOLD_MS && std::abs(_velocity) >= FLING_MIN_VELOCITY) {
+            _flinging = true;
+            _carry = 0;
+        }
+        return;
+    }
+
+    if (!_touching) {
+        _touching = true;
+        _dragging = false;
+        _flinging = false;
+        _press_y = touch_y;
+        _touch_y = touch_y;
+        _touch_ms = ms;
+        _velocity = 0;
+        return;
+    }
+
+    if (!_dragging && std::abs(touch_y - _press_y) < DRAG_THRESHOLD) {
+        return;
+    }
+    _dragging = true;
+
+    /* The text follows the finger, so the window moves the other way */
+    const auto moved = _touch_y - touch_y;
+    const auto elapsed = static_cast<std::int32_t>(std::max<std::uint32_t>(ms - _touch_ms, 1));
+
+    /* Samples come in unevenly, so smooth the velocity a little */
+    _velocity = (_velocity + 3 * (moved * 1000 / elapsed)) / 4;
+
+    move(moved);
+    _touch_y = touch_y;
+    _touch_ms = ms;
+}
+
+std::size_t scroll_view::render(std::uint32_t ms) {
+    const auto elapsed = std::min<std::uint32_t>(ms - _last_ms, FLING_DECAY_MS);
+    _last_ms = ms;
+
+    if (_flinging) {
+        const auto travel = static_cast<std::int64_t>(_velocity) * elapsed + _carry;
+        const auto before = _top;
+        _carry = travel % 1000;
+        move(travel / 1000);
+
+        /* Exponential decay, a step at a time; stops short at either end */
+        _velocity -= static_cast<std::int32_t>(static_cast<std::int64_t>(_velocity) * elapsed / FLING_DECAY_MS);
+        if (std::abs(_velocity) < FLING_STOP_VELOCITY || (travel / 1000 != 0 && _top == before)) {
+            _flinging = false;
+        }
+    }
+
+    if (!_active) {
+        return 0;
+    }
+
+    /* Lines dropped from the scrollback take the window with them */
+    _top = std::clamp(_top, oldest_top(), live_top());
+
+    if (_top == live_top() && !_touching && !_flinging) {
+        leave();
+        return 0;
+    }
+
+    const auto start = cycles::now();
+    std::size_t drawn = 0;
+
+    if (!_shown_valid) {
+        /* Not available in landscape; every move then redraws the window */
+        _hw_scroll = BSP_LCD_SetScrollArea(0, 0, HEIGHT) == BSP_ERROR_NONE;
+        for (auto &shown : _shown) {
+            shown.valid = false;
+        }
+    }
+
+    if (!_shown_valid || (_top != _shown_top && (!_hw_scroll || std::abs(_top - _shown_top) >= HEIGHT))) {
+        drawn += draw_rows(_top, _top + HEIGHT);
+    } else if (_top < _shown_top) {
+        drawn += draw_rows(_top, _shown_top);
+    } else if (_top > _shown_top) {
+        drawn += draw_rows(_shown_top + HEIGHT, _top + HEIGHT);
+    }
+
+    if (_hw_scroll && (!_shown_valid || _top != _shown_top)) {
+        BSP_LCD_SetScrollStart(0, static_cast<std::uint32_t>(_top % HEIGHT));
+    }
+    _shown_top = _top;
+    _shown_valid = true;
+
+    drawn += update_live();
+
+    if (drawn > 0) {
+        const auto us = static_cast<std::uint32_t>(cycles::to_us(cycles::now() - start));
+        ++_frames;
+        _rows_drawn += drawn;
+        _slowest_us = std::max(_slowest_us, us);
+    }
+
+    return drawn;
+}
+
+void scroll_view::reset() {
+    _active = false;
+    _flinging = false;
+    _dragging = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void scroll_view::move(std::int64_t pixels) {
+    if (!_active) {
+        /* Nothing below the live screen, or nothing above it yet */
+        if (pixels >= 0 || _lines.begin() == _lines.end()) {
+            return;
+        }
+
+        _active = true;
+        _top = live_top();
+        _shown_valid = false;
+        _frames = 0;
+        _rows_drawn = 0;
+        _slowest_us = 0;
+    }
+
+    _top = std::clamp(_top + pixels, oldest_top(), live_top());
+}
+
+void scroll_view::leave() {
+    LOG("scroll_view: %lu frames, %lu pixel rows drawn, slowest %lu us\n",
+            static_cast<unsigned long>(_frames), static_cast<unsigned long>(_rows_drawn),
+            static_cast<unsigned long>(_slowest_us));
+
+    reset();
+    _screen.redraw();
+}
+
+std::int64_t scroll_view::live_top() const {
+    return static_cast<std::int64_t>(_lines.end()) * terminal::CELL_HEIGHT;
+}
+
+std::int64_t scroll_view::oldest_top() const {
+    return static_cast<std::int64_t>(_lines.begin()) * terminal::CELL_HEIGHT;
+}
+
+bool scroll_view::fetch(std::uint32_t line, terminal::Cell *cells) {
+    const auto end = _lines.end();
+
+    if (line < end) {
+        _lines.read(line, cells);
+        return false;
+    }
+
+    const auto *row = _screen.row(std::min(line - end, terminal::ROWS - 1));
+    std::copy(row, row + terminal::COLUMNS, cells);
+    return true;
+}
+
+std::size_t scroll_view::draw_rows(std::int64_t first, std::int64_t last) {
+    std::size_t drawn = 0;
+    terminal::Cell cells[terminal::COLUMNS];
+
+    for (auto line = first / terminal::CELL_HEIGHT; line * terminal::CELL_HEIGHT < last; ++line) {
+        const auto number = static_cast<std::uint32_t>(line);
+        const bool live = fetch(number, cells);
+        drawn += draw_line(number, cells, live, first, last);
+    }
+
+    return drawn;
+}
+
+std::size_t scroll_view::draw_line(std::uint32_t line, const terminal::Cell *cells, bool live,
+                                   std::int64_t first, std::int64_t last) {
+    auto &shown = _shown[line % SHOWN_LINES];
+
+    /* Rows drawn earlier show the old cells */
+    if (shown.valid && shown.line == line && !std::equal(cells, cells + terminal::COLUMNS, shown.cells)) {
+        first = _top;
+        last = _top + HEIGHT;
+    }
+
+    const auto line_top = static_cast<std::int64_t>(line) * terminal::CELL_HEIGHT;
+    const auto from = std::max(first, line_top) - line_top;
+    const auto to = std::min<std::int64_t>(last, line_top + terminal::CELL_HEIGHT) - line_top;
+    const auto y = _hw_scroll ? (line_top + from) % HEIGHT : line_top + from - _top;
+
+    terminal::draw_line(cells, static_cast<std::uint32_t>(from), static_cast<std::uint32_t>(to),
+                        static_cast<std::uint32_t>(y));
+
+    shown.line = line;
+    shown.valid = true;
+    shown.live = live;
+    std::copy(cells, cells + terminal::COLUMNS, shown.cells);
+
+    return static_cast<std::size_t>(to - from);
+}
+
+std::size_t scroll_view::update_live() {
+    std::size_t drawn = 0;
+    terminal::Cell cells[terminal::COLUMNS];
+
+    const auto first = static_cast<std::uint32_t>(_top / terminal::CELL_HEIGHT);
+    const auto last = static_cast<std::uint32_t>((_top + HEIGHT - 1) / terminal::CELL_HEIGHT);
+
+    for (auto line = first; line <= last; ++line) {
+        auto &shown = _shown[line % SHOWN_LINES];
+        if (!shown.valid || shown.line != line || !shown.live) {
+            continue;
+        }
+
+        /* Once a line has scrolled into the scrollback it can't change again */
+        const bool live = fetch(line, cells);
+        if (std::equal(cells, cells + terminal::COLUMNS, shown.cells)) {
+            shown.live = live;
+            continue;
+        }
+
+        drawn += draw_line(line, cells, live, _top, _top + HEIGHT);
+    }
+
+    return drawn;
+}
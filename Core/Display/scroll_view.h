@@ -0,0 +1,169 @@
+/*
+ * scroll_view.h
+ *
+ * Touch scrolling through the terminal's scrollback. Dragging the screen down moves the view back
+ * through history, a flick keeps it going and slows it down, and a tap, or scrolling back to the
+ * bottom, returns to the live screen.
+ *
+ * The view is a window onto one tall column of lines: the scrollback, then the terminal's screen.
+ * The panel's hardware scroll makes GRAM a ring of the screen's height, and every pixel row of the
+ * column has its place in it, so moving the window only moves the scroll start and draws the rows
+ * it exposes: a line's worth of pixels for every line scrolled, however fast. Text that keeps
+ * arriving doesn't move the window; the lines it pushes into the scrollback keep their place in
+ * the column, so only cells that change on the part of the screen still in view get drawn.
+ *
+ * Only the display thread uses a view, and the terminal must not render while active() is set.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "scrollback.h"
+#include "terminal.h"
+
+#include <cstddef>
+#include <cstdint>
+
+class scroll_view {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Height of the window in pixels. */
+    static constexpr std::uint32_t HEIGHT { terminal::ROWS * terminal::CELL_HEIGHT };
+
+    /** Pixels a touch has to move to be a drag rather than a tap. */
+    static constexpr std::int32_t DRAG_THRESHOLD { 8 };
+
+    /** Slowest release, in pixels a second, that still flings. */
+    static constexpr std::int32_t FLING_MIN_VELOCITY { 300 };
+
+    /** A fling stops once it's slower than this, in pixels a second. */
+    static constexpr std::int32_t FLING_STOP_VELOCITY { 30 };
+
+    /** Time constant of a fling slowing down. */
+    static constexpr std::uint32_t FLING_DECAY_MS { 325 };
+
+    /** A finger held still this long before it's lifted doesn't fling. */
+    static constexpr std::uint32_t FLING_HOLD_MS { 80 };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    scroll_view(terminal &screen, scrollback &lines);
+
+    /**
+     * Takes a touch sample. Call for every sample while a finger is down, and once with down false
+     * when it's lifted.
+     *
+     * @param down whether the screen is being touched.
+     * @param y    the touch's screen row, if down.
+     * @param ms   when the sample was taken, in milliseconds.
+     */
+    void touch(bool down, std::uint32_t y, std::uint32_t ms);
+
+    /** Whether the view is showing history, rather than the terminal drawing the screen. */
+    bool active() const { return _active; }
+
+    /** Whether a fling is moving the view, so the next frame is due right away. */
+    bool flinging() const { return _flinging; }
+
+    /**
+     * Moves a fling along and draws what changed. Returns to the live screen when the window is
+     * back at the bottom and nothing is moving it; the terminal's next render then redraws it.
+     *
+     * @param ms the time now, in milliseconds.
+     *
+     * @return the number of pixel rows drawn.
+     */
+    std::size_t render(std::uint32_t ms);
+
+    /** Drops back to the live screen without drawing, e.g. after the terminal is cleared. */
+    void reset();
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** A line as last drawn; one per line the window can overlap. */
+    struct Shown {
+        std::uint32_t line;
+        bool valid;
+        /** Whether it was drawn from the screen, so it may still change. */
+        bool live;
+        terminal::Cell cells[terminal::COLUMNS];
+    };
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    terminal &_screen;
+    scrollback &_lines;
+
+    bool _active;
+    /** Whether the LCD scrolls in hardware; otherwise every move redraws the window. */
+    bool _hw_scroll;
+
+    /** Top of the window, in pixel rows of the column, and where it was last drawn. */
+    std::int64_t _top;
+    std::int64_t _shown_top;
+    bool _shown_valid;
+    Shown _shown[terminal::ROWS + 1];
+
+    /** The touch in progress. */
+    bool _touching;
+    bool _dragging;
+    std::int32_t _press_y;
+    std::int32_t _touch_y;
+    std::uint32_t _touch_ms;
+
+    /** Pixels a second the window moves down the column, and fractions of a pixel carried over. */
+    bool _flinging;
+    std::int32_t _velocity;
+    std::int64_t _carry;
+    std::uint32_t _last_ms;
+
+    /** For the report when the view closes. */
+    std::uint32_t _frames;
+    std::uint32_t _rows_drawn;
+    std::uint32_t _slowest_us;
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Moves the window, opening the view if it's going back from the live screen. */
+    void move(std::int64_t pixels);
+
+    /** Closes the view and has the terminal redraw the screen. */
+    void leave();
+
+    /** Top of the window on the live screen, and the highest it goes. */
+    std::int64_t live_top() const;
+    std::int64_t oldest_top() const;
+
+    /** Gets a line of the column. Returns whether it's on the screen. */
+    bool fetch(std::uint32_t line, terminal::Cell *cells);
+
+    /** Draws pixel rows first up to last of the column; they must be in the window. */
+    std::size_t draw_rows(std::int64_t first, std::int64_t last);
+
+    /**
+     * Draws a line's pixel rows between first and last, or all of it in the window if it was
+     * drawn with other cells, and remembers it.
+     */
+    std::size_t draw_line(std::uint32_t line, const terminal::Cell *cells, bool live,
+                          std::int64_t first, std::int64_t last);
+
+    /** Redraws lines in the window drawn from the screen, if they've changed since. */
+    std::size_t update_live();
+};
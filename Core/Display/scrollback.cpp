@@ -0,0 +1,307 @@
+/*
+ * scrollback.cpp
+ *
+ * Lines scrolled off the top of the terminal, in SRAM and then in OSPI NOR flash.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "scrollback.h"
+
+#include "log_store.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* The spill ring sits right below the log store */
+static constexpr std::uint32_t SPILL_BASE_ADDRESS {
+    log_store::BASE_ADDRESS - scrollback::SPILL_SECTOR_COUNT * ospi_flash::SECTOR_SIZE
+};
+
+/* Encoding escapes; printable ASCII stands for itself */
+static constexpr std::uint8_t SET_COLORS { 0x01 };
+static constexpr std::uint8_t CHARACTER { 0x02 };
+
+/* Erased flash, where a spilled line's length would be */
+static constexpr std::uint8_t ERASED { 0xFF };
+
+/* What lines start as, and what's left off their ends */
+static constexpr terminal::Cell BLANK { u' ', terminal::Color::WHITE, terminal::Color::BLACK };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::uint32_t sector_address(std::uint32_t sector);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+scrollback::scrollback() :
+        _text {}, _offsets {}, _text_end {}, _text_used {}, _first {}, _end {},
+        _spill_ready { false }, _head {}, _used {}, _sector_first {}, _staging {}, _staged {},
+        _cache {}, _cached_sector {}, _cache_valid { false } {
+
+}
+
+bool scrollback::init() {
+    if (!ospi_flash::ready()) {
+        return false;
+    }
+
+    {
+        ospi_flash::lock lock {};
+        if (BSP_OSPI_NOR_Erase_Block(ospi_flash::INSTANCE, sector_address(0), BSP_OSPI_NOR_ERASE_4K) != BSP_ERROR_NONE) {
+            return false;
+        }
+    }
+
+    _head = 0;
+    _used = 0;
+    _staged = 0;
+    _cache_valid = false;
+    _spill_ready = true;
+    return true;
+}
+
+void scrollback::push(const terminal::Cell *cells) {
+    std::uint8_t text[MAX_LINE_SIZE];
+    const auto size = encode(cells, text);
+
+    while (_end - _first == LINE_CAPACITY || _text_used + size > TEXT_SIZE) {
+        evict();
+    }
+
+    _offsets[_end % LINE_CAPACITY] = _text_end;
+    for (std::size_t i = 0; i < size; ++i) {
+        _text[(_text_end + i) % TEXT_SIZE] = text[i];
+    }
+    _text_end = static_cast<std::uint16_t>((_text_end + size) % TEXT_SIZE);
+    _text_used += size;
+    ++_end;
+}
+
+std::uint32_t scrollback::begin() const {
+    return (_used > 0) ? _sector_first[oldest_sector()] : _first;
+}
+
+bool scrollback::read(std::uint32_t line, terminal::Cell *cells) {
+    if (line >= _end || line < begin()) {
+        std::fill_n(cells, terminal::COLUMNS, BLANK);
+        return false;
+    }
+
+    if (line >= _first) {
+        const auto start = _offsets[line % LINE_CAPACITY];
+        decode(size(line), [this, start](std::size_t i) { return _text[(start + i) % TEXT_SIZE]; }, cells);
+        return true;
+    }
+
+    /* The last sector, oldest first, that starts at or before the line */
+    const auto oldest = oldest_sector();
+    std::uint32_t low = 0;
+    std::uint32_t high = _used;
+    while (high - low > 1) {
+        const auto mid = low + (high - low) / 2;
+        if (_sector_first[(oldest + mid) % SPILL_SECTOR_COUNT] <= line) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    const auto sector = (oldest + low) % SPILL_SECTOR_COUNT;
+
+    const auto *data = sector_data(sector);
+    std::uint32_t at = 0;
+    for (auto skip = line - _sector_first[sector]; data != nullptr && skip > 0 && at < ospi_flash::SECTOR_SIZE; --skip) {
+        at += 1U + data[at];
+    }
+
+    if (data == nullptr || at >= ospi_flash::SECTOR_SIZE || data[at] == ERASED ||
+            at + 1U + data[at] > ospi_flash::SECTOR_SIZE) {
+        std::fill_n(cells, terminal::COLUMNS, BLANK);
+        return false;
+    }
+
+    const auto *text = &data[at + 1];
+    decode(data[at], [text](std::size_t i) { return text[i]; }, cells);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void scrollback::evict() {
+    if (_spill_ready) {
+        std::uint8_t text[MAX_LINE_SIZE];
+        const auto start = _offsets[_first % LINE_CAPACITY];
+        const auto length = size(_first);
+        for (std::size_t i = 0; i < length; ++i) {
+            text[i] = _text[(start + i) % TEXT_SIZE];
+        }
+        spill(_first, text, length);
+    }
+
+    _text_used -= size(_first);
+    ++_first;
+}
+
+void scrollback::spill(std::uint32_t line, const std::uint8_t *text, std::size_t size) {
+    if (_staged + 1 + size > ospi_flash::SECTOR_SIZE) {
+        advance_head();
+        if (!_spill_ready) {
+            return;
+        }
+    }
+
+    if (_staged == 0) {
+        _sector_first[_head] = line;
+        ++_used;
+    }
+
+    _staging[_staged] = static_cast<std::uint8_t>(size);
+    std::memcpy(&_staging[_staged + 1], text, size);
+    _staged += 1 + size;
+}
+
+void scrollback::advance_head() {
+    const auto next = (_head + 1) % SPILL_SECTOR_COUNT;
+
+    {
+        ospi_flash::lock lock {};
+
+        /* Waits out the erase started when this sector became the head */
+        if (BSP_OSPI_NOR_Write(ospi_flash::INSTANCE, _staging, sector_address(_head), _staged) != BSP_ERROR_NONE) {
+            stop_spilling();
+            return;
+        }
+
+        /* A full ring reuses the oldest sector; its lines are gone */
+        if (_used == SPILL_SECTOR_COUNT) {
+            --_used;
+        }
+
+        /* Doesn't wait; the flash is busy until the next program or read waits for it */
+        if (BSP_OSPI_NOR_Erase_Block(ospi_flash::INSTANCE, sector_address(next), BSP_OSPI_NOR_ERASE_4K) != BSP_ERROR_NONE) {
+            stop_spilling();
+            return;
+        }
+    }
+
+    if (_cached_sector == next) {
+        _cache_valid = false;
+    }
+
+    _head = next;
+    _staged = 0;
+}
+
+void scrollback::stop_spilling() {
+    LOG("scrollback: flash error, no longer spilling\n");
+
+    _spill_ready = false;
+    _used = 0;
+    _staged = 0;
+    _cache_valid = false;
+}
+
+std::uint32_t scrollback::oldest_sector() const {
+    const auto programmed = _used - ((_staged > 0) ? 1 : 0);
+    return (_head + SPILL_SECTOR_COUNT - programmed) % SPILL_SECTOR_COUNT;
+}
+
+const std::uint8_t *scrollback::sector_data(std::uint32_t sector) {
+    if (sector == _head) {
+        return _staging;
+    }
+
+    if (!_cache_valid || _cached_sector != sector) {
+        ospi_flash::lock lock {};
+        ospi_flash::wait();
+
+        _cached_sector = sector;
+        _cache_valid = BSP_OSPI_NOR_Read(ospi_flash::INSTANCE, _cache, sector_address(sector),
+                                         ospi_flash::SECTOR_SIZE) == BSP_ERROR_NONE;
+        if (!_cache_valid) {
+            return nullptr;
+        }
+    }
+
+    return _cache;
+}
+
+std::uint16_t scrollback::size(std::uint32_t line) const {
+    const auto start = _offsets[line % LINE_CAPACITY];
+    const auto end = (line + 1 == _end) ? _text_end : _offsets[(line + 1) % LINE_CAPACITY];
+    return static_cast<std::uint16_t>((end + TEXT_SIZE - start) % TEXT_SIZE);
+}
+
+std::size_t scrollback::encode(const terminal::Cell *cells, std::uint8_t *out) {
+    auto length = terminal::COLUMNS;
+    while (length > 0 && cells[length - 1] == BLANK) {
+        --length;
+    }
+
+    std::size_t size = 0;
+    auto fg = BLANK.fg;
+    auto bg = BLANK.bg;
+
+    for (std::uint32_t column = 0; column < length; ++column) {
+        const auto &cell = cells[column];
+
+        if (cell.fg != fg || cell.bg != bg) {
+            fg = cell.fg;
+            bg = cell.bg;
+            out[size++] = SET_COLORS;
+            out[size++] = static_cast<std::uint8_t>((static_cast<std::uint8_t>(fg) << 4) | static_cast<std::uint8_t>(bg));
+        }
+
+        if (cell.ch >= u' ' && cell.ch <= u'~') {
+            out[size++] = static_cast<std::uint8_t>(cell.ch);
+        } else {
+            out[size++] = CHARACTER;
+            out[size++] = static_cast<std::uint8_t>(cell.ch & 0xFFU);
+            out[size++] = static_cast<std::uint8_t>(cell.ch >> 8);
+        }
+    }
+
+    return size;
+}
+
+template<typename F>
+void scrollback::decode(std::size_t size, F &&next, terminal::Cell *cells) {
+    std::uint32_t column = 0;
+    auto fg = BLANK.fg;
+    auto bg = BLANK.bg;
+
+    for (std::size_t i = 0; i < size && column < terminal::COLUMNS;) {
+        const auto byte = next(i++);
+
+        /* An escape cut short only happens in damaged flash; it's shown as is */
+        if (byte == SET_COLORS && i < size) {
+            const auto colors = next(i++);
+            fg = static_cast<terminal::Color>(colors >> 4);
+            bg = static_cast<terminal::Color>(colors & 0x0FU);
+        } else if (byte == CHARACTER && i + 1 < size) {
+            const auto low = next(i++);
+            const auto high = next(i++);
+            cells[column++] = { static_cast<char16_t>(low | (high << 8)), fg, bg };
+        } else {
+            cells[column++] = { static_cast<char16_t>(byte), fg, bg };
+        }
+    }
+
+    std::fill(cells + column, cells + terminal::COLUMNS, BLANK);
+}
+
+static std::uint32_t sector_address(std::uint32_t sector) {
+    return SPILL_BASE_ADDRESS + sector * ospi_flash::SECTOR_SIZE;
+}
@@ -0,0 +1,159 @@
+/*
+ * scrollback.h
+ *
+ * Lines scrolled off the top of the terminal. The newest are kept in SRAM, encoded back to back
+ * in a ring of text with a ring of offsets, one per line. When either fills up, the oldest lines
+ * spill to a ring of sectors in the OSPI NOR flash, just below the log store, so with a byte or
+ * so per character a few hundred thousand lines stay reachable. Only when that wraps are lines
+ * finally dropped.
+ *
+ * Lines are numbered in the order they were pushed, from 0, and keep their numbers as they move
+ * to flash; see begin() and end().
+ *
+ * A line is encoded as a byte per ASCII character in the current colors, 0x01 and a byte (fg in
+ * the high nibble) to change the colors, or 0x02 and two bytes (little endian) for any other
+ * character. Lines start white on black, and trailing white on black blanks are left off.
+ *
+ * Used from the display thread only; the flash is shared through ospi_flash's lock.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "ospi_flash.h"
+#include "terminal.h"
+
+#include <cstddef>
+#include <cstdint>
+
+class scrollback {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * Lines, and bytes of encoded text, kept in SRAM: a few screens' worth, for scrolling back
+     * without reading flash. Older lines spill to flash, so these stay small; with the staging
+     * and cache sectors the scrollback takes about 18 KB of RAM.
+     */
+    static constexpr std::uint32_t LINE_CAPACITY { 512 };
+    static constexpr std::uint32_t TEXT_SIZE { 8 * 1024 };
+
+    /** Flash sectors lines spill to. */
+    static constexpr std::uint32_t SPILL_SECTOR_COUNT { 256 };
+
+    /** Longest encoded line: every character needing three bytes, and a color change each. */
+    static constexpr std::uint32_t MAX_LINE_SIZE { terminal::COLUMNS * 5 };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    scrollback();
+
+    /**
+     * Starts spilling lines to flash, erasing the first spill sector. Until then, lines pushed
+     * out of SRAM are dropped. Call after ospi_flash::init().
+     *
+     * @return whether lines will spill to flash.
+     */
+    bool init();
+
+    /**
+     * Adds a line as the newest, spilling or dropping the oldest if SRAM is full.
+     *
+     * @param[in] cells the line, terminal::COLUMNS cells.
+     */
+    void push(const terminal::Cell *cells);
+
+    /** Number of the oldest line still kept. */
+    std::uint32_t begin() const;
+
+    /** One past the number of the newest line. */
+    std::uint32_t end() const { return _end; }
+
+    /**
+     * Gets a line. Lines in SRAM, and those spilled to the sector last read, are quick; others
+     * read a flash sector, which may first wait out an erase.
+     *
+     * @param      line  the line's number, from begin() up to end().
+     * @param[out] cells terminal::COLUMNS cells; blanks if the line isn't kept or can't be read.
+     *
+     * @return whether the line was found.
+     */
+    bool read(std::uint32_t line, terminal::Cell *cells);
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static_assert(TEXT_SIZE <= 0x10000, "Text offsets are 16 bits");
+    static_assert(MAX_LINE_SIZE < 0xFF, "Spilled lines have a byte of length, and 0xFF is erased flash");
+
+    /** The SRAM ring: encoded text, and where each line in it starts. */
+    std::uint8_t _text[TEXT_SIZE];
+    std::uint16_t _offsets[LINE_CAPACITY];
+    /** Where the next line's text goes, and bytes of text in use. */
+    std::uint16_t _text_end;
+    std::uint32_t _text_used;
+    /** Oldest line in SRAM, and one past the newest. */
+    std::uint32_t _first;
+    std::uint32_t _end;
+
+    /** Whether init() succeeded. */
+    bool _spill_ready;
+    /**
+     * The flash ring. Spilled lines are a length byte then the encoded text, and don't cross
+     * sectors. _head is the sector being filled, staged in SRAM until it's full; _used counts
+     * it and the programmed sectors before it, from the oldest.
+     */
+    std::uint32_t _head;
+    std::uint32_t _used;
+    /** The number of the first line in each sector. */
+    std::uint32_t _sector_first[SPILL_SECTOR_COUNT];
+    std::uint8_t _staging[ospi_flash::SECTOR_SIZE];
+    std::uint32_t _staged;
+
+    /** The programmed sector last read, if any. */
+    std::uint8_t _cache[ospi_flash::SECTOR_SIZE];
+    std::uint32_t _cached_sector;
+    bool _cache_valid;
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Moves the oldest line in SRAM to flash, or drops it. */
+    void evict();
+
+    /** Adds an encoded line to the flash ring, programming the head sector when it's full. */
+    void spill(std::uint32_t line, const std::uint8_t *text, std::size_t size);
+
+    /** Programs the head sector and starts the next, dropping the oldest sector if it's full. */
+    void advance_head();
+
+    /** Stops spilling after a flash error; what was spilled is dropped. */
+    void stop_spilling();
+
+    /** The sector holding the oldest spilled lines. */
+    std::uint32_t oldest_sector() const;
+
+    /** Gets a spilled sector's contents, from staging or the cache. nullptr on a read failure. */
+    const std::uint8_t *sector_data(std::uint32_t sector);
+
+    /** Size of a line's encoded text in SRAM. */
+    std::uint16_t size(std::uint32_t line) const;
+
+    /** Encodes a line of cells; returns the size. */
+    static std::size_t encode(const terminal::Cell *cells, std::uint8_t *out);
+
+    /** Decodes a line; next(i) gives byte i of it. */
+    template<typename F>
+    static void decode(std::size_t size, F &&next, terminal::Cell *cells);
+};
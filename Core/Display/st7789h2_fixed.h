@@ -0,0 +1,240 @@
+/*
+ * st7789h2_fixed.h
+ *
+ * The ST7789H2 drawing functions for an orientation and color format fixed at compile time. The
+ * component driver checks pObj->Orientation on every call to pick the GRAM offsets (the panel's
+ * frame memory is 240x320, so two orientations start 0x50 in) and the MADCTL values; here they
+ * are constants, so a window is just the two commands with their parameters worked out from the
+ * arguments.
+ *
+ * It draws through the component object the BSP set up, and writes its bus IO directly rather
+ * than through the context wrappers, so the BSP and its runtime orientation are left as they are.
+ * The object has to be in the same orientation; see matches(). Nothing waits for the BSP's DMA
+ * transfers, so make sure BSP_LCD_GetTransferStatus() reports none pending before drawing.
+ *
+ * Only used from the thread that owns the LCD. lcd_driver puts the portrait one behind the BSP's
+ * drawing functions.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "stm32l562e_discovery_lcd.h"
+
+#include <cstdint>
+
+template <std::uint32_t ORIENTATION, std::uint32_t FORMAT = ST7789H2_FORMAT_RBG565>
+class st7789h2_fixed {
+    static_assert(ORIENTATION <= ST7789H2_ORIENTATION_LANDSCAPE_ROT180, "unknown orientation");
+    static_assert(FORMAT == ST7789H2_FORMAT_RBG565, "the driver only supports RGB565");
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Size of the screen in pixels. */
+    static constexpr std::uint32_t WIDTH { 240 };
+    static constexpr std::uint32_t HEIGHT { 240 };
+
+    /** Where the screen starts in GRAM; see ST7789H2_SetCursor. */
+    static constexpr std::uint32_t X_OFFSET { (ORIENTATION == ST7789H2_ORIENTATION_LANDSCAPE) ? 0x50U : 0U };
+    static constexpr std::uint32_t Y_OFFSET { (ORIENTATION == ST7789H2_ORIENTATION_PORTRAIT_ROT180) ? 0x50U : 0U };
+
+    /** Bus words per pixel. */
+    static constexpr std::uint32_t PIXEL_WORDS { 1 };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * @param object the component object, e.g. Lcd_CompObj[0] once BSP_LCD_Init() has returned.
+     */
+    explicit st7789h2_fixed(ST7789H2_Object_t &object) : _io { object.IO }, _object { object } {
+
+    }
+
+    /** Whether the component is initialized, and in this orientation. */
+    bool matches() const {
+        return _object.IsInitialized != 0U && _object.Orientation == ORIENTATION;
+    }
+
+    /** Sets the GRAM window written by the next WRITE_RAM; see ST7789H2_SetDisplayWindow. */
+    std::int32_t set_window(std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height) {
+        std::int32_t ret = address(ST7789H2_CASET, x + X_OFFSET, x + X_OFFSET + width - 1U);
+        ret += address(ST7789H2_RASET, y + Y_OFFSET, y + Y_OFFSET + height - 1U);
+        return status(ret);
+    }
+
+    /** Starts the window at x, y and runs it to the end of GRAM; see ST7789H2_SetCursor. */
+    std::int32_t set_cursor(std::uint32_t x, std::uint32_t y) {
+        std::int32_t ret = address(ST7789H2_CASET, x + X_OFFSET, GRAM_X_END);
+        ret += address(ST7789H2_RASET, y + Y_OFFSET, GRAM_Y_END);
+        return status(ret);
+    }
+
+    /** Writes width * height RGB565 pixels as one stream; see ST7789H2_FillRGBRect. */
+    std::int32_t fill_rgb_rect(std::uint32_t x, std::uint32_t y, std::uint8_t *data,
+                               std::uint32_t width, std::uint32_t height) {
+        if (width == 0U || height == 0U) {
+            return ST7789H2_OK;
+        }
+
+        std::int32_t ret = set_window(x, y, width, height);
+        ret += write(ST7789H2_WRITE_RAM, data, width * height * PIXEL_WORDS);
+
+        /* Workaround for the last pixel of the last column, as in the component driver */
+        if (x + width == WIDTH) {
+            ret += set_cursor(x + width - 1U, y + height - 1U);
+            ret += write(ST7789H2_WRITE_RAM, &data[2U * PIXEL_WORDS * (width * height - 1U)], PIXEL_WORDS);
+        }
+
+        return status(ret);
+    }
+
+    /** Fills a rectangle with one color; see ST7789H2_FillRect. */
+    std::int32_t fill_rect(std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height,
+                           std::uint32_t color) {
+        if (width == 0U || height == 0U) {
+            return ST7789H2_OK;
+        }
+
+        std::int32_t ret = set_window(x, y, width, height);
+        ret += fill(static_cast<std::uint16_t>(color), width * height);
+
+        if (x + width == WIDTH) {
+            ret += set_pixel(x + width - 1U, y + height - 1U, color);
+        }
+
+        return status(ret);
+    }
+
+    std::int32_t draw_hline(std::uint32_t x, std::uint32_t y, std::uint32_t length, std::uint32_t color) {
+        return fill_rect(x, y, length, 1U, color);
+    }
+
+    std::int32_t draw_vline(std::uint32_t x, std::uint32_t y, std::uint32_t length, std::uint32_t color) {
+        return fill_rect(x, y, 1U, length, color);
+    }
+
+    std::int32_t set_pixel(std::uint32_t x, std::uint32_t y, std::uint32_t color) {
+        std::int32_t ret = set_cursor(x, y);
+        ret += write(ST7789H2_WRITE_RAM, reinterpret_cast<std::uint8_t *>(&color), PIXEL_WORDS);
+        return status(ret);
+    }
+
+    /**
+     * Draws a 16-bit BMP; see ST7789H2_DrawBitmap. Its rows are bottom up, so it's written with
+     * the row order flipped. Unlike the component driver, the window isn't put back to the whole
+     * of GRAM afterwards: every drawing function sets its own.
+     */
+    std::int32_t draw_bitmap(std::uint32_t x, std::uint32_t y, std::uint8_t *bmp) {
+        const auto size = word(&bmp[2]);
+        const auto index = word(&bmp[10]);
+        const auto width = word(&bmp[18]);
+        const auto height = word(&bmp[22]);
+
+        /* Rows are flipped over the whole of GRAM, offset included */
+        const auto bottom = FLIPPED_ROWS - (y + Y_OFFSET);
+
+        std::int32_t ret = address(ST7789H2_CASET, x + X_OFFSET, x + X_OFFSET + width - 1U);
+        ret += address(ST7789H2_RASET, bottom - (height - 1U), bottom);
+        ret += madctl(MADCTL_FLIPPED);
+        ret += write(ST7789H2_WRITE_RAM, &bmp[index], (size - index) / 2U);
+        ret += madctl(MADCTL);
+
+        return status(ret);
+    }
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static constexpr bool PORTRAIT { ORIENTATION == ST7789H2_ORIENTATION_PORTRAIT ||
+                                     ORIENTATION == ST7789H2_ORIENTATION_PORTRAIT_ROT180 };
+
+    /** Last GRAM column and row addressed in this orientation. */
+    static constexpr std::uint32_t GRAM_X_END { (X_OFFSET != 0U) ? 0x13FU : 0xEFU };
+    static constexpr std::uint32_t GRAM_Y_END { (Y_OFFSET != 0U) ? 0x13FU : 0xEFU };
+
+    /** The row a flipped bitmap's rows are counted back from. */
+    static constexpr std::uint32_t FLIPPED_ROWS { PORTRAIT ? 319U : 239U };
+
+    /** Memory access control for the orientation; see ST7789H2_SetOrientation. */
+    static constexpr std::uint8_t MADCTL {
+        (ORIENTATION == ST7789H2_ORIENTATION_PORTRAIT) ? 0x00U :
+        (ORIENTATION == ST7789H2_ORIENTATION_LANDSCAPE) ? 0xA0U :
+        (ORIENTATION == ST7789H2_ORIENTATION_PORTRAIT_ROT180) ? 0xC0U : 0x60U
+    };
+
+    /** And with the row order reversed, for bitmaps: MY in portrait, MX in landscape. */
+    static constexpr std::uint8_t MADCTL_FLIPPED { static_cast<std::uint8_t>(MADCTL ^ (PORTRAIT ? 0x80U : 0x40U)) };
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ST7789H2_IO_t &_io;
+    ST7789H2_Object_t &_object;
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::int32_t write(std::uint16_t reg, std::uint8_t *data, std::uint32_t words) {
+        return _io.WriteReg(_io.Address, reg, data, words);
+    }
+
+    /** Writes CASET or RASET: a start and end address, each as two words holding a byte. */
+    std::int32_t address(std::uint16_t reg, std::uint32_t start, std::uint32_t end) {
+        std::uint8_t parameter[8] = {
+            static_cast<std::uint8_t>(start >> 8), 0x00, static_cast<std::uint8_t>(start), 0x00,
+            static_cast<std::uint8_t>(end >> 8), 0x00, static_cast<std::uint8_t>(end), 0x00,
+        };
+        return write(reg, parameter, 4);
+    }
+
+    std::int32_t madctl(std::uint8_t value) {
+        std::uint8_t parameter[2] = { value, 0x00 };
+        return write(ST7789H2_MADCTL, parameter, 1);
+    }
+
+    /** Repeats a color into GRAM, from a small buffer if the bus can't fill. */
+    std::int32_t fill(std::uint16_t color, std::uint32_t count) {
+        if (_io.FillReg != nullptr) {
+            return _io.FillReg(_io.Address, ST7789H2_WRITE_RAM, color, count);
+        }
+
+        std::uint16_t buffer[32];
+        for (auto &pixel : buffer) {
+            pixel = color;
+        }
+
+        std::int32_t ret = ST7789H2_OK;
+        std::uint16_t reg = ST7789H2_WRITE_RAM;
+        while (count > 0U) {
+            const auto words = (count < 32U) ? count : 32U;
+            ret += write(reg, reinterpret_cast<std::uint8_t *>(buffer), words);
+            reg = ST7789H2_WRITE_RAM_CONTINUE;
+            count -= words;
+        }
+
+        return ret;
+    }
+
+    static std::uint32_t word(const std::uint8_t *bytes) {
+        return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8) |
+               (static_cast<std::uint32_t>(bytes[2]) << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24);
+    }
+
+    static std::int32_t status(std::int32_t ret) {
+        return (ret != ST7789H2_OK) ? ST7789H2_ERROR : ST7789H2_OK;
+    }
+};
@@ -0,0 +1,224 @@
+/*
+ * status_screen.cpp
+ *
+ * A screen of BLE link status, built from widgets.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "status_screen.h"
+
+extern "C" {
+#   include <bluenrg_def.h>
+}
+
+#include "logger.h"
+#include "stm32_lcd.h"
+#include "stm32l562e_discovery_lcd.h"
+
+#include <algorithm>
+#include <limits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static constexpr std::uint16_t BACKGROUND { canvas::rgb565(UTIL_LCD_COLOR_BLACK) };
+static constexpr std::uint16_t TEXT { canvas::rgb565(UTIL_LCD_COLOR_WHITE) };
+static constexpr std::uint16_t CAPTION { canvas::rgb565(UTIL_LCD_COLOR_LIGHTGRAY) };
+static constexpr std::uint16_t TITLE_BAR { canvas::rgb565(UTIL_LCD_COLOR_DARKBLUE) };
+static constexpr std::uint16_t TRACK { canvas::rgb565(UTIL_LCD_COLOR_DARKGRAY) };
+static constexpr std::uint16_t RSSI_FILL { canvas::rgb565(UTIL_LCD_COLOR_GREEN) };
+static constexpr std::uint16_t RATE_FILL { canvas::rgb565(UTIL_LCD_COLOR_CYAN) };
+static constexpr std::uint16_t EVENTS { canvas::rgb565(UTIL_LCD_COLOR_YELLOW) };
+
+/* Layout: a row per value, the captions on the left and the values right aligned */
+static constexpr std::uint16_t MARGIN { 8 };
+static constexpr std::uint16_t CAPTION_WIDTH { 72 };
+static constexpr std::uint16_t VALUE_X { MARGIN + CAPTION_WIDTH };
+static constexpr std::uint16_t VALUE_WIDTH { compositor::SCREEN_WIDTH - VALUE_X - MARGIN };
+static constexpr std::uint16_t FULL_WIDTH { compositor::SCREEN_WIDTH - 2 * MARGIN };
+static constexpr std::uint16_t BAR_HEIGHT { 6 };
+
+static constexpr std::uint16_t LINK_Y { 32 };
+static constexpr std::uint16_t RSSI_Y { 56 };
+static constexpr std::uint16_t RSSI_BAR_Y { 76 };
+static constexpr std::uint16_t RX_Y { 90 };
+static constexpr std::uint16_t RATE_Y { 114 };
+static constexpr std::uint16_t RATE_BAR_Y { 134 };
+static constexpr std::uint16_t EVENTS_Y { 148 };
+
+/* HCI's RSSI when it isn't known */
+static constexpr std::int8_t RSSI_UNKNOWN { 127 };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static char *append(char *dst, const char *text);
+static char *append_hex(char *dst, std::uint8_t byte);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+status_screen::status_screen() :
+        _active { false }, _total {}, _period_total {}, _period_start_ms {}, _tree {},
+        _title_bar { { 0, 0, compositor::SCREEN_WIDTH, 24 }, TITLE_BAR },
+        _title { { MARGIN, 4, FULL_WIDTH, 16 }, AAFont16, "BLE UART link", TEXT, TITLE_BAR },
+        _link_caption { { MARGIN, LINK_Y, CAPTION_WIDTH, 16 }, AAFont16, "Link", CAPTION, BACKGROUND },
+        _link { { VALUE_X, LINK_Y, VALUE_WIDTH, 16 }, AAFont16, "advertising", TEXT, BACKGROUND,
+                text_widget::Align::RIGHT },
+        _rssi_caption { { MARGIN, RSSI_Y, CAPTION_WIDTH, 16 }, AAFont16, "RSSI", CAPTION, BACKGROUND },
+        _rssi { { VALUE_X, RSSI_Y, VALUE_WIDTH, 16 }, AAFont16, 0, " dBm", TEXT, BACKGROUND },
+        _rssi_bar { { MARGIN, RSSI_BAR_Y, FULL_WIDTH, BAR_HEIGHT }, RSSI_MIN, RSSI_MAX, RSSI_FILL, TRACK },
+        _rx_caption { { MARGIN, RX_Y, CAPTION_WIDTH, 16 }, AAFont16, "RX", CAPTION, BACKGROUND },
+        _rx { { VALUE_X, RX_Y, VALUE_WIDTH, 16 }, AAFont16, 0, " B", TEXT, BACKGROUND },
+        _rate_caption { { MARGIN, RATE_Y, CAPTION_WIDTH, 16 }, AAFont16, "Rate", CAPTION, BACKGROUND },
+        _rate { { VALUE_X, RATE_Y, VALUE_WIDTH, 16 }, AAFont16, 0, " B/s", TEXT, BACKGROUND },
+        _rate_bar { { MARGIN, RATE_BAR_Y, FULL_WIDTH, BAR_HEIGHT }, 0, RATE_MAX, RATE_FILL, TRACK },
+        _rule { { 0, EVENTS_Y - 4, compositor::SCREEN_WIDTH, 1 }, TRACK },
+        _events { { MARGIN, EVENTS_Y, FULL_WIDTH, compositor::SCREEN_HEIGHT - EVENTS_Y }, AAFont12,
+                  EVENTS, BACKGROUND } {
+
+    _tree.set_background(BACKGROUND);
+    _tree.add(_title_bar);
+    _tree.add(_title, &_title_bar);
+    _tree.add(_link_caption);
+    _tree.add(_link);
+    _tree.add(_rssi_caption);
+    _tree.add(_rssi);
+    _tree.add(_rssi_bar);
+    _tree.add(_rx_caption);
+    _tree.add(_rx);
+    _tree.add(_rate_caption);
+    _tree.add(_rate);
+    _tree.add(_rate_bar);
+    _tree.add(_rule);
+    _tree.add(_events);
+}
+
+void status_screen::register_callbacks() {
+    ble::register_callback(ble_event, this);
+    ble::set_rssi_callback(rssi, this);
+}
+
+void status_screen::show() {
+    _active = true;
+
+    /* The screen is laid out where it's shown, whatever the terminal scrolled to */
+    BSP_LCD_SetScrollStart(0, 0);
+    _tree.show();
+}
+
+void status_screen::hide() {
+    if (!_active) {
+        return;
+    }
+    _active = false;
+
+    const auto stats = _tree.stats();
+    LOG("status: %lu frames, %lu late, %lu fps\n", static_cast<unsigned long>(stats.frames),
+            static_cast<unsigned long>(stats.late_frames), static_cast<unsigned long>(stats.fps));
+}
+
+void status_screen::received(std::size_t bytes, std::uint32_t now_ms) {
+    _total += static_cast<std::uint32_t>(bytes);
+    _rx.set(static_cast<std::int32_t>(std::min<std::uint32_t>(_total, std::numeric_limits<std::int32_t>::max())));
+
+    const auto elapsed = now_ms - _period_start_ms;
+    if (elapsed >= RATE_PERIOD_MS) {
+        const auto rate = static_cast<std::int32_t>(
+                static_cast<std::uint64_t>(_total - _period_total) * 1000U / elapsed);
+        _rate.set(rate);
+        _rate_bar.set(rate);
+        _period_total = _total;
+        _period_start_ms = now_ms;
+    }
+
+    /* Take the values while hidden too, so no event lines are dropped */
+    if (!_active) {
+        _tree.update();
+    }
+}
+
+std::size_t status_screen::render() {
+    return _active ? _tree.render() : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* On the BLE thread: only sets values, and formats without printf to spare its stack */
+void status_screen::ble_event(void *context, hci_uart_pckt *data) {
+    auto *screen = reinterpret_cast<status_screen *>(context);
+
+    if (data->type != HCI_EVENT_PKT) {
+        return;
+    }
+
+    auto *hci_packet = reinterpret_cast<hci_event_pckt *>(data->data);
+    char line[text_pane::MAX_COLUMNS + 1];
+
+    if (hci_packet->evt == EVT_DISCONN_COMPLETE) {
+        auto *disconn_event = reinterpret_cast<evt_disconn_complete *>(hci_packet->data);
+        *append_hex(append(line, "Disconnected, reason "), disconn_event->reason) = '\0';
+
+        screen->_link.set_text("disconnected");
+        screen->_rssi.set(0);
+        screen->_rssi_bar.set(RSSI_MIN);
+        screen->_events.add_line(line);
+    } else if (hci_packet->evt == EVT_LE_META_EVENT) {
+        auto *le_event = reinterpret_cast<evt_le_meta_event *>(hci_packet->data);
+        if (le_event->subevent != EVT_LE_CONN_COMPLETE) {
+            return;
+        }
+
+        auto *conn_event = reinterpret_cast<evt_le_connection_complete *>(le_event->data);
+        if (conn_event->status != BLE_STATUS_SUCCESS) {
+            *append_hex(append(line, "Connect failed: "), conn_event->status) = '\0';
+            screen->_events.add_line(line);
+            return;
+        }
+
+        auto *end = append(line, "Peer ");
+        for (auto i = ble::BDADDR_SIZE; i-- > 0;) {
+            end = append_hex(end, conn_event->peer_bdaddr[i]);
+            if (i > 0) {
+                *end++ = ':';
+            }
+        }
+        *end = '\0';
+
+        screen->_link.set_text("connected");
+        screen->_events.add_line(line);
+    }
+}
+
+void status_screen::rssi(void *context, std::int8_t rssi) {
+    auto *screen = reinterpret_cast<status_screen *>(context);
+
+    if (rssi == RSSI_UNKNOWN) {
+        return;
+    }
+
+    screen->_rssi.set(rssi);
+    screen->_rssi_bar.set(rssi);
+}
+
+/* Copies a C-string without its terminator, returns where it ended */
+static char *append(char *dst, const char *text) {
+    while (*text != '\0') {
+        *dst++ = *text++;
+    }
+    return dst;
+}
+
+static char *append_hex(char *dst, std::uint8_t byte) {
+    static constexpr char DIGITS[] { "0123456789ABCDEF" };
+    *dst++ = DIGITS[byte >> 4];
+    *dst++ = DIGITS[byte & 0x0F];
+    return dst;
+}
@@ -0,0 +1,127 @@
+/*
+ * status_screen.h
+ *
+ * A screen of BLE link status, built from widgets (see widgets.h): the link state, the RSSI, the
+ * bytes received and the rate they're coming in at, and a pane of link events.
+ *
+ * The link state, RSSI and events come from BLE callbacks, on the BLE thread; they only set the
+ * widgets' values. The screen is drawn by the thread that owns the LCD, and only where a value
+ * changed.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "ble.h"
+#include "widgets.h"
+
+#include <cstddef>
+#include <cstdint>
+
+class status_screen {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** RSSI shown as an empty and a full bar, in dBm. */
+    static constexpr std::int32_t RSSI_MIN { -100 };
+    static constexpr std::int32_t RSSI_MAX { -30 };
+
+    /** Rate shown as a full bar, in bytes per second. */
+    static constexpr std::int32_t RATE_MAX { 4000 };
+
+    /** Milliseconds the rate is averaged over. */
+    static constexpr std::uint32_t RATE_PERIOD_MS { 1000 };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    status_screen();
+
+    /** Registers for BLE events and RSSI readings. Call before the BLE thread starts. */
+    void register_callbacks();
+
+    /** Draws the whole screen, then keeps it up to date on render(). */
+    void show();
+
+    /**
+     * Sets whether frames are timed against the panel refresh, to keep them from tearing. Only
+     * enable it once vsync::init() has succeeded.
+     */
+    void set_vsync(bool enable) { _tree.set_vsync(enable); }
+
+    /**
+     * Stops drawing, and reports the frames drawn so far over the logger. Whatever takes the
+     * screen over has to redraw it.
+     */
+    void hide();
+
+    /** Whether the screen is shown. */
+    bool active() const { return _active; }
+
+    /**
+     * Counts bytes received over BLE UART. Call regularly, with 0 if nothing arrived, so the rate
+     * falls when the data stops.
+     *
+     * @param bytes  the number of bytes received since the last call.
+     * @param now_ms the tick count, in milliseconds.
+     */
+    void received(std::size_t bytes, std::uint32_t now_ms);
+
+    /**
+     * Draws what changed since the last render.
+     *
+     * @return the number of tiles drawn.
+     */
+    std::size_t render();
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool _active;
+
+    /** Bytes received, and at the start of the current rate period. */
+    std::uint32_t _total;
+    std::uint32_t _period_total;
+    std::uint32_t _period_start_ms;
+
+    widget_tree _tree;
+
+    panel _title_bar;
+    label _title;
+
+    label _link_caption;
+    label _link;
+
+    label _rssi_caption;
+    value_label _rssi;
+    bar _rssi_bar;
+
+    label _rx_caption;
+    value_label _rx;
+
+    label _rate_caption;
+    value_label _rate;
+    bar _rate_bar;
+
+    panel _rule;
+    text_pane _events;
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** BLE event callback; context is the status_screen. */
+    static void ble_event(void *context, hci_uart_pckt *data);
+
+    /** BLE RSSI callback; context is the status_screen. */
+    static void rssi(void *context, std::int8_t rssi);
+};
@@ -0,0 +1,324 @@
+/*
+ * strip_chart.cpp
+ *
+ * A live plot of numbers received one per line.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "strip_chart.h"
+
+#include "canvas.h"
+#include "cycles.h"
+#include "logger.h"
+#include "stm32_lcd.h"
+#include "stm32l562e_discovery_lcd.h"
+
+#include <algorithm>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static constexpr std::uint32_t BACKGROUND { UTIL_LCD_COLOR_BLACK };
+static constexpr std::uint32_t GRID { UTIL_LCD_COLOR_DARKGRAY };
+static constexpr std::uint32_t TRACE { UTIL_LCD_COLOR_GREEN };
+
+/* Rows between grid lines */
+static constexpr std::uint32_t GRID_SPACING { strip_chart::HEIGHT / strip_chart::GRID_BANDS };
+
+/* Exponents past this overflow a float anyway */
+static constexpr std::int32_t MAX_EXPONENT { 99 };
+
+/* A column as it's drawn */
+alignas(4) static std::uint16_t g_column[strip_chart::HEIGHT];
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::uint16_t background(std::uint32_t y);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+strip_chart::strip_chart() :
+        _active { false }, _field { Field::LEADING }, _negative { false }, _exponent_negative { false },
+        _digits {}, _exponent_digits {}, _mantissa {}, _exponent {}, _scale {},
+        _values {}, _taken {}, _drawn {}, _min {}, _max {}, _rescale { false }, _spans {},
+        _bad_lines {}, _rescales {}, _frames {}, _most_per_frame {}, _slowest_us {} {
+
+}
+
+void strip_chart::start() {
+    _active = true;
+    _field = Field::LEADING;
+    _negative = false;
+    _exponent_negative = false;
+    _digits = 0;
+    _exponent_digits = 0;
+    _mantissa = 0;
+    _exponent = 0;
+    _scale = 0;
+
+    _taken = 0;
+    _drawn = 0;
+    _rescale = false;
+    std::fill_n(_spans, WIDTH, Span { 1, 0 });
+
+    _bad_lines = 0;
+    _rescales = 0;
+    _frames = 0;
+    _most_per_frame = 0;
+    _slowest_us = 0;
+
+    /* The chart is drawn where it's shown, whatever the terminal scrolled to */
+    BSP_LCD_SetScrollStart(0, 0);
+    UTIL_LCD_FillRect(0, 0, WIDTH, HEIGHT, BACKGROUND);
+    for (auto y = GRID_SPACING; y < HEIGHT; y += GRID_SPACING) {
+        UTIL_LCD_FillRect(0, y, WIDTH, 1, GRID);
+    }
+}
+
+std::size_t strip_chart::feed(const char *data, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        if (data[i] == '\x1B') {
+            stop();
+            return i;
+        }
+        parse(data[i]);
+    }
+
+    return size;
+}
+
+std::size_t strip_chart::render() {
+    if (!_active || (_drawn == _taken && !_rescale)) {
+        return 0;
+    }
+
+    const auto start = cycles::now();
+    const auto count = _taken - _drawn;
+    std::size_t drawn = 0;
+
+    /* Samples that came in faster than they could be drawn wrap over each other */
+    if (_rescale || count > SHOWN_SAMPLES) {
+        redraw();
+        drawn = WIDTH;
+    } else {
+        for (; _drawn != _taken; ++_drawn) {
+            draw_column(_drawn % WIDTH, trace(_drawn), false);
+            draw_column((_drawn + GAP_COLUMNS) % WIDTH, Span { 1, 0 }, false);
+            drawn += 2;
+        }
+    }
+
+    const auto us = static_cast<std::uint32_t>(cycles::to_us(cycles::now() - start));
+    ++_frames;
+    _most_per_frame = std::max(_most_per_frame, count);
+    _slowest_us = std::max(_slowest_us, us);
+
+    return drawn;
+}
+
+void strip_chart::stop() {
+    if (!_active) {
+        return;
+    }
+    _active = false;
+
+    LOG("plot: %lu samples, %lu lines skipped, %lu rescales\n",
+            static_cast<unsigned long>(_taken), static_cast<unsigned long>(_bad_lines),
+            static_cast<unsigned long>(_rescales));
+    LOG("plot: %lu frames, up to %lu samples a frame, slowest %lu us\n",
+            static_cast<unsigned long>(_frames), static_cast<unsigned long>(_most_per_frame),
+            static_cast<unsigned long>(_slowest_us));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void strip_chart::parse(char c) {
+    if (c == '\n') {
+        end_line();
+        return;
+    }
+
+    const bool space = c == ' ' || c == '\t' || c == '\r';
+    const bool digit = c >= '0' && c <= '9';
+
+    switch (_field) {
+        case Field::LEADING:
+            if (space) {
+                break;
+            }
+            _field = Field::INTEGER;
+            if (c == '-' || c == '+') {
+                _negative = c == '-';
+                break;
+            }
+            [[fallthrough]];
+
+        case Field::INTEGER:
+        case Field::FRACTION:
+            if (digit) {
+                /* Digits past what a float holds only scale the number */
+                if (++_digits <= MAX_DIGITS) {
+                    _mantissa = _mantissa * 10 + static_cast<float>(c - '0');
+                    _scale += (_field == Field::FRACTION) ? 1 : 0;
+                } else if (_field == Field::INTEGER) {
+                    --_scale;
+                }
+            } else if (c == '.' && _field == Field::INTEGER) {
+                _field = Field::FRACTION;
+            } else if ((c == 'e' || c == 'E') && _digits > 0) {
+                _field = Field::EXPONENT_SIGN;
+            } else if (space && _digits > 0) {
+                _field = Field::TRAILING;
+            } else {
+                _field = Field::BAD;
+            }
+            break;
+
+        case Field::EXPONENT_SIGN:
+            _field = Field::EXPONENT;
+            if (c == '-' || c == '+') {
+                _exponent_negative = c == '-';
+                break;
+            }
+            [[fallthrough]];
+
+        case Field::EXPONENT:
+            if (digit) {
+                _exponent = std::min(_exponent * 10 + (c - '0'), MAX_EXPONENT);
+                ++_exponent_digits;
+            } else if (space && _exponent_digits > 0) {
+                _field = Field::TRAILING;
+            } else {
+                _field = Field::BAD;
+            }
+            break;
+
+        case Field::TRAILING:
+            if (!space) {
+                _field = Field::BAD;
+            }
+            break;
+
+        case Field::BAD:
+            break;
+    }
+}
+
+void strip_chart::end_line() {
+    const bool number = _digits > 0 &&
+            (_field == Field::INTEGER || _field == Field::FRACTION || _field == Field::TRAILING ||
+             (_field == Field::EXPONENT && _exponent_digits > 0));
+
+    if (number) {
+        auto power = (_exponent_negative ? -_exponent : _exponent) - _scale;
+        auto value = _mantissa;
+        for (; power > 0; --power) {
+            value *= 10;
+        }
+        for (; power < 0; ++power) {
+            value /= 10;
+        }
+
+        if (std::isfinite(value)) {
+            sample(_negative ? -value : value);
+        } else {
+            ++_bad_lines;
+        }
+    } else if (_field != Field::LEADING) {
+        /* Blank lines don't count */
+        ++_bad_lines;
+    }
+
+    _field = Field::LEADING;
+    _negative = false;
+    _exponent_negative = false;
+    _digits = 0;
+    _exponent_digits = 0;
+    _mantissa = 0;
+    _exponent = 0;
+    _scale = 0;
+}
+
+void strip_chart::sample(float value) {
+    if (_taken == 0) {
+        const auto margin = std::max(std::fabs(value) / 10, 1.0f);
+        _min = value - margin;
+        _max = value + margin;
+        _rescale = true;
+    } else if (value < _min || value > _max) {
+        const auto margin = (std::max(_max, value) - std::min(_min, value)) / 10;
+        _min = std::min(_min, value - margin);
+        _max = std::max(_max, value + margin);
+        _rescale = true;
+        ++_rescales;
+    }
+
+    _values[_taken % WIDTH] = value;
+    ++_taken;
+}
+
+std::uint16_t strip_chart::row(float value) const {
+    const auto y = (_max - value) / (_max - _min) * (HEIGHT - 1) + 0.5f;
+    return static_cast<std::uint16_t>(std::clamp(y, 0.0f, HEIGHT - 1.0f));
+}
+
+strip_chart::Span strip_chart::trace(std::uint32_t sample) const {
+    const auto y = row(_values[sample % WIDTH]);
+    const auto previous = (sample == 0) ? y : row(_values[(sample - 1) % WIDTH]);
+    return { std::min(y, previous), std::max(y, previous) };
+}
+
+void strip_chart::draw_column(std::uint32_t x, Span trace, bool whole) {
+    auto &drawn = _spans[x];
+
+    /* Rows traced before have to be erased, rows to trace drawn */
+    Span area { 0, HEIGHT - 1 };
+    if (!whole) {
+        if (drawn.empty()) {
+            area = trace;
+        } else if (trace.empty()) {
+            area = drawn;
+        } else {
+            area = { std::min(drawn.top, trace.top), std::max(drawn.bottom, trace.bottom) };
+        }
+    }
+    drawn = trace;
+
+    if (area.empty()) {
+        return;
+    }
+
+    for (std::uint32_t y = area.top; y <= area.bottom; ++y) {
+        g_column[y] = (y >= trace.top && y <= trace.bottom) ? canvas::rgb565(TRACE) : background(y);
+    }
+
+    UTIL_LCD_FillRGBRect(x, area.top, reinterpret_cast<std::uint8_t *>(&g_column[area.top]),
+                         1, area.bottom - area.top + 1U);
+}
+
+void strip_chart::redraw() {
+    const auto first = (_taken > SHOWN_SAMPLES) ? _taken - SHOWN_SAMPLES : 0;
+
+    /* Each column holds at most one of the samples shown */
+    for (std::uint32_t x = 0; x < WIDTH; ++x) {
+        const auto sample = first + (x + WIDTH - first % WIDTH) % WIDTH;
+        draw_column(x, (sample < _taken) ? trace(sample) : Span { 1, 0 }, true);
+    }
+
+    _drawn = _taken;
+    _rescale = false;
+}
+
+static std::uint16_t background(std::uint32_t y) {
+    return (y % GRID_SPACING == 0 && y != 0) ? canvas::rgb565(GRID) : canvas::rgb565(BACKGROUND);
+}
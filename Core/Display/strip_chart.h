@@ -0,0 +1,179 @@
+/*
+ * strip_chart.h
+ *
+ * A live plot of numbers received one per line, e.g. telemetry over BLE UART. The chart sweeps
+ * across the screen like a scope: each sample goes in the next column, wrapping around at the
+ * right edge, with a few blank columns ahead of the newest one. Nothing is moved, so a sample
+ * costs two column writes: its own column, from the line back to the previous sample, and the
+ * column at the far end of the gap. Each only covers the rows that were or will be traced, not
+ * the whole height. The panel only scrolls vertically in portrait, so hardware scrolling can't
+ * move the time axis here.
+ *
+ * The vertical range follows the samples: it widens, and the chart is redrawn, when one falls
+ * outside it. A line that isn't a number (an optional sign, digits with an optional point and
+ * exponent, and spaces around them) is skipped.
+ *
+ * When the chart stops, it reports the samples taken, and how long the slowest frame took, over
+ * the logger.
+ *
+ * Draws through the stm32_lcd utilities, so only use it from the thread that owns the LCD.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class strip_chart {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Size of the chart in pixels; it covers the screen. */
+    static constexpr std::uint32_t WIDTH { 240 };
+    static constexpr std::uint32_t HEIGHT { 240 };
+
+    /** Blank columns ahead of the newest sample. */
+    static constexpr std::uint32_t GAP_COLUMNS { 8 };
+
+    /** Samples shown at once. */
+    static constexpr std::uint32_t SHOWN_SAMPLES { WIDTH - GAP_COLUMNS };
+
+    /** Horizontal grid lines divide the height into this many bands. */
+    static constexpr std::uint32_t GRID_BANDS { 4 };
+
+    /** Digits of a number kept; any after them only scale it. */
+    static constexpr std::uint32_t MAX_DIGITS { 16 };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    strip_chart();
+
+    /** Clears the screen to an empty chart and starts taking samples. */
+    void start();
+
+    /** Whether the chart is taking samples. */
+    bool active() const { return _active; }
+
+    /**
+     * Parses received text for samples. An ESC stops the chart, and it and what follows aren't
+     * taken; they're for the terminal.
+     *
+     * @param[in] data the text.
+     * @param     size the number of bytes.
+     *
+     * @return the number of bytes taken.
+     */
+    std::size_t feed(const char *data, std::size_t size);
+
+    /**
+     * Draws the samples taken since the last render.
+     *
+     * @return the number of columns drawn.
+     */
+    std::size_t render();
+
+    /** Stops taking samples, and reports on them. The chart stays on the screen. */
+    void stop();
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Where a line of text is in a number. */
+    enum class Field : std::uint8_t {
+        LEADING,
+        INTEGER,
+        FRACTION,
+        EXPONENT_SIGN,
+        EXPONENT,
+        TRAILING,
+        BAD,
+    };
+
+    /** Rows traced in a column; empty if top is below bottom. */
+    struct Span {
+        std::uint16_t top;
+        std::uint16_t bottom;
+
+        bool empty() const { return top > bottom; }
+    };
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool _active;
+
+    /** The number being parsed. */
+    Field _field;
+    bool _negative;
+    bool _exponent_negative;
+    std::uint32_t _digits;
+    std::uint32_t _exponent_digits;
+    float _mantissa;
+    std::int32_t _exponent;
+    /** Powers of ten the mantissa is over the number, before the exponent. */
+    std::int32_t _scale;
+
+    /** The last WIDTH samples, by column, and how many have been taken and drawn. */
+    float _values[WIDTH];
+    std::uint32_t _taken;
+    std::uint32_t _drawn;
+
+    /** Values at the top and bottom row, and whether the chart has to be redrawn for them. */
+    float _min;
+    float _max;
+    bool _rescale;
+
+    /** What each column has traced. */
+    Span _spans[WIDTH];
+
+    /** For the report when the chart stops. */
+    std::uint32_t _bad_lines;
+    std::uint32_t _rescales;
+    std::uint32_t _frames;
+    std::uint32_t _most_per_frame;
+    std::uint32_t _slowest_us;
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Takes a character of a line. */
+    void parse(char c);
+
+    /** Takes the line parsed, if it was a number. */
+    void end_line();
+
+    /** Adds a sample, widening the range if it's outside. */
+    void sample(float value);
+
+    /** The row a value is drawn at. */
+    std::uint16_t row(float value) const;
+
+    /** The rows a sample traces, from the sample before it. */
+    Span trace(std::uint32_t sample) const;
+
+    /**
+     * Draws a column: the trace, and the background where the column had traced before.
+     *
+     * @param x     the column.
+     * @param trace the rows to trace.
+     * @param whole whether to draw the whole height, not just what changed.
+     */
+    void draw_column(std::uint32_t x, Span trace, bool whole);
+
+    /** Draws every column, for a new range. */
+    void redraw();
+};
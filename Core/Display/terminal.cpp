@@ -0,0 +1,816 @@
+/*
+ * terminal.cpp
+ *
+ * A character cell terminal drawn on the LCD.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "terminal.h"
+
+#include "canvas.h"
+#include "cycles.h"
+#include "logger.h"
+#include "scrollback.h"
+#include "stm32_lcd.h"
+#include "stm32l562e_discovery_lcd.h"
+#include "unicode_font.h"
+
+#include <algorithm>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* ARGB8888 for each terminal::Color */
+static constexpr std::uint32_t PALETTE[] = {
+    UTIL_LCD_COLOR_BLACK,
+    UTIL_LCD_COLOR_RED,
+    UTIL_LCD_COLOR_GREEN,
+    UTIL_LCD_COLOR_YELLOW,
+    UTIL_LCD_COLOR_BLUE,
+    UTIL_LCD_COLOR_MAGENTA,
+    UTIL_LCD_COLOR_CYAN,
+    UTIL_LCD_COLOR_WHITE,
+    UTIL_LCD_COLOR_GRAY,
+    UTIL_LCD_COLOR_LIGHTRED,
+    UTIL_LCD_COLOR_LIGHTGREEN,
+    UTIL_LCD_COLOR_LIGHTYELLOW,
+    UTIL_LCD_COLOR_LIGHTBLUE,
+    UTIL_LCD_COLOR_LIGHTMAGENTA,
+    UTIL_LCD_COLOR_LIGHTCYAN,
+    UTIL_LCD_COLOR_WHITE,
+};
+
+/* Colors after SGR 0, 39 and 49 */
+static constexpr terminal::Color DEFAULT_FG { terminal::Color::WHITE };
+static constexpr terminal::Color DEFAULT_BG { terminal::Color::BLACK };
+
+/* Levels of the 6x6x6 color cube in the 256-color palette */
+static constexpr std::uint8_t CUBE_LEVELS[] = { 0, 95, 135, 175, 215, 255 };
+
+/* Characters per render in the benchmark; about what one BLE write carries. */
+static constexpr std::uint32_t BENCHMARK_CHUNK { 20 };
+
+/* A line of pixels drawn by draw_line(); the margin right of the last column is background */
+static std::uint16_t g_line_pixels[terminal::SCREEN_WIDTH * terminal::CELL_HEIGHT];
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static terminal::Color nearest_color(std::uint32_t red, std::uint32_t green, std::uint32_t blue);
+static terminal::Color indexed_color(std::uint32_t index);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+terminal::terminal() :
+        _cells {}, _drawn {}, _dirty_rows {}, _erased { false }, _erased_to {},
+        _hw_scroll { false }, _scroll_top { 0 }, _scroll_bottom { ROWS }, _scroll_area_changed { false },
+        _top {}, _shown_top {},
+        _row {}, _column {}, _saved_row {}, _saved_column {},
+        _fg { DEFAULT_FG }, _bg { DEFAULT_BG }, _bold { false }, _reverse { false },
+        _ansi {}, _utf8 {}, _scrollback { nullptr }, _image_pending { false }, _image_x {}, _image_y {},
+        _plot_pending { false }, _status_pending { false } {
+
+}
+
+void terminal::clear() {
+    const Cell blank { ' ', _fg, _bg };
+
+    for (std::uint32_t row = 0; row < ROWS; ++row) {
+        for (std::uint32_t column = 0; column < COLUMNS; ++column) {
+            _cells[row][column] = blank;
+            _drawn[row][column] = blank;
+        }
+    }
+
+    /* One fill is much cheaper than drawing every blank cell */
+    UTIL_LCD_Clear(PALETTE[static_cast<std::uint8_t>(_bg)]);
+
+    /* Not available in landscape; the terminal then redraws rows to scroll */
+    _hw_scroll = BSP_LCD_SetScrollArea(0, 0, ROWS * CELL_HEIGHT) == BSP_ERROR_NONE;
+    _scroll_top = 0;
+    _scroll_bottom = ROWS;
+    _scroll_area_changed = false;
+    _top = 0;
+    _shown_top = 0;
+
+    _dirty_rows = 0;
+    _erased = false;
+    _row = 0;
+    _column = 0;
+    _saved_row = 0;
+    _saved_column = 0;
+
+    _ansi.reset();
+    _utf8.reset();
+    _image_pending = false;
+    _plot_pending = false;
+    _status_pending = false;
+}
+
+void terminal::set_colors(Color fg, Color bg) {
+    _fg = fg;
+    _bg = bg;
+}
+
+void terminal::write(char c) {
+    const auto byte = static_cast<std::uint8_t>(c);
+
+    switch (_ansi.feed(byte)) {
+        case ansi_parser::Action::PRINT:
+            _utf8.feed(byte, [this](char32_t decoded) { put(decoded); });
+            break;
+
+        case ansi_parser::Action::EXECUTE:
+            execute(c);
+            break;
+
+        case ansi_parser::Action::ESC_DISPATCH:
+            esc_dispatch(c);
+            break;
+
+        case ansi_parser::Action::CSI_DISPATCH:
+            csi_dispatch(c);
+            break;
+
+        case ansi_parser::Action::NONE:
+            break;
+    }
+}
+
+std::size_t terminal::write(const char *src, std::size_t amount) {
+    for (std::size_t i = 0; i < amount; ++i) {
+        write(src[i]);
+        if (_image_pending || _plot_pending || _status_pending) {
+            return i + 1;
+        }
+    }
+    return amount;
+}
+
+bool terminal::take_image(std::uint32_t &x, std::uint32_t &y) {
+    if (!_image_pending) {
+        return false;
+    }
+
+    x = _image_x;
+    y = _image_y;
+    _image_pending = false;
+    return true;
+}
+
+bool terminal::take_plot() {
+    const bool pending = _plot_pending;
+    _plot_pending = false;
+    return pending;
+}
+
+bool terminal::take_status() {
+    const bool pending = _status_pending;
+    _status_pending = false;
+    return pending;
+}
+
+std::uint32_t terminal::gram_row(std::uint32_t y) const {
+    if (y >= ROWS * CELL_HEIGHT) {
+        return y;
+    }
+    return screen_row(y / CELL_HEIGHT) * CELL_HEIGHT + y % CELL_HEIGHT;
+}
+
+std::size_t terminal::render() {
+    std::size_t drawn = 0;
+
+    if (_scroll_area_changed) {
+        BSP_LCD_SetScrollArea(0, _scroll_top * CELL_HEIGHT, (_scroll_bottom - _scroll_top) * CELL_HEIGHT);
+        _scroll_area_changed = false;
+        _shown_top = 0;
+    }
+
+    if (_top != _shown_top) {
+        BSP_LCD_SetScrollStart(0, _top * CELL_HEIGHT);
+        _shown_top = _top;
+    }
+
+    if (_erased) {
+        UTIL_LCD_FillRect(0, 0, SCREEN_WIDTH, ROWS * CELL_HEIGHT, PALETTE[static_cast<std::uint8_t>(_erased_to.bg)]);
+        for (std::uint32_t row = 0; row < ROWS; ++row) {
+            std::fill_n(_drawn[row], COLUMNS, _erased_to);
+        }
+        _erased = false;
+    }
+
+    while (_dirty_rows != 0) {
+        const auto row = static_cast<std::uint32_t>(__builtin_ctz(_dirty_rows));
+        _dirty_rows &= ~(1U << row);
+
+        for (std::uint32_t column = 0; column < COLUMNS;) {
+            const auto cell = _cells[row][column];
+            auto end = column + 1;
+
+            if (cell == _drawn[row][column]) {
+                column = end;
+                continue;
+            }
+
+            /* A run of erased cells is one fill rather than a glyph each */
+            if (cell.ch == u' ') {
+                while (end < COLUMNS && _cells[row][end] == cell && _drawn[row][end] != cell) {
+                    ++end;
+                }
+            }
+
+            if (end - column > 1) {
+                UTIL_LCD_FillRect(column * CELL_WIDTH, screen_row(row) * CELL_HEIGHT,
+                                  (end - column) * CELL_WIDTH, CELL_HEIGHT, PALETTE[static_cast<std::uint8_t>(cell.bg)]);
+            } else {
+                draw_cell(row, column, cell);
+            }
+
+            for (; column < end; ++column) {
+                _drawn[row][column] = cell;
+                ++drawn;
+            }
+        }
+    }
+
+    return drawn;
+}
+
+void terminal::redraw() {
+    for (std::uint32_t row = 0; row < ROWS; ++row) {
+        std::fill_n(_drawn[row], COLUMNS, Cell { 0, Color::BLACK, Color::BLACK });
+    }
+    _dirty_rows = (1U << ROWS) - 1;
+
+    /* Rows go back where an unscrolled scroll area expects them */
+    _top = 0;
+    _scroll_area_changed = _hw_scroll;
+}
+
+void terminal::draw_line(const Cell *cells, std::uint32_t first, std::uint32_t last, std::uint32_t y) {
+    for (std::uint32_t column = 0; column < COLUMNS; ++column) {
+        const auto &cell = cells[column];
+        UnicodeFont16.decode(cell.ch, &g_line_pixels[column * CELL_WIDTH], SCREEN_WIDTH,
+                             canvas::rgb565(PALETTE[static_cast<std::uint8_t>(cell.fg)]),
+                             canvas::rgb565(PALETTE[static_cast<std::uint8_t>(cell.bg)]));
+    }
+
+    const auto margin = canvas::rgb565(PALETTE[static_cast<std::uint8_t>(DEFAULT_BG)]);
+    for (auto row = first; row < last; ++row) {
+        std::fill(&g_line_pixels[row * SCREEN_WIDTH + COLUMNS * CELL_WIDTH],
+                  &g_line_pixels[(row + 1) * SCREEN_WIDTH], margin);
+    }
+
+    UTIL_LCD_FillRGBRect(0, y, reinterpret_cast<std::uint8_t *>(&g_line_pixels[first * SCREEN_WIDTH]),
+                         SCREEN_WIDTH, last - first);
+}
+
+void terminal::benchmark(std::uint32_t amount) {
+    clear();
+
+    std::uint32_t cells = 0;
+    char chunk[BENCHMARK_CHUNK];
+    char next = ' ';
+
+    const auto start = cycles::now();
+
+    for (std::uint32_t written = 0; written < amount; written += BENCHMARK_CHUNK) {
+        /* Printable characters with a newline every 40, so lines wrap and the screen scrolls */
+        for (std::uint32_t i = 0; i < BENCHMARK_CHUNK; ++i) {
+            if ((written + i) % 40 == 39) {
+                chunk[i] = '\n';
+            } else {
+                chunk[i] = next;
+                next = (next == '~') ? ' ' : static_cast<char>(next + 1);
+            }
+        }
+
+        write(chunk, BENCHMARK_CHUNK);
+        cells += render();
+    }
+
+    const auto us = cycles::to_us(cycles::now() - start) + 1;
+    const auto written = ((amount + BENCHMARK_CHUNK - 1) / BENCHMARK_CHUNK) * BENCHMARK_CHUNK;
+
+    LOG("terminal: %lu chars, %lu cells drawn in %lu us: %lu chars/s, %lu cells/s\n",
+            static_cast<unsigned long>(written), static_cast<unsigned long>(cells),
+            static_cast<unsigned long>(us),
+            static_cast<unsigned long>(written * 1000000ULL / us),
+            static_cast<unsigned long>(cells * 1000000ULL / us));
+
+    clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void terminal::put(char32_t c) {
+    /* C1 controls; only their 7-bit ESC forms are supported */
+    if (c >= 0x80 && c < 0xA0) {
+        return;
+    }
+
+    /* Wrap lazily so text ending exactly at the last column doesn't leave a blank line */
+    if (_column >= COLUMNS) {
+        newline();
+    }
+
+    auto fg = _fg;
+    auto bg = _bg;
+    if (_bold && fg < Color::BRIGHT_BLACK) {
+        fg = static_cast<Color>(static_cast<std::uint8_t>(fg) + 8);
+    }
+    if (_reverse) {
+        std::swap(fg, bg);
+    }
+
+    if (c > 0xFFFF) {
+        c = utf8_decoder::REPLACEMENT;
+    }
+    _cells[_row][_column] = { static_cast<char16_t>(c), fg, bg };
+    _dirty_rows |= 1U << _row;
+    ++_column;
+}
+
+void terminal::execute(char c) {
+    switch (c) {
+        case '\r':
+            _column = 0;
+            break;
+
+        case '\n':
+        case '\v':
+        case '\f':
+            newline();
+            break;
+
+        case '\b':
+            /* A pending wrap is dropped first, leaving the cursor on the last column */
+            if (_column > 0) {
+                _column = std::min(_column, COLUMNS - 1) - 1;
+            }
+            break;
+
+        case '\t':
+            _column = ((_column / TAB_WIDTH) + 1) * TAB_WIDTH;
+            if (_column >= COLUMNS) {
+                newline();
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+void terminal::esc_dispatch(char final) {
+    /* Character sets, line sizes and the like aren't supported */
+    if (_ansi.intermediate() != 0) {
+        return;
+    }
+
+    switch (final) {
+        case '7':
+            _saved_row = _row;
+            _saved_column = _column;
+            break;
+
+        case '8':
+            move_cursor(_saved_row, _saved_column);
+            break;
+
+        case 'D':
+            index();
+            break;
+
+        case 'E':
+            newline();
+            break;
+
+        case 'M':
+            reverse_index();
+            break;
+
+        case 'c':
+            _fg = DEFAULT_FG;
+            _bg = DEFAULT_BG;
+            _bold = false;
+            _reverse = false;
+            _saved_row = 0;
+            _saved_column = 0;
+            set_scroll_region(0, ROWS);
+            erase_screen();
+            break;
+
+        default:
+            break;
+    }
+}
+
+void terminal::csi_dispatch(char final) {
+    /* Sequences that hand what follows to an image or a plot, or toggle the status screen */
+    if (_ansi.private_marker() == '=' && _ansi.intermediate() == 0) {
+        if (final == 'i') {
+            _image_pending = true;
+            _image_x = _ansi.param(0, 0);
+            _image_y = _ansi.param(1, 0);
+        } else if (final == 'p') {
+            _plot_pending = true;
+        } else if (final == 's') {
+            _status_pending = true;
+        }
+        return;
+    }
+
+    /* Private modes (cursor visibility, the alternate screen, ...) don't apply here */
+    if (_ansi.private_marker() != 0 || _ansi.intermediate() != 0) {
+        return;
+    }
+
+    const auto n = static_cast<std::int32_t>(_ansi.param(0, 1));
+    const auto row = static_cast<std::int32_t>(_row);
+    const auto column = static_cast<std::int32_t>(std::min(_column, COLUMNS - 1));
+
+    switch (final) {
+        case 'A':
+            move_cursor(row - n, column);
+            break;
+
+        case 'B':
+            move_cursor(row + n, column);
+            break;
+
+        case 'C':
+            move_cursor(row, column + n);
+            break;
+
+        case 'D':
+            move_cursor(row, column - n);
+            break;
+
+        case 'E':
+            move_cursor(row + n, 0);
+            break;
+
+        case 'F':
+            move_cursor(row - n, 0);
+            break;
+
+        case 'G':
+            move_cursor(row, n - 1);
+            break;
+
+        case 'H':
+        case 'f':
+            move_cursor(n - 1, static_cast<std::int32_t>(_ansi.param(1, 1)) - 1);
+            break;
+
+        case 'd':
+            move_cursor(n - 1, column);
+            break;
+
+        case 'J':
+            switch (_ansi.param(0, 0)) {
+                case 0:
+                    /* Cursor home, then erase below: the usual way to clear the screen */
+                    if (_row == 0 && _column == 0) {
+                        erase_screen();
+                        break;
+                    }
+                    erase(_row, column, COLUMNS);
+                    for (auto below = _row + 1; below < ROWS; ++below) {
+                        erase(below, 0, COLUMNS);
+                    }
+                    break;
+
+                case 1:
+                    for (std::uint32_t above = 0; above < _row; ++above) {
+                        erase(above, 0, COLUMNS);
+                    }
+                    erase(_row, 0, column + 1);
+                    break;
+
+                case 2:
+                case 3:
+                    erase_screen();
+                    break;
+
+                default:
+                    break;
+            }
+            break;
+
+        case 'K':
+            switch (_ansi.param(0, 0)) {
+                case 0:
+                    erase(_row, column, COLUMNS);
+                    break;
+
+                case 1:
+                    erase(_row, 0, column + 1);
+                    break;
+
+                case 2:
+                    erase(_row, 0, COLUMNS);
+                    break;
+
+                default:
+                    break;
+            }
+            break;
+
+        case 'X':
+            erase(_row, column, std::min<std::uint32_t>(column + n, COLUMNS));
+            break;
+
+        case '@':
+        case 'P': {
+            auto *cells = &_cells[_row][column];
+            const auto count = std::min<std::uint32_t>(n, COLUMNS - column);
+            const auto kept = COLUMNS - column - count;
+
+            if (final == '@') {
+                std::memmove(cells + count, cells, kept * sizeof(Cell));
+                erase(_row, column, column + count);
+            } else {
+                std::memmove(cells, cells + count, kept * sizeof(Cell));
+                erase(_row, column + kept, COLUMNS);
+            }
+            break;
+        }
+
+        case 'L':
+        case 'M':
+            if (_row < _scroll_top || _row >= _scroll_bottom) {
+                break;
+            }
+            for (std::int32_t i = 0; i < n && i < static_cast<std::int32_t>(_scroll_bottom - _row); ++i) {
+                if (final == 'L') {
+                    scroll_down(_row);
+                } else {
+                    scroll_up(_row);
+                }
+            }
+            _column = 0;
+            break;
+
+        case 'S':
+        case 'T':
+            for (std::int32_t i = 0; i < n && i < static_cast<std::int32_t>(_scroll_bottom - _scroll_top); ++i) {
+                if (final == 'S') {
+                    scroll_up(_scroll_top);
+                } else {
+                    scroll_down(_scroll_top);
+                }
+            }
+            break;
+
+        case 'r': {
+            const auto top = _ansi.param(0, 1) - 1U;
+            const auto bottom = std::min<std::uint32_t>(_ansi.param(1, ROWS), ROWS);
+
+            /* At least two rows */
+            if (top + 1 < bottom) {
+                set_scroll_region(top, bottom);
+            }
+            break;
+        }
+
+        case 's':
+            _saved_row = _row;
+            _saved_column = _column;
+            break;
+
+        case 'u':
+            move_cursor(_saved_row, _saved_column);
+            break;
+
+        case 'm':
+            select_graphic_rendition();
+            break;
+
+        default:
+            break;
+    }
+}
+
+void terminal::select_graphic_rendition() {
+    const auto count = std::max<std::size_t>(_ansi.param_count(), 1);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto p = _ansi.param(i, 0);
+
+        if (p == 0) {
+            _fg = DEFAULT_FG;
+            _bg = DEFAULT_BG;
+            _bold = false;
+            _reverse = false;
+        } else if (p == 1) {
+            _bold = true;
+        } else if (p == 22) {
+            _bold = false;
+        } else if (p == 7) {
+            _reverse = true;
+        } else if (p == 27) {
+            _reverse = false;
+        } else if (p >= 30 && p <= 37) {
+            _fg = static_cast<Color>(p - 30);
+        } else if (p == 39) {
+            _fg = DEFAULT_FG;
+        } else if (p >= 40 && p <= 47) {
+            _bg = static_cast<Color>(p - 40);
+        } else if (p == 49) {
+            _bg = DEFAULT_BG;
+        } else if (p >= 90 && p <= 97) {
+            _fg = static_cast<Color>(p - 90 + 8);
+        } else if (p >= 100 && p <= 107) {
+            _bg = static_cast<Color>(p - 100 + 8);
+        } else if (p == 38 || p == 48) {
+            /* 38;5;n and 38;2;r;g;b, and the same for 48 */
+            Color color;
+            if (_ansi.param(i + 1, 0) == 5) {
+                color = indexed_color(_ansi.param(i + 2, 0));
+                i += 2;
+            } else if (_ansi.param(i + 1, 0) == 2) {
+                color = nearest_color(_ansi.param(i + 2, 0), _ansi.param(i + 3, 0), _ansi.param(i + 4, 0));
+                i += 4;
+            } else {
+                /* Can't tell how many parameters it takes */
+                return;
+            }
+            ((p == 38) ? _fg : _bg) = color;
+        }
+    }
+}
+
+void terminal::move_cursor(std::int32_t row, std::int32_t column) {
+    _row = static_cast<std::uint32_t>(std::clamp<std::int32_t>(row, 0, ROWS - 1));
+    _column = static_cast<std::uint32_t>(std::clamp<std::int32_t>(column, 0, COLUMNS - 1));
+}
+
+void terminal::index() {
+    if (_row + 1 == _scroll_bottom) {
+        scroll_up(_scroll_top);
+    } else if (_row + 1 < ROWS) {
+        ++_row;
+    }
+}
+
+void terminal::newline() {
+    _column = 0;
+    index();
+}
+
+void terminal::reverse_index() {
+    if (_row == _scroll_top) {
+        scroll_down(_scroll_top);
+    } else if (_row > 0) {
+        --_row;
+    }
+}
+
+void terminal::scroll_up(std::uint32_t top) {
+    const auto bottom = _scroll_bottom;
+    const auto rows = ((1U << bottom) - 1U) & ~((1U << top) - 1U);
+
+    if (top == 0 && _scrollback != nullptr) {
+        _scrollback->push(_cells[0]);
+    }
+
+    std::memmove(_cells + top, _cells + top + 1, sizeof(_cells[0]) * (bottom - top - 1));
+
+    if (_hw_scroll && top == _scroll_top) {
+        /* The old top row's pixels become the new last row */
+        Cell first[COLUMNS];
+        std::memcpy(first, &_drawn[top][0], sizeof(first));
+        std::memmove(_drawn + top, _drawn + top + 1, sizeof(_drawn[0]) * (bottom - top - 1));
+        std::memcpy(&_drawn[bottom - 1][0], first, sizeof(first));
+
+        _top = (_top + 1) % (bottom - top);
+        _dirty_rows = (_dirty_rows & ~rows) | (((_dirty_rows & rows) >> 1) & rows);
+    } else {
+        /* Every row moved; only the cells that actually differ get drawn */
+        _dirty_rows |= rows;
+    }
+
+    erase(bottom - 1, 0, COLUMNS);
+}
+
+void terminal::scroll_down(std::uint32_t top) {
+    const auto bottom = _scroll_bottom;
+    const auto rows = ((1U << bottom) - 1U) & ~((1U << top) - 1U);
+
+    std::memmove(_cells + top + 1, _cells + top, sizeof(_cells[0]) * (bottom - top - 1));
+
+    if (_hw_scroll && top == _scroll_top) {
+        Cell last[COLUMNS];
+        std::memcpy(last, &_drawn[bottom - 1][0], sizeof(last));
+        std::memmove(_drawn + top + 1, _drawn + top, sizeof(_drawn[0]) * (bottom - top - 1));
+        std::memcpy(&_drawn[top][0], last, sizeof(last));
+
+        _top = (_top + (bottom - top) - 1) % (bottom - top);
+        _dirty_rows = (_dirty_rows & ~rows) | (((_dirty_rows & rows) << 1) & rows);
+    } else {
+        _dirty_rows |= rows;
+    }
+
+    erase(top, 0, COLUMNS);
+}
+
+void terminal::set_scroll_region(std::uint32_t top, std::uint32_t bottom) {
+    /* The rows of a scrolled region aren't where the new area expects them in GRAM */
+    if (_top != 0) {
+        redraw();
+    }
+
+    _scroll_top = top;
+    _scroll_bottom = bottom;
+    _scroll_area_changed = _hw_scroll;
+    move_cursor(0, 0);
+}
+
+void terminal::erase_screen() {
+    for (std::uint32_t row = 0; row < ROWS; ++row) {
+        std::fill_n(_cells[row], COLUMNS, blank());
+    }
+
+    /* Drawn as a whole at the next render; rows written after this are still marked dirty */
+    _erased = true;
+    _erased_to = blank();
+}
+
+void terminal::erase(std::uint32_t row, std::uint32_t first, std::uint32_t last) {
+    std::fill(&_cells[row][first], &_cells[row][last], blank());
+    _dirty_rows |= 1U << row;
+}
+
+terminal::Cell terminal::blank() const {
+    return { u' ', _fg, _reverse ? _fg : _bg };
+}
+
+std::uint32_t terminal::screen_row(std::uint32_t row) const {
+    if (row < _scroll_top || row >= _scroll_bottom) {
+        return row;
+    }
+    return _scroll_top + (row - _scroll_top + _top) % (_scroll_bottom - _scroll_top);
+}
+
+void terminal::draw_cell(std::uint32_t row, std::uint32_t column, const Cell &cell) {
+    const auto fg = PALETTE[static_cast<std::uint8_t>(cell.fg)];
+    const auto bg = PALETTE[static_cast<std::uint8_t>(cell.bg)];
+    const auto y = screen_row(row) * CELL_HEIGHT;
+
+    /* ASCII goes through the LCD utilities' glyph cache */
+    if (cell.ch >= u' ' && cell.ch <= u'~') {
+        UTIL_LCD_SetTextColor(fg);
+        UTIL_LCD_SetBackColor(bg);
+        UTIL_LCD_DisplayChar(column * CELL_WIDTH, y, static_cast<std::uint8_t>(cell.ch));
+        return;
+    }
+
+    std::uint16_t pixels[CELL_WIDTH * CELL_HEIGHT];
+    UnicodeFont16.decode(cell.ch, pixels, CELL_WIDTH, canvas::rgb565(fg), canvas::rgb565(bg));
+    UTIL_LCD_FillRGBRect(column * CELL_WIDTH, y, reinterpret_cast<std::uint8_t *>(pixels), CELL_WIDTH, CELL_HEIGHT);
+}
+
+/* The one of the 16 colors closest to an RGB color */
+static terminal::Color nearest_color(std::uint32_t red, std::uint32_t green, std::uint32_t blue) {
+    std::uint32_t best = 0, best_distance = UINT32_MAX;
+
+    for (std::uint32_t i = 0; i < sizeof(PALETTE) / sizeof(PALETTE[0]); ++i) {
+        const auto dr = static_cast<std::int32_t>((PALETTE[i] >> 16) & 0xFFU) - static_cast<std::int32_t>(red);
+        const auto dg = static_cast<std::int32_t>((PALETTE[i] >> 8) & 0xFFU) - static_cast<std::int32_t>(green);
+        const auto db = static_cast<std::int32_t>(PALETTE[i] & 0xFFU) - static_cast<std::int32_t>(blue);
+        const auto distance = static_cast<std::uint32_t>(dr * dr + dg * dg + db * db);
+
+        if (distance < best_distance) {
+            best = i;
+            best_distance = distance;
+        }
+    }
+
+    return static_cast<terminal::Color>(best);
+}
+
+/* A color of the xterm 256-color palette: the 16 colors, a 6x6x6 cube, then 24 grays */
+static terminal::Color indexed_color(std::uint32_t index) {
+    if (index < 16) {
+        return static_cast<terminal::Color>(index);
+    }
+
+    if (index < 232) {
+        index -= 16;
+        return nearest_color(CUBE_LEVELS[index / 36], CUBE_LEVELS[(index / 6) % 6], CUBE_LEVELS[index % 6]);
+    }
+
+    const auto gray = 8 + 10 * (std::min<std::uint32_t>(index, 255) - 232);
+    return nearest_color(gray, gray, gray);
+}
@@ -0,0 +1,348 @@
+/*
+ * terminal.h
+ *
+ * A character cell terminal drawn on the LCD. Text written to the terminal only updates a RAM
+ * cell buffer; render() then draws just the cells that changed since the last render, so the
+ * cost of a frame follows the amount of new text rather than the size of the screen.
+ *
+ * Input is UTF-8. Printable ASCII is drawn with Font16 through the LCD glyph cache; other
+ * characters come from UnicodeFont16 (see unicode_font.h), and anything it lacks, or malformed
+ * input, shows as U+FFFD.
+ *
+ * Escape sequences are parsed by an ansi_parser (see ansi_parser.h). Supported:
+ *   ESC 7, ESC 8        save and restore the cursor
+ *   ESC D, ESC E, ESC M index, next line, reverse index
+ *   ESC c               reset
+ *   CSI A B C D E F G H f d    cursor movement
+ *   CSI J, CSI K, CSI X        erase in display, in line, characters
+ *   CSI @, CSI P, CSI L, CSI M insert and delete characters and lines
+ *   CSI S, CSI T, CSI r        scroll up and down, set the scroll region
+ *   CSI s, CSI u               save and restore the cursor
+ *   CSI m               SGR: bold (as the bright colors), reverse, the 8 colors and their bright
+ *                       versions, and 256-color and RGB colors mapped to the nearest of those 16
+ *   CSI = x ; y i       an image follows, to be drawn at pixel x, y; see take_image()
+ *   CSI = p             numbers to plot follow, one per line, up to the next ESC; see take_plot()
+ *   CSI = s             show or hide the link status screen; see take_status()
+ * Anything else is parsed and ignored. '\n' also returns the carriage, as it always has here.
+ *
+ * Erased cells are drawn as fills: a screen erase as one fill of the screen, other runs of
+ * blank cells as one fill per run instead of a glyph per cell.
+ *
+ * Where the LCD supports it, scrolling is done in hardware: the rows stay where they are in GRAM
+ * and only the scroll start moves, so a new line costs one register write plus drawing that line.
+ * The scroll region becomes the panel's scroll area, so scrolling within it is done the same way.
+ *
+ * Lines scrolled off the top of the screen go to a scrollback, if one is attached; see
+ * scroll_view.h for how they're shown.
+ *
+ * Draws through the stm32_lcd utilities, so a terminal should only be used from the thread that
+ * owns the LCD.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "ansi_parser.h"
+#include "utf8_decoder.h"
+
+#include <cstddef>
+#include <cstdint>
+
+class scrollback;
+
+class terminal {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Size of the screen in pixels. */
+    static constexpr std::uint32_t SCREEN_WIDTH { 240 };
+    static constexpr std::uint32_t SCREEN_HEIGHT { 240 };
+
+    /** Size of a cell in pixels; the size of a Font16 glyph. */
+    static constexpr std::uint32_t CELL_WIDTH { 11 };
+    static constexpr std::uint32_t CELL_HEIGHT { 16 };
+
+    /** Size of the terminal in cells. */
+    static constexpr std::uint32_t COLUMNS { SCREEN_WIDTH / CELL_WIDTH };
+    static constexpr std::uint32_t ROWS { SCREEN_HEIGHT / CELL_HEIGHT };
+
+    /** Tab stops are every this many columns. */
+    static constexpr std::uint32_t TAB_WIDTH { 4 };
+
+    /** Cell colors. Match the ANSI colors and their bright versions. */
+    enum class Color : std::uint8_t {
+        BLACK,
+        RED,
+        GREEN,
+        YELLOW,
+        BLUE,
+        MAGENTA,
+        CYAN,
+        WHITE,
+        BRIGHT_BLACK,
+        BRIGHT_RED,
+        BRIGHT_GREEN,
+        BRIGHT_YELLOW,
+        BRIGHT_BLUE,
+        BRIGHT_MAGENTA,
+        BRIGHT_CYAN,
+        BRIGHT_WHITE,
+    };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Cell {
+        /** Codepoints above U+FFFF are kept as U+FFFD; no font here has any of them. */
+        char16_t ch;
+        Color fg;
+        Color bg;
+
+        bool operator==(const Cell &other) const {
+            return ch == other.ch && fg == other.fg && bg == other.bg;
+        }
+        bool operator!=(const Cell &other) const { return !(*this == other); }
+    };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    terminal();
+
+    /**
+     * Blanks the terminal and the screen, resets scrolling and the scroll region, drops any
+     * partly received sequence, and moves the cursor home.
+     */
+    void clear();
+
+    /**
+     * Sets the colors used for text written from now on, as SGR 3x and 4x do.
+     *
+     * @param fg the text color.
+     * @param bg the background color.
+     */
+    void set_colors(Color fg, Color bg);
+
+    /**
+     * Writes a byte of UTF-8 or of an escape sequence at the cursor. A character or sequence
+     * split across calls takes effect once its last byte arrives. Handles '\r', '\n', '\b' and
+     * '\t'; other control characters are ignored. Only updates the cell buffer, see render().
+     *
+     * @param c the byte to write.
+     */
+    void write(char c);
+
+    /**
+     * Writes several bytes, see write(char). Stops after a sequence announcing an image or a
+     * plot, since what follows it is for them rather than the terminal, and after one toggling
+     * the status screen.
+     *
+     * @param[in] src    the bytes to write.
+     * @param     amount the number of bytes to write.
+     *
+     * @return the number of bytes written.
+     */
+    std::size_t write(const char *src, std::size_t amount);
+
+    /**
+     * Takes the position of the image announced by the last CSI = x ; y i, if there's one that
+     * hasn't been taken. The image's bytes come next; see image_stream.h. It's drawn over the
+     * screen as it is, and scrolls along with it until the cells under it change.
+     *
+     * @param[out] x where the image's left edge goes, in pixels.
+     * @param[out] y where the image's top edge goes, in pixels.
+     *
+     * @return whether there was an image.
+     */
+    bool take_image(std::uint32_t &x, std::uint32_t &y);
+
+    /**
+     * Takes a plot announced by CSI = p, if there's one that hasn't been taken. The numbers come
+     * next; see strip_chart.h. The plot takes over the screen until an ESC, which starts a
+     * sequence for the terminal again.
+     *
+     * @return whether there was a plot.
+     */
+    bool take_plot();
+
+    /**
+     * Takes a CSI = s, if there's one that hasn't been taken. It toggles the link status screen;
+     * see status_screen.h. The terminal keeps taking text while the screen is up.
+     *
+     * @return whether there was one.
+     */
+    bool take_status();
+
+    /**
+     * The GRAM row a pixel row of the screen is shown from. With hardware scrolling the two
+     * differ within the scroll region.
+     *
+     * @param y the pixel row of the screen.
+     */
+    std::uint32_t gram_row(std::uint32_t y) const;
+
+    /**
+     * Draws the cells that changed since the last render.
+     *
+     * @return the number of cells drawn.
+     */
+    std::size_t render();
+
+    /**
+     * Measures how many characters per second the terminal sustains on screen, with a render
+     * after every BLE-write-sized chunk. Clears the terminal and reports over the logger.
+     *
+     * @param amount the number of characters to write.
+     */
+    void benchmark(std::uint32_t amount);
+
+    /**
+     * Sets where lines scrolled off the top of the screen go. Only lines leaving a scroll region
+     * that starts at the top are kept, as in xterm.
+     *
+     * @param lines the scrollback, or nullptr to drop them.
+     */
+    void set_scrollback(scrollback *lines) { _scrollback = lines; }
+
+    /** A row of the screen, COLUMNS cells. */
+    const Cell *row(std::uint32_t row) const { return _cells[row]; }
+
+    /** Draws the whole screen again at the next render, for when something else drew over it. */
+    void redraw();
+
+    /**
+     * Draws some of the pixel rows of a line of cells, across the whole width of the screen.
+     *
+     * @param[in] cells the line, COLUMNS cells.
+     * @param     first the first pixel row of the line to draw.
+     * @param     last  the pixel row to stop before, at most CELL_HEIGHT.
+     * @param     y     the screen row to draw row first at.
+     */
+    static void draw_line(const Cell *cells, std::uint32_t first, std::uint32_t last, std::uint32_t y);
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static_assert(ROWS <= 32, "Dirty rows are tracked in a 32-bit mask");
+
+    /** What the terminal should show, and what was last drawn. */
+    Cell _cells[ROWS][COLUMNS];
+    Cell _drawn[ROWS][COLUMNS];
+    /** Rows with cells that may differ from what was drawn. */
+    std::uint32_t _dirty_rows;
+    /** Whether the whole screen was erased since the last render, and to what. */
+    bool _erased;
+    Cell _erased_to;
+
+    /** Whether the LCD scrolls in hardware. */
+    bool _hw_scroll;
+    /** Rows that scroll, from _scroll_top up to but not including _scroll_bottom. */
+    std::uint32_t _scroll_top;
+    std::uint32_t _scroll_bottom;
+    /** Whether the LCD's scroll area has to be moved to the scroll region. */
+    bool _scroll_area_changed;
+    /** Rows the scroll region is scrolled by in GRAM, and what the LCD was last scrolled to. */
+    std::uint32_t _top;
+    std::uint32_t _shown_top;
+
+    /** The cursor; _column is COLUMNS when a wrap is pending. */
+    std::uint32_t _row;
+    std::uint32_t _column;
+    std::uint32_t _saved_row;
+    std::uint32_t _saved_column;
+
+    /** Text attributes, as set by set_colors() and SGR. */
+    Color _fg;
+    Color _bg;
+    bool _bold;
+    bool _reverse;
+
+    /** Hold a sequence or character split across writes. */
+    ansi_parser _ansi;
+    utf8_decoder _utf8;
+
+    /** Where scrolled off lines go, if anywhere. */
+    scrollback *_scrollback;
+
+    /** An image announced and not yet taken, and where it goes. */
+    bool _image_pending;
+    std::uint32_t _image_x;
+    std::uint32_t _image_y;
+
+    /** A plot announced and not yet taken. */
+    bool _plot_pending;
+
+    /** A status screen toggle not yet taken. */
+    bool _status_pending;
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Puts a decoded printable character at the cursor. */
+    void put(char32_t c);
+
+    /** Acts on a control character. */
+    void execute(char c);
+
+    /** Act on an ESC or CSI sequence, given its final byte. */
+    void esc_dispatch(char final);
+    void csi_dispatch(char final);
+
+    /** Applies an SGR sequence's parameters. */
+    void select_graphic_rendition();
+
+    /** Moves the cursor, keeping it on the screen. */
+    void move_cursor(std::int32_t row, std::int32_t column);
+
+    /** Moves the cursor down a line, scrolling if it's on the last line of the region. */
+    void index();
+
+    /** Moves the cursor to the start of the next line, see index(). */
+    void newline();
+
+    /** Moves the cursor up a line, scrolling down if it's on the first line of the region. */
+    void reverse_index();
+
+    /**
+     * Moves rows top up to the bottom of the scroll region up by one and blanks the last one.
+     * When top is the top of the region and the LCD scrolls in hardware, the drawn rows move
+     * along with them so only the last row has to be drawn.
+     */
+    void scroll_up(std::uint32_t top);
+
+    /** As scroll_up(), moving the rows down and blanking row top. */
+    void scroll_down(std::uint32_t top);
+
+    /**
+     * Sets the rows that scroll, and moves the cursor home. With hardware scrolling the LCD's
+     * scroll area follows at the next render.
+     */
+    void set_scroll_region(std::uint32_t top, std::uint32_t bottom);
+
+    /** Blanks the whole screen, to be drawn as one fill. */
+    void erase_screen();
+
+    /** Blanks cells first up to but not including last of a row. */
+    void erase(std::uint32_t row, std::uint32_t first, std::uint32_t last);
+
+    /** The cell an erase leaves, in the current background. */
+    Cell blank() const;
+
+    /** Screen row a terminal row is drawn in. */
+    std::uint32_t screen_row(std::uint32_t row) const;
+
+    /** Draws a single cell. */
+    void draw_cell(std::uint32_t row, std::uint32_t column, const Cell &cell);
+};
@@ -0,0 +1,44 @@
+/*
+ * unicode_font.cpp
+ *
+ * Glyph lookup for Unicode fonts.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "unicode_font.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::int32_t unicode_font::find(char32_t codepoint) const {
+    /* ASCII is glyphs 0 to 94 */
+    if (codepoint - U' ' < ranges[0].count) {
+        return static_cast<std::int32_t>(codepoint - U' ');
+    }
+
+    std::uint32_t low = 1, high = range_count;
+    while (low < high) {
+        const auto middle = (low + high) / 2U;
+        const auto &range = ranges[middle];
+
+        if (codepoint < range.first) {
+            high = middle;
+        } else if (codepoint - range.first >= range.count) {
+            low = middle + 1U;
+        } else {
+            return range.glyph + static_cast<std::int32_t>(codepoint - range.first);
+        }
+    }
+
+    return -1;
+}
+
+void unicode_font::decode(char32_t codepoint, std::uint16_t *dst, std::uint32_t stride,
+                          std::uint16_t fg, std::uint16_t bg) const {
+    const auto glyph = find(codepoint);
+    glyphs.decode_glyph((glyph < 0) ? replacement : static_cast<std::uint32_t>(glyph),
+                        dst, stride, fg, bg);
+}
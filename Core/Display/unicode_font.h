@@ -0,0 +1,56 @@
+/*
+ * unicode_font.h
+ *
+ * A packed font (see packed_font.h) for codepoints beyond ASCII. The glyphs are stored in
+ * codepoint order, and runs of consecutive codepoints are indexed by a small table of ranges, so
+ * finding a glyph is a binary search over the ranges rather than the glyphs. The first range is
+ * always printable ASCII, which is looked up directly.
+ *
+ * The tables are generated by Host/font_pack (see font_unicode.c), into unicode_fonts.cpp.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "packed_font.h"
+
+#include <cstdint>
+
+/** A run of consecutive codepoints, and the glyph of the first one. */
+struct codepoint_range {
+    char32_t first;
+    std::uint16_t count;
+    std::uint16_t glyph;
+};
+
+struct unicode_font {
+    /** The glyphs, in codepoint order; first and count cover every glyph. */
+    packed_font glyphs;
+    /** Ascending and non-overlapping. The first is ' ' to '~'. */
+    const codepoint_range *ranges;
+    std::uint16_t range_count;
+    /** Glyph drawn for codepoints outside the font, U+FFFD. */
+    std::uint16_t replacement;
+
+    /**
+     * Finds the glyph of a codepoint.
+     *
+     * @return the glyph, or -1 if the font doesn't have the codepoint.
+     */
+    std::int32_t find(char32_t codepoint) const;
+
+    /**
+     * Expands a whole cell to RGB565. Codepoints outside the font are drawn as the replacement
+     * glyph.
+     *
+     * @param[out] dst    the top-left pixel of the cell.
+     * @param      stride pixels from one row of dst to the next.
+     */
+    void decode(char32_t codepoint, std::uint16_t *dst, std::uint32_t stride,
+                std::uint16_t fg, std::uint16_t bg) const;
+};
+
+/** Font16 with Latin-1, typographic punctuation, arrows, box drawing and block elements. */
+extern const unicode_font UnicodeFont16;
@@ -0,0 +1,243 @@
+/*
+ * unicode_fonts.cpp
+ *
+ * Font16 with Latin-1 and extras. Generated by Host/font_pack/font_unicode; don't edit.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "unicode_font.h"
+
+static const std::uint16_t g_unicode16_offsets[] = {
+        0,     0,    20,    55,   143,   234,   314,   377,   392,   440,   488,   544,
+      593,   608,   615,   619,   723,   793,   873,   943,  1023,  1093,  1163,  1233,
+     1303,  1373,  1443,  1457,  1493,  1574,  1601,  1682,  1745,  1811,  1901,  1973,
+     2054,  2135,  2207,  2288,  2369,  2450,  2522,  2603,  2684,  2765,  2864,  2945,
+     3026,  3098,  3197,  3287,  3350,  3422,  3503,  3584,  3683,  3764,  3854,  3917,
+     3965,  4069,  4117,  4159,  4170,  4179,  4235,  4325,  4381,  4471,  4534,  4624,
+     4714,  4804,  4884,  4962,  5052,  5132,  5202,  5265,  5328,  5418,  5508,  5571,
+     5620,  5700,  5763,  5826,  5903,  5966,  6066,  6115,  6163,  6187,  6235,  6256,
+     6256,  6276,  6364,  6436,  6499,  6589,  6613,  6690,  6695,  6785,  6820,  6860,
+     6884,  6891,  6981,  6990,  7010,  7073,  7103,  7123,  7131,  7221,  7309,  7313,
+     7319,  7334,  7369,  7409,  7529,  7649,  7769,  7832,  7942,  8052,  8162,  8272,
+     8382,  8492,  8582,  8681,  8769,  8857,  8945,  9033,  9121,  9209,  9297,  9385,
+     9475,  9574,  9673,  9772,  9871,  9970, 10069, 10104, 10203, 10302, 10401, 10500,
+    10599, 10709, 10781, 10861, 10941, 11021, 11101, 11181, 11261, 11341, 11411, 11483,
+    11573, 11663, 11753, 11843, 11923, 12003, 12083, 12163, 12253, 12343, 12433, 12523,
+    12613, 12703, 12793, 12856, 12937, 13027, 13117, 13207, 13297, 13427, 13544, 13674,
+    13683, 13694, 13702, 13710, 13734, 13758, 13783, 13803, 13893, 13963, 14047, 14117,
+    14201, 14212, 14228, 14282, 14336, 14384, 14432, 14528, 14624, 14723, 14811, 14987,
+    15075, 15163, 15339, 15435, 15515, 15680, 15856, 16032,
+};
+
+static const std::uint8_t g_unicode16_box_indices[] = {
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,   5,  16,  17,  16,  16,  16,  18,  16,  16,  19,  20,  21,  22,  21,   6,
+     23,  24,  25,  21,  21,  25,  21,  21,  21,  26,  21,  21,  21,  27,  21,  21,
+     25,  28,  24,   6,  25,  21,  21,  27,  21,  24,   6,  29,  15,   9,  30,  31,
+     32,  33,  34,  35,  34,  36,  37,  38,  34,   5,  39,  34,   5,  40,  36,  36,
+     38,  38,  36,  41,  17,  36,  36,  42,  36,  43,  41,   9,  44,   8,  45,   0,
+     46,  47,  25,  48,  24,  44,  49,  50,  34,  51,  52,  53,  13,  34,  54,  55,
+     56,  57,  58,  59,  38,  47,  60,  61,  62,  51,  63,  64,  64,  64,  65,  66,
+     66,  66,  66,  66,  66,  67,  28,  68,  68,  68,  68,  69,  69,  69,  69,  67,
+     70,  70,  70,  70,  70,  70,  71,  72,  70,  70,  70,  70,  66,  25,  17,   5,
+      5,   5,   5,   5,   5,  73,  74,  34,  34,  34,  34,   5,   5,   5,   5,  34,
+     34,  34,  34,  34,  34,  34,  48,  75,  34,  34,  34,  34,  76,  77,  76,  78,
+     79,  80,  80,  81,  81,  82,  83,  67,  40,  84,  73,  84,  85,  86,  87,  88,
+     89,  90,  91,  92,  93,  94,  95,  94,  96,  95,  92,  97,  98,  95,  95,  99,
+};
+
+static const packed_box g_unicode16_boxes[] = {
+    {  0,  0,  0,  0 }, {  4,  1,  2, 10 }, {  3,  2,  7,  5 }, {  2,  1,  8, 11 },
+    {  2,  0,  7, 13 }, {  2,  1,  8, 10 }, {  2,  2,  7,  9 }, {  5,  2,  3,  5 },
+    {  4,  1,  4, 12 }, {  3,  1,  4, 12 }, {  2,  1,  8,  7 }, {  2,  3,  7,  7 },
+    {  4,  9,  3,  5 }, {  2,  6,  7,  1 }, {  4,  9,  2,  2 }, {  2,  0,  8, 13 },
+    {  2,  1,  7, 10 }, {  1,  1,  8, 10 }, {  1,  1,  7, 10 }, {  4,  4,  2,  7 },
+    {  4,  4,  4,  9 }, {  1,  2,  9,  9 }, {  1,  5,  9,  3 }, {  2,  1,  6, 11 },
+    {  1,  2, 10,  9 }, {  1,  2,  8,  9 }, {  2,  2,  8,  9 }, {  0,  2, 11,  9 },
+    {  1,  2,  9, 11 }, {  5,  1,  4, 12 }, {  2,  0,  7,  6 }, {  0, 15, 11,  1 },
+    {  4,  0,  3,  3 }, {  2,  4,  8,  7 }, {  1,  1,  9, 10 }, {  1,  4,  8,  7 },
+    {  1,  4,  9,  7 }, {  2,  1,  9, 10 }, {  1,  4,  9, 10 }, {  2,  1,  6, 13 },
+    {  1,  4, 10,  7 }, {  2,  4,  7,  7 }, {  0,  4, 11,  7 }, {  1,  4, 10, 10 },
+    {  5,  1,  2, 12 }, {  2,  5,  7,  3 }, {  5,  4,  2, 10 }, {  1,  2,  8, 11 },
+    {  1,  3,  9,  7 }, {  2,  1,  7, 11 }, {  3,  1,  5,  1 }, {  2,  1,  5,  7 },
+    {  2,  4,  8,  5 }, {  1,  6,  8,  3 }, {  1,  1,  9,  1 }, {  2,  1,  5,  4 },
+    {  1,  2,  9,  7 }, {  1,  1,  6,  5 }, {  2,  1,  4,  5 }, {  4,  1,  4,  2 },
+    {  5,  6,  2,  2 }, {  4, 11,  3,  2 }, {  2,  1,  3,  5 }, {  1,  4,  8,  5 },
+    {  0,  1, 10, 12 }, {  2,  4,  7,  9 }, {  1,  0, 10, 11 }, {  0,  2, 10,  9 },
+    {  1,  0,  8, 11 }, {  2,  0,  8, 11 }, {  1,  0,  9, 11 }, {  2,  4,  7,  5 },
+    {  1,  1,  9, 11 }, {  0,  4, 10,  7 }, {  1,  4,  8,  9 }, {  1,  3,  9,  9 },
+    {  1,  1, 10, 13 }, {  1,  1,  9, 13 }, {  1,  6,  9,  1 }, {  0,  6, 11,  1 },
+    {  5,  1,  2,  4 }, {  3,  1,  6,  4 }, {  3,  5,  5,  5 }, {  0,  9, 10,  2 },
+    {  2,  2,  7, 12 }, {  0,  7, 11,  1 }, {  5,  0,  1, 16 }, {  5,  7,  6,  9 },
+    {  0,  7,  6,  9 }, {  5,  0,  6,  8 }, {  0,  0,  6,  8 }, {  5,  0,  6, 16 },
+    {  0,  0,  6, 16 }, {  0,  7, 11,  9 }, {  0,  0, 11,  8 }, {  0,  0, 11, 16 },
+    {  0,  8, 11,  8 }, {  6,  0,  5, 16 }, {  0,  0, 11, 15 }, {  0,  2,  9, 10 },
+};
+
+static const std::uint8_t g_unicode16_bits[] = {
+    0xFF, 0xFF, 0x3E, 0xFD, 0xD1, 0x22, 0x44, 0x6C, 0x6C, 0x6C, 0x6D, 0xFE, 0xD9, 0xFE, 0xD8, 0xD8,
+    0xD8, 0xD8, 0x21, 0xFE, 0x3C, 0x7C, 0x1E, 0x1E, 0x0F, 0x8F, 0x1F, 0xE1, 0x02, 0x18, 0x24, 0x24,
+    0x18, 0xC7, 0x9E, 0x31, 0x82, 0x42, 0x41, 0x8F, 0x30, 0x60, 0xC0, 0xC3, 0xBD, 0xD9, 0x9D, 0xFE,
+    0x92, 0x33, 0x6E, 0xCC, 0xCC, 0xE6, 0x33, 0xCC, 0x63, 0x33, 0x33, 0x36, 0xEC, 0x18, 0x18, 0xFF,
+    0xFF, 0x3C, 0x7E, 0x66, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x35, 0xA4, 0xFF, 0xE0, 0x60, 0x60,
+    0xC0, 0xC1, 0x81, 0x83, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x07, 0x1B, 0x63, 0xC7, 0x8F, 0x1E,
+    0x3C, 0x6D, 0x8E, 0x0C, 0x7C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x7F, 0x9E, 0x67, 0x8F,
+    0x18, 0x61, 0x86, 0x18, 0x60, 0xFE, 0xFD, 0x86, 0x06, 0x0C, 0x7C, 0x0E, 0x06, 0x07, 0x86, 0xFC,
+    0x38, 0x71, 0xE2, 0xCD, 0x93, 0x66, 0xFE, 0x18, 0xFB, 0xF6, 0x0C, 0x18, 0x3E, 0x46, 0x0C, 0x1C,
+    0x37, 0xC3, 0xDC, 0x30, 0xC1, 0xBB, 0x9E, 0x3C, 0x6C, 0xCF, 0x7F, 0x86, 0x0C, 0x30, 0x60, 0xC1,
+    0x86, 0x0C, 0x18, 0xFB, 0x1E, 0x3C, 0x6F, 0xB1, 0xE3, 0xC7, 0x8D, 0xF3, 0xCC, 0xD8, 0xF1, 0xE7,
+    0x76, 0x0C, 0x30, 0xEF, 0x1E, 0x07, 0x99, 0x80, 0x03, 0x24, 0x40, 0x0C, 0x18, 0x10, 0x30, 0x60,
+    0x0C, 0x01, 0x00, 0x60, 0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x0C, 0x01, 0x00, 0x60, 0x0C, 0x18, 0x10,
+    0x30, 0x60, 0x1F, 0x63, 0xC6, 0x0C, 0x71, 0x83, 0x00, 0x0C, 0x1C, 0x8C, 0x30, 0xCF, 0x4D, 0x33,
+    0xC0, 0x89, 0xCF, 0xC0, 0xF0, 0x24, 0x19, 0x86, 0x61, 0xF8, 0xC3, 0x30, 0xDE, 0x7F, 0xF3, 0x1B,
+    0x1B, 0x1B, 0xF3, 0x1B, 0x1B, 0x1F, 0xF1, 0xF5, 0x87, 0x81, 0xC0, 0x60, 0x30, 0x18, 0x16, 0x11,
+    0xF3, 0xF8, 0xC6, 0x61, 0xB0, 0xD8, 0x6C, 0x36, 0x1B, 0x1B, 0xF9, 0xFE, 0xC2, 0xC2, 0xC8, 0xF8,
+    0xC8, 0xC2, 0xC3, 0xFF, 0xFF, 0x60, 0xB0, 0x59, 0x0F, 0x86, 0x43, 0x01, 0x81, 0xF0, 0x3D, 0x31,
+    0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6, 0x3E, 0x7B, 0xD8, 0xCC, 0x66, 0x33, 0xF9, 0x8C, 0xC6,
+    0x63, 0x7B, 0xFF, 0xC6, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x3F, 0xCF, 0xE0, 0xC0, 0x60, 0x30,
+    0x19, 0x8C, 0xC6, 0x63, 0x1F, 0x1E, 0xF6, 0x33, 0x31, 0xB0, 0xF0, 0x7C, 0x33, 0x18, 0xDE, 0x7F,
+    0xC1, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x4C, 0x26, 0x1F, 0xFF, 0x07, 0x60, 0xCE, 0x39, 0xEF, 0x35,
+    0x66, 0xEC, 0xC9, 0x98, 0x37, 0xDF, 0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C, 0xC6, 0xF3,
+    0x1F, 0x18, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0x63, 0x1F, 0x3F, 0x98, 0xD8, 0xD8, 0xD8, 0xDF,
+    0x98, 0x18, 0x3F, 0x0F, 0x8C, 0x6C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xB1, 0x8F, 0x83, 0x33, 0xF7,
+    0xF0, 0xC6, 0x31, 0x8C, 0x63, 0xE0, 0xCC, 0x31, 0x8C, 0x67, 0xCE, 0xFF, 0x1E, 0x3E, 0x0F, 0x83,
+    0xE3, 0xC7, 0xFB, 0xFE, 0x66, 0x66, 0x64, 0x60, 0x60, 0x60, 0x61, 0xFB, 0xDE, 0xC6, 0x63, 0x31,
+    0x98, 0xCC, 0x66, 0x33, 0x18, 0xF9, 0xEF, 0x63, 0x31, 0x8D, 0x86, 0xC3, 0x60, 0xA0, 0x70, 0x38,
+    0xFB, 0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E, 0xE1, 0xDC, 0x31, 0x9E, 0xF6, 0x31, 0xB0,
+    0x70, 0x38, 0x1C, 0x1B, 0x18, 0xDE, 0xFF, 0x3D, 0x86, 0x33, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03,
+    0x03, 0xF3, 0xFC, 0x38, 0xC3, 0x04, 0x18, 0x63, 0x87, 0xFF, 0xE6, 0x66, 0x66, 0x66, 0x66, 0x7E,
+    0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x1F, 0x99, 0x99, 0x99,
+    0x99, 0x99, 0xF8, 0x82, 0x85, 0x11, 0x41, 0x83, 0xFF, 0xE2, 0x2F, 0x80, 0xC0, 0xCF, 0xD8, 0xD9,
+    0xCE, 0xFC, 0x06, 0x03, 0x01, 0xB8, 0xE6, 0x61, 0xB0, 0xD8, 0x6E, 0x6E, 0xE1, 0xEB, 0x1E, 0x0E,
+    0x06, 0x0B, 0x19, 0xF0, 0x38, 0x0C, 0x06, 0x3B, 0x33, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEE, 0x7C,
+    0x63, 0x60, 0xFF, 0xF8, 0x06, 0x19, 0xF8, 0x7E, 0x60, 0x30, 0x7F, 0x0C, 0x06, 0x03, 0x01, 0x80,
+    0xC1, 0xFC, 0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x1F, 0x38, 0x0C, 0x06,
+    0x03, 0x71, 0xCC, 0xC6, 0x63, 0x31, 0x98, 0xDE, 0xF1, 0x81, 0x80, 0x07, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x8F, 0xF1, 0x86, 0x03, 0xF0, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x3F, 0xB8, 0x0C, 0x06, 0x03,
+    0x79, 0xB0, 0xF0, 0x78, 0x36, 0x19, 0x9D, 0xF7, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x8F, 0xFF, 0xF1, 0xB6, 0x6D, 0x9B, 0x66, 0xD9, 0xB6, 0xED, 0xFB, 0x8E, 0x66, 0x33, 0x19, 0x8C,
+    0xC6, 0xF7, 0x9F, 0x18, 0xD8, 0x3C, 0x1E, 0x0D, 0x8C, 0x7C, 0xEE, 0x39, 0x98, 0x6C, 0x36, 0x1B,
+    0x99, 0xB8, 0xC0, 0x60, 0x7C, 0x0E, 0xEC, 0xEC, 0x36, 0x1B, 0x0C, 0xCE, 0x3B, 0x01, 0x80, 0xC1,
+    0xFF, 0x71, 0xCC, 0xC0, 0x60, 0x30, 0x18, 0x3F, 0x8F, 0xF1, 0xF8, 0x7C, 0x1F, 0x1F, 0xE3, 0x03,
+    0x03, 0x0F, 0xE3, 0x03, 0x03, 0x03, 0x03, 0x11, 0xEE, 0x73, 0x19, 0x8C, 0xC6, 0x63, 0x33, 0x8E,
+    0xFE, 0xF6, 0x33, 0x18, 0xD8, 0x6C, 0x1C, 0x0E, 0x3C, 0x7B, 0x06, 0x64, 0xCD, 0xD8, 0xEE, 0x1D,
+    0xC3, 0x19, 0xEF, 0x36, 0x0E, 0x07, 0x03, 0x83, 0x67, 0xBF, 0xCF, 0x61, 0x8C, 0xC3, 0x30, 0x58,
+    0x1E, 0x03, 0x00, 0xC0, 0x60, 0x7C, 0x3F, 0xC3, 0x0C, 0x71, 0x86, 0x1F, 0xE6, 0xCC, 0xCC, 0xD8,
+    0xCC, 0xCC, 0x7F, 0xFF, 0xFF, 0xF8, 0xCC, 0xCC, 0xC6, 0xCC, 0xCD, 0x8C, 0x24, 0x86, 0xCF, 0xFF,
+    0xF0, 0x80, 0x83, 0xD6, 0xBC, 0x9C, 0x8C, 0x96, 0xB3, 0xE0, 0x80, 0x81, 0xE3, 0x33, 0x03, 0x0F,
+    0xC3, 0x03, 0x06, 0x1F, 0xFC, 0x1B, 0xF9, 0x8C, 0xC6, 0x63, 0x3F, 0xB0, 0x7E, 0x7B, 0x0C, 0x66,
+    0x0F, 0x01, 0x83, 0xF8, 0xFE, 0x06, 0x07, 0xE7, 0xFE, 0x1F, 0xFB, 0xEC, 0x78, 0x1E, 0x66, 0xC6,
+    0xCC, 0xF0, 0x6C, 0x6F, 0xB6, 0x7C, 0x41, 0x4E, 0x68, 0xB4, 0x1A, 0x0D, 0x16, 0x72, 0x82, 0x3E,
+    0x38, 0x2F, 0x8B, 0xC1, 0xF3, 0x36, 0x6C, 0xC6, 0x63, 0x3F, 0xF0, 0x30, 0x3F, 0xE7, 0xC4, 0x15,
+    0xC6, 0x93, 0x71, 0xA8, 0xD2, 0x60, 0x28, 0x23, 0xE7, 0xFD, 0xD1, 0x8B, 0x83, 0x01, 0x8F, 0xF8,
+    0x60, 0x30, 0x00, 0xFF, 0xB9, 0x10, 0x84, 0x3F, 0xC2, 0xC3, 0xC7, 0x98, 0x6C, 0x36, 0x1B, 0x0D,
+    0x86, 0xE7, 0x6E, 0xF0, 0x18, 0x0C, 0x03, 0xFF, 0xD7, 0xD3, 0xD0, 0xD0, 0x50, 0x50, 0x50, 0x50,
+    0x50, 0x57, 0xBC, 0xB2, 0x5D, 0xD1, 0x8C, 0x5C, 0x0F, 0xE6, 0x33, 0x19, 0xB3, 0x66, 0x20, 0x38,
+    0x0A, 0x04, 0x82, 0x70, 0x80, 0x40, 0x20, 0x12, 0x84, 0xA2, 0x39, 0x02, 0x80, 0xA0, 0x38, 0x0A,
+    0x04, 0x82, 0x70, 0x80, 0x40, 0x20, 0x13, 0x04, 0x22, 0x11, 0x08, 0x83, 0xE0, 0x24, 0x0A, 0x04,
+    0x42, 0x60, 0x80, 0x40, 0x20, 0x12, 0x84, 0xA2, 0x39, 0x02, 0x80, 0x8C, 0x00, 0x30, 0x63, 0x8C,
+    0x18, 0xF1, 0xBE, 0x18, 0x01, 0x80, 0x01, 0xF8, 0x1E, 0x04, 0x83, 0x30, 0xFC, 0x61, 0x98, 0x6F,
+    0x3C, 0x18, 0x18, 0x00, 0x07, 0xE0, 0x78, 0x12, 0x0C, 0xC3, 0xF1, 0x86, 0x61, 0xBC, 0xF0, 0x80,
+    0x50, 0x00, 0x1F, 0x81, 0xE0, 0x48, 0x33, 0x0F, 0xC6, 0x19, 0x86, 0xF3, 0xC6, 0x82, 0xC0, 0x00,
+    0x7E, 0x07, 0x81, 0x20, 0xCC, 0x3F, 0x18, 0x66, 0x1B, 0xCF, 0x36, 0x00, 0x00, 0x01, 0xF8, 0x1E,
+    0x04, 0x83, 0x30, 0xFC, 0x61, 0x98, 0x6F, 0x3C, 0x70, 0x14, 0x00, 0x07, 0xE0, 0x78, 0x12, 0x0C,
+    0xC3, 0xF1, 0x86, 0x61, 0xBC, 0xF3, 0xFC, 0xD9, 0x66, 0x19, 0xA7, 0xF3, 0x1A, 0xC6, 0x31, 0x9E,
+    0xFC, 0xFA, 0xC3, 0xC0, 0xE0, 0x30, 0x18, 0x0C, 0x0B, 0x08, 0xF8, 0x18, 0x18, 0x18, 0x06, 0x00,
+    0x7F, 0xB0, 0xB2, 0x3E, 0x32, 0x30, 0xB0, 0xFF, 0x86, 0x18, 0x00, 0x7F, 0xB0, 0xB2, 0x3E, 0x32,
+    0x30, 0xB0, 0xFF, 0x88, 0x14, 0x00, 0x7F, 0xB0, 0xB2, 0x3E, 0x32, 0x30, 0xB0, 0xFF, 0xB6, 0x00,
+    0x00, 0x7F, 0xB0, 0xB2, 0x3E, 0x32, 0x30, 0xB0, 0xFF, 0x98, 0x06, 0x00, 0x7F, 0x8C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x7F, 0x86, 0x18, 0x00, 0x7F, 0x8C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x7F, 0x88,
+    0x14, 0x00, 0x7F, 0x8C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x7F, 0xB6, 0x00, 0x00, 0x7F, 0x8C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x7F, 0xBF, 0x86, 0x31, 0x86, 0x61, 0xFC, 0x66, 0x19, 0x86, 0x63, 0x3F,
+    0x83, 0x42, 0xC7, 0x3D, 0x8C, 0xE6, 0x7B, 0x35, 0x9B, 0xCC, 0xE6, 0x37, 0x98, 0x60, 0x0C, 0x00,
+    0x1F, 0x18, 0xD8, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x03, 0x06, 0x00, 0x03, 0xE3, 0x1B, 0x07,
+    0x83, 0xC1, 0xE0, 0xD8, 0xC7, 0xC0, 0x80, 0xA0, 0x00, 0x7C, 0x63, 0x60, 0xF0, 0x78, 0x3C, 0x1B,
+    0x18, 0xF8, 0x34, 0x2C, 0x00, 0x0F, 0x8C, 0x6C, 0x1E, 0x0F, 0x07, 0x83, 0x63, 0x1F, 0x0D, 0x80,
+    0x00, 0x01, 0xF1, 0x8D, 0x83, 0xC1, 0xE0, 0xF0, 0x6C, 0x63, 0xE6, 0x36, 0xC7, 0x1B, 0x63, 0x00,
+    0x9F, 0x58, 0xD8, 0x7C, 0x5E, 0x4F, 0x27, 0xA3, 0x63, 0x3F, 0x20, 0x03, 0x00, 0x60, 0x03, 0xDE,
+    0xC6, 0x63, 0x31, 0x98, 0xCC, 0x66, 0x31, 0xF0, 0x18, 0x30, 0x00, 0x7B, 0xD8, 0xCC, 0x66, 0x33,
+    0x19, 0x8C, 0xC6, 0x3E, 0x04, 0x05, 0x00, 0x0F, 0x7B, 0x19, 0x8C, 0xC6, 0x63, 0x31, 0x98, 0xC7,
+    0xC3, 0x60, 0x00, 0x01, 0xEF, 0x63, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x18, 0xF8, 0x0C, 0x0C, 0x00,
+    0x07, 0x9E, 0xC3, 0x19, 0x83, 0xC0, 0x60, 0x18, 0x06, 0x07, 0xE7, 0x83, 0x03, 0xF3, 0x1B, 0x1B,
+    0xF3, 0x03, 0x07, 0x81, 0xE3, 0x33, 0x33, 0x63, 0x73, 0x1B, 0x1B, 0x1B, 0x77, 0x61, 0x80, 0x60,
+    0x03, 0xE0, 0x30, 0x33, 0xF6, 0x36, 0x73, 0xB8, 0x61, 0x80, 0x03, 0xE0, 0x30, 0x33, 0xF6, 0x36,
+    0x73, 0xB8, 0x81, 0x40, 0x03, 0xE0, 0x30, 0x33, 0xF6, 0x36, 0x73, 0xB9, 0xA2, 0xC0, 0x03, 0xE0,
+    0x30, 0x33, 0xF6, 0x36, 0x73, 0xBB, 0x60, 0x00, 0x03, 0xE0, 0x30, 0x33, 0xF6, 0x36, 0x73, 0xB9,
+    0xC1, 0x40, 0x03, 0xE0, 0x30, 0x33, 0xF6, 0x36, 0x73, 0xBB, 0xB8, 0x19, 0x06, 0x4F, 0xF6, 0x61,
+    0x98, 0xBB, 0xC7, 0xAC, 0x78, 0x38, 0x18, 0x2C, 0x67, 0xC3, 0x06, 0x03, 0x00, 0x60, 0x00, 0xF8,
+    0xC6, 0xC1, 0xFF, 0xF0, 0x0C, 0x33, 0xF0, 0x30, 0x60, 0x00, 0x3E, 0x31, 0xB0, 0x7F, 0xFC, 0x03,
+    0x0C, 0xFC, 0x10, 0x14, 0x00, 0x0F, 0x8C, 0x6C, 0x1F, 0xFF, 0x00, 0xC3, 0x3F, 0x1B, 0x00, 0x00,
+    0x03, 0xE3, 0x1B, 0x07, 0xFF, 0xC0, 0x30, 0xCF, 0xC6, 0x01, 0x80, 0x0F, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x1F, 0xE1, 0x86, 0x00, 0x0F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1F, 0xE2, 0x05, 0x00, 0x0F,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x1F, 0xED, 0x80, 0x00, 0x0F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1F,
+    0xED, 0x03, 0x82, 0x60, 0x18, 0x7E, 0x61, 0xE0, 0xF0, 0x6C, 0x63, 0xE0, 0xD0, 0xB0, 0x00, 0xEE,
+    0x39, 0x98, 0xCC, 0x66, 0x33, 0x1B, 0xDE, 0x30, 0x06, 0x00, 0x0F, 0x8C, 0x6C, 0x1E, 0x0F, 0x06,
+    0xC6, 0x3E, 0x03, 0x06, 0x00, 0x03, 0xE3, 0x1B, 0x07, 0x83, 0xC1, 0xB1, 0x8F, 0x81, 0x01, 0x40,
+    0x00, 0xF8, 0xC6, 0xC1, 0xE0, 0xF0, 0x6C, 0x63, 0xE0, 0xD0, 0xB0, 0x00, 0x3E, 0x31, 0xB0, 0x78,
+    0x3C, 0x1B, 0x18, 0xF8, 0x6C, 0x00, 0x00, 0x0F, 0x8C, 0x6C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x06,
+    0x03, 0x00, 0x0F, 0xF8, 0x00, 0x30, 0x18, 0x00, 0x9F, 0x98, 0xD8, 0xBC, 0x9E, 0x8D, 0x8C, 0xFC,
+    0x80, 0x0C, 0x01, 0x80, 0x0E, 0x73, 0x19, 0x8C, 0xC6, 0x63, 0x33, 0x8E, 0xE0, 0xC1, 0x80, 0x03,
+    0x9C, 0xC6, 0x63, 0x31, 0x98, 0xCC, 0xE3, 0xB8, 0x40, 0x50, 0x00, 0xE7, 0x31, 0x98, 0xCC, 0x66,
+    0x33, 0x38, 0xEE, 0x6C, 0x00, 0x00, 0x39, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xCE, 0x3B, 0x83, 0x03,
+    0x00, 0x01, 0xE7, 0xB0, 0xC6, 0x61, 0x98, 0x2C, 0x0F, 0x01, 0x80, 0x60, 0x30, 0x3E, 0x1C, 0x06,
+    0x03, 0x01, 0xB8, 0xE6, 0x61, 0xB0, 0xD8, 0x6E, 0x66, 0xE3, 0x01, 0x81, 0xE0, 0x36, 0x00, 0x00,
+    0x03, 0xCF, 0x61, 0x8C, 0xC3, 0x30, 0x58, 0x1E, 0x03, 0x00, 0xC0, 0x60, 0x7C, 0x3F, 0xFF, 0xFD,
+    0xBF, 0xD9, 0x18, 0xB3, 0xCF, 0x3C, 0xD1, 0x89, 0xDF, 0xFF, 0xDD, 0x99, 0xE6, 0x61, 0xF0, 0xC6,
+    0x60, 0x7F, 0x06, 0x07, 0xF0, 0x60, 0x0C, 0x61, 0xF0, 0x80, 0x60, 0x38, 0x1F, 0xFB, 0x80, 0x60,
+    0x08, 0x02, 0x0E, 0x3E, 0xFE, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x04, 0x01, 0x80, 0x77,
+    0xFE, 0x07, 0x01, 0x80, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x47, 0xF7, 0xC7, 0x04, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x82, 0x08, 0x20, 0x82, 0x08, 0x3F, 0x04, 0x10, 0x41, 0x04, 0x10, 0x41,
+    0x82, 0x08, 0x20, 0x82, 0x08, 0x3F, 0x04, 0x10, 0x41, 0x04, 0x10, 0x7F, 0x82, 0x08, 0x20, 0x82,
+    0x08, 0x3F, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x04, 0x10, 0x41, 0x04, 0x10, 0x7F, 0x04, 0x10,
+    0x41, 0x04, 0x10, 0x41, 0xFF, 0xE0, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0x04,
+    0x00, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20, 0xFF, 0xE0, 0x80, 0x10, 0x02, 0x00,
+    0x40, 0x08, 0x01, 0x00, 0x20, 0xFF, 0xE0, 0x80, 0x10, 0x02, 0x00, 0x40, 0x08, 0x01, 0x00, 0x20,
+    0x04, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF5, 0x54, 0x00, 0x2A, 0xA0, 0x01, 0x55, 0x40, 0x02, 0xAA, 0x00, 0x15, 0x54,
+    0x00, 0x2A, 0xA0, 0x01, 0x55, 0x40, 0x02, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x5F,
+    0xFE, 0xAA, 0xFF, 0xF5, 0x55, 0xFF, 0xEA, 0xAF, 0xFF, 0x55, 0x5F, 0xFE, 0xAA, 0xFF, 0xF5, 0x55,
+    0xFF, 0xEA, 0xAF, 0xFF, 0xFF, 0xC0, 0x67, 0x34, 0x58, 0x4C, 0x46, 0x03, 0x11, 0x80, 0xFF, 0xC0,
+};
+
+static const codepoint_range g_unicode16_ranges[] = {
+    { 0x0020,  95,   0 },
+    { 0x00A0,  96,  95 },
+    { 0x2013,   2, 191 },
+    { 0x2018,   2, 193 },
+    { 0x201C,   2, 195 },
+    { 0x2022,   1, 197 },
+    { 0x2026,   1, 198 },
+    { 0x20AC,   1, 199 },
+    { 0x2190,   4, 200 },
+    { 0x2500,   1, 204 },
+    { 0x2502,   1, 205 },
+    { 0x250C,   1, 206 },
+    { 0x2510,   1, 207 },
+    { 0x2514,   1, 208 },
+    { 0x2518,   1, 209 },
+    { 0x251C,   1, 210 },
+    { 0x2524,   1, 211 },
+    { 0x252C,   1, 212 },
+    { 0x2534,   1, 213 },
+    { 0x253C,   1, 214 },
+    { 0x2580,   1, 215 },
+    { 0x2584,   1, 216 },
+    { 0x2588,   1, 217 },
+    { 0x258C,   1, 218 },
+    { 0x2590,   4, 219 },
+    { 0xFFFD,   1, 223 },
+};
+
+const unicode_font UnicodeFont16 {
+    {
+        g_unicode16_offsets, g_unicode16_box_indices, g_unicode16_boxes, g_unicode16_bits,
+        sizeof(g_unicode16_bits), 100, 11, 16, 0, 224,
+    },
+    g_unicode16_ranges, 26, 223,
+};
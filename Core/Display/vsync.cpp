@@ -0,0 +1,147 @@
+/*
+ * vsync.cpp
+ *
+ * Tracks the LCD refresh from its tearing effect line.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "vsync.h"
+
+#include "cycles.h"
+#include "stm32l562e_discovery_lcd.h"
+
+namespace vsync {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Visible rows, out of PANEL_LINES */
+static constexpr std::uint32_t SCREEN_LINES { 240 };
+
+static bool g_enabled {};
+
+/* Written by the TE interrupt; read together with interrupts off */
+static volatile std::uint32_t g_frames {};
+static volatile std::uint64_t g_last_edge {};
+static volatile std::uint32_t g_period {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void panel_rows(const rect &r, std::uint32_t &first, std::uint32_t &last);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool init() {
+    g_enabled = BSP_LCD_EnableTearingEffect(0) == BSP_ERROR_NONE;
+    return g_enabled;
+}
+
+std::uint32_t frames() {
+    return g_frames;
+}
+
+std::uint32_t period_us() {
+    return static_cast<std::uint32_t>(cycles::to_us(g_period));
+}
+
+std::optional<std::uint32_t> scan_line() {
+    if (!g_enabled) {
+        return std::nullopt;
+    }
+
+    const auto primask = __get_PRIMASK();
+    __disable_irq();
+    const std::uint64_t last_edge = g_last_edge;
+    const std::uint32_t period = g_period;
+    __set_PRIMASK(primask);
+
+    if (period == 0) {
+        return std::nullopt;
+    }
+
+    const auto elapsed = cycles::now() - last_edge;
+    if (elapsed >= 2ULL * period) {
+        return std::nullopt;
+    }
+
+    /* If an edge was missed, assume the refresh carried on at the same rate */
+    return static_cast<std::uint32_t>((elapsed % period) * PANEL_LINES / period);
+}
+
+bool wait_for(const rect &r) {
+    std::uint32_t first, last;
+    panel_rows(r, first, last);
+
+    bool waited = false;
+    while (true) {
+        const auto line = scan_line();
+        if (!line) {
+            return waited;
+        }
+
+        /* Rows from the scan down to the region, and whether the scan is inside it */
+        const auto ahead = (first + PANEL_LINES - *line) % PANEL_LINES;
+        const bool inside = (*line + PANEL_LINES - first) % PANEL_LINES < last - first;
+
+        if (!inside && ahead > LEAD_LINES) {
+            return waited;
+        }
+        waited = true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Frame memory rows [first, last) refreshed for a screen rectangle; see ST7789H2_SetOrientation */
+static void panel_rows(const rect &r, std::uint32_t &first, std::uint32_t &last) {
+    std::uint32_t orientation = LCD_ORIENTATION_PORTRAIT;
+    (void) Lcd_Drv[0]->GetOrientation(Lcd_CompObj[0], &orientation);
+
+    switch (orientation) {
+        case LCD_ORIENTATION_PORTRAIT_ROT180:  /* MY = 1: rows reversed */
+            first = SCREEN_LINES - r.bottom();
+            last = SCREEN_LINES - r.y;
+            break;
+
+        case LCD_ORIENTATION_LANDSCAPE:  /* MV = 1, MY = 1: columns reversed */
+            first = SCREEN_LINES - r.right();
+            last = SCREEN_LINES - r.x;
+            break;
+
+        case LCD_ORIENTATION_LANDSCAPE_ROT180:  /* MV = 1: columns */
+            first = r.x;
+            last = r.right();
+            break;
+
+        default:
+            first = r.y;
+            last = r.bottom();
+            break;
+    }
+}
+
+}  // namespace vsync
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Interrupt callbacks
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BSP_LCD_TearingEffect_Callback(uint32_t Instance) {
+    (void) Instance;
+
+    const auto now = cycles::now();
+    if (vsync::g_frames > 0) {
+        vsync::g_period = static_cast<std::uint32_t>(now - vsync::g_last_edge);
+    }
+    vsync::g_last_edge = now;
+    vsync::g_frames = vsync::g_frames + 1;
+}
@@ -0,0 +1,72 @@
+/*
+ * vsync.h
+ *
+ * Tracks the LCD refresh from its tearing effect (TE) line. The panel raises TE once per refresh,
+ * when it starts vertical blanking, then scans frame memory rows 0 to 319 in order. Timing each
+ * edge gives the refresh period and, between edges, an estimate of the row being scanned, so
+ * GRAM writes can be started where the scan won't run into them.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "canvas.h"
+
+#include <cstdint>
+#include <optional>
+
+namespace vsync {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Frame memory rows the panel scans per refresh; only 240 of them are visible. */
+inline constexpr std::uint32_t PANEL_LINES { 320 };
+
+/**
+ * Rows the scan is allowed to be above a region when its write starts. The scan covers about 19
+ * rows a millisecond at 60 Hz, so this is a 16-line tile write with plenty of margin.
+ */
+inline constexpr std::uint32_t LEAD_LINES { 32 };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Enables the TE interrupt. Call after the LCD is initialized.
+ *
+ * @return whether TE is now enabled.
+ */
+bool init();
+
+/** Number of TE edges since init(). */
+std::uint32_t frames();
+
+/** The measured refresh period in microseconds, or 0 before two edges have been seen. */
+std::uint32_t period_us();
+
+/**
+ * Estimates the frame memory row being scanned right now.
+ *
+ * @return the row, from 0 to PANEL_LINES - 1, or nothing if TE isn't running (not enabled, not
+ *         yet measured, or no edge for a couple of periods, e.g. with the display off).
+ */
+std::optional<std::uint32_t> scan_line();
+
+/**
+ * Waits until a screen rectangle can be written without tearing: the scan has just left its
+ * rows, or is far enough above them that the write will finish first. Returns at once if TE
+ * isn't running.
+ *
+ * Assumes the hardware scroll start is 0, i.e. screen rows map straight to frame memory rows.
+ *
+ * @param r the screen rectangle about to be written.
+ * @return  whether it had to wait.
+ */
+bool wait_for(const rect &r);
+
+}  // namespace vsync
@@ -0,0 +1,268 @@
+/*
+ * widgets.cpp
+ *
+ * Retained widgets for status screens.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#include "widgets.h"
+
+#include <algorithm>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static constexpr rect SCREEN { 0, 0, compositor::SCREEN_WIDTH, compositor::SCREEN_HEIGHT };
+
+/* Most digits a value_label formats: 10 for an int32_t, more only for leading zeros after the point */
+static constexpr std::uint32_t MAX_DIGITS { 12 };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void pad(char *dst, const char *text, std::uint32_t columns, text_widget::Align align);
+static rect changed_cells(const char *before, const char *after, std::uint32_t columns,
+                          std::uint32_t x, std::uint32_t y, const aa_font &font);
+static std::size_t format_number(char *dst, std::int32_t value, std::uint32_t decimals);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+widget_tree::widget_tree() : _first { nullptr }, _layer { *this }, _screen {} {
+    _screen.add(_layer);
+}
+
+void widget_tree::add(widget &w, widget *parent) {
+    auto **link = (parent != nullptr) ? &parent->_first_child : &_first;
+    while (*link != nullptr) {
+        link = &(*link)->_next;
+    }
+    *link = &w;
+}
+
+void widget_tree::show() {
+    update(_first, true);
+    _screen.invalidate(SCREEN);
+}
+
+std::size_t widget_tree::render() {
+    update();
+    return _screen.flush();
+}
+
+widget_tree::tree_layer::tree_layer(widget_tree &tree) : layer { SCREEN }, _tree { tree } {
+
+}
+
+void widget_tree::tree_layer::draw(canvas &target) {
+    widget_tree::draw(_tree._first, target);
+}
+
+void panel::update(widget_tree &tree) {
+    (void) tree;
+}
+
+void panel::draw(canvas &target) {
+    target.fill(bounds(), _color);
+}
+
+text_widget::text_widget(const rect &bounds, const aa_font &font, Align align, std::uint16_t fg, std::uint16_t bg) :
+        widget { bounds }, _font { font }, _align { align }, _fg { fg }, _bg { bg },
+        _columns { std::min<std::uint32_t>(bounds.width / font.width, MAX_COLUMNS) }, _x {}, _y {}, _shown {} {
+
+    const auto margin = bounds.width - _columns * font.width;
+    _x = static_cast<std::uint16_t>(bounds.x + ((align == Align::RIGHT) ? margin : 0U));
+    _y = static_cast<std::uint16_t>(bounds.y + (bounds.height - std::min(bounds.height, font.height)) / 2U);
+    pad(_shown, "", _columns, _align);
+}
+
+void text_widget::show_text(widget_tree &tree, const char *text) {
+    char padded[MAX_COLUMNS + 1];
+    pad(padded, text, _columns, _align);
+
+    tree.invalidate(*this, changed_cells(_shown, padded, _columns, _x, _y, _font));
+    std::memcpy(_shown, padded, sizeof(_shown));
+}
+
+void text_widget::draw(canvas &target) {
+    target.fill(bounds(), _bg);
+    target.draw_text(_x, _y, _font, _shown, _fg, _bg);
+}
+
+void label::update(widget_tree &tree) {
+    show_text(tree, _text.load(std::memory_order_relaxed));
+}
+
+void value_label::update(widget_tree &tree) {
+    char text[MAX_COLUMNS + 1];
+    const auto length = format_number(text, _value.load(std::memory_order_relaxed), _decimals);
+
+    std::strncpy(&text[length], _unit, sizeof(text) - length - 1U);
+    text[sizeof(text) - 1U] = '\0';
+    show_text(tree, text);
+}
+
+void bar::update(widget_tree &tree) {
+    const auto &area = bounds();
+    const auto value = std::clamp(_value.load(std::memory_order_relaxed), _min, _max);
+    const auto span = static_cast<std::int64_t>(_max) - _min;
+    const auto filled = static_cast<std::uint16_t>(
+            (span > 0) ? (static_cast<std::int64_t>(value) - _min) * area.width / span : 0);
+
+    /* Only the columns between the old and new ends change */
+    if (filled != _filled) {
+        const auto left = std::min(filled, _filled);
+        tree.invalidate(*this, { static_cast<std::uint16_t>(area.x + left), area.y,
+                                 static_cast<std::uint16_t>(std::max(filled, _filled) - left), area.height });
+        _filled = filled;
+    }
+}
+
+void bar::draw(canvas &target) {
+    const auto &area = bounds();
+    target.fill({ area.x, area.y, _filled, area.height }, _fill);
+    target.fill({ static_cast<std::uint16_t>(area.x + _filled), area.y,
+                  static_cast<std::uint16_t>(area.width - _filled), area.height }, _track);
+}
+
+text_pane::text_pane(const rect &bounds, const aa_font &font, std::uint16_t fg, std::uint16_t bg) :
+        widget { bounds }, _font { font }, _fg { fg }, _bg { bg },
+        _rows { std::min<std::uint32_t>(bounds.height / font.height, MAX_LINES) },
+        _columns { std::min<std::uint32_t>(bounds.width / font.width, MAX_COLUMNS) },
+        _added {}, _text {}, _shown {} {
+
+    for (std::uint32_t row = 0; row < MAX_LINES; ++row) {
+        pad(_text[row].chars, "", _columns, text_widget::Align::LEFT);
+        pad(_shown[row].chars, "", _columns, text_widget::Align::LEFT);
+    }
+}
+
+bool text_pane::add_line(const char *text) {
+    line added {};
+    pad(added.chars, text, _columns, text_widget::Align::LEFT);
+
+    if (!_added.push(added)) {
+        return false;
+    }
+
+    mark_dirty();
+    return true;
+}
+
+void text_pane::update(widget_tree &tree) {
+    if (_rows == 0) {
+        return;
+    }
+
+    line added;
+    while (_added.pop(added)) {
+        std::memmove(&_text[0], &_text[1], (_rows - 1U) * sizeof(line));
+        _text[_rows - 1U] = added;
+    }
+
+    /* Everything moves up a line, but rows that come out the same aren't drawn */
+    const auto &area = bounds();
+    for (std::uint32_t row = 0; row < _rows; ++row) {
+        const auto y = area.y + row * _font.height;
+        tree.invalidate(*this, changed_cells(_shown[row].chars, _text[row].chars, _columns, area.x, y, _font));
+        _shown[row] = _text[row];
+    }
+}
+
+void text_pane::draw(canvas &target) {
+    const auto &area = bounds();
+    target.fill(area, _bg);
+
+    for (std::uint32_t row = 0; row < _rows; ++row) {
+        const auto y = area.y + row * _font.height;
+        if (y < target.area().bottom() && y + _font.height > target.area().y) {
+            target.draw_text(area.x, y, _font, _shown[row].chars, _fg, _bg);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void widget_tree::update(widget *first, bool all) {
+    for (auto *w = first; w != nullptr; w = w->_next) {
+        if (w->_dirty.exchange(false, std::memory_order_acquire) || all) {
+            w->update(*this);
+        }
+        update(w->_first_child, all);
+    }
+}
+
+void widget_tree::draw(widget *first, canvas &target) {
+    for (auto *w = first; w != nullptr; w = w->_next) {
+        if (w->bounds().intersects(target.area())) {
+            w->draw(target);
+            draw(w->_first_child, target);
+        }
+    }
+}
+
+/* Copies text into a field of columns characters, cut or padded with spaces */
+static void pad(char *dst, const char *text, std::uint32_t columns, text_widget::Align align) {
+    const auto length = std::min<std::uint32_t>(std::strlen(text), columns);
+    const auto start = (align == text_widget::Align::RIGHT) ? columns - length : 0U;
+
+    std::memset(dst, ' ', columns);
+    std::memcpy(&dst[start], text, length);
+    dst[columns] = '\0';
+}
+
+/* The cells of a line of text at x, y whose characters differ; empty if none do */
+static rect changed_cells(const char *before, const char *after, std::uint32_t columns,
+                          std::uint32_t x, std::uint32_t y, const aa_font &font) {
+    std::uint32_t first = columns;
+    std::uint32_t last = 0;
+    for (std::uint32_t i = 0; i < columns; ++i) {
+        if (before[i] != after[i]) {
+            first = std::min(first, i);
+            last = i;
+        }
+    }
+
+    if (first == columns) {
+        return {};
+    }
+
+    return { static_cast<std::uint16_t>(x + first * font.width), static_cast<std::uint16_t>(y),
+             static_cast<std::uint16_t>((last - first + 1U) * font.width), font.height };
+}
+
+/* Writes a number with a point decimals digits from the right, returns its length */
+static std::size_t format_number(char *dst, std::int32_t value, std::uint32_t decimals) {
+    char digits[MAX_DIGITS];
+    std::size_t count = 0;
+    decimals = std::min(decimals, MAX_DIGITS - 1U);
+
+    /* Digits from the lowest, with at least one before the point */
+    auto magnitude = (value < 0) ? 0U - static_cast<std::uint32_t>(value) : static_cast<std::uint32_t>(value);
+    do {
+        digits[count++] = static_cast<char>('0' + magnitude % 10U);
+        magnitude /= 10U;
+    } while (magnitude != 0U || count <= decimals);
+
+    std::size_t length = 0;
+    if (value < 0) {
+        dst[length++] = '-';
+    }
+    while (count > 0) {
+        if (count == decimals) {
+            dst[length++] = '.';
+        }
+        dst[length++] = digits[--count];
+    }
+    dst[length] = '\0';
+
+    return length;
+}
@@ -0,0 +1,339 @@
+/*
+ * widgets.h
+ *
+ * Retained widgets for status screens: panels, labels, values, bars and a text pane, in a tree
+ * drawn through a compositor (see compositor.h). Widgets are allocated by whoever owns them,
+ * usually statically, and linked into the tree; nothing is allocated on the heap.
+ *
+ * A widget's value can be set from any thread or ISR. Setting it only stores the value and sets
+ * the widget's dirty flag; nothing is drawn in the caller's context. On the next render(), the
+ * thread that owns the LCD takes the value of every dirty widget, and the widget invalidates just
+ * the part of itself that looks different: the characters of a value that changed, the columns a
+ * bar grew or shrank by. A value set to what's already shown draws nothing.
+ *
+ * Colors are RGB565, as on a canvas.
+ *
+ * Copyright (c) 2021 Cameron Kluza
+ * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "aa_font.h"
+#include "canvas.h"
+#include "compositor.h"
+#include "mpsc_queue.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+class widget_tree;
+
+/** Something in a widget_tree. */
+class widget {
+public:
+    explicit widget(const rect &bounds) :
+            _bounds { bounds }, _dirty { false }, _first_child { nullptr }, _next { nullptr } {
+
+    }
+
+    /** The part of the screen the widget draws in. */
+    const rect &bounds() const { return _bounds; }
+
+protected:
+    ~widget() = default;
+
+    /** Has update() called on the next render. Safe from any thread or ISR. */
+    void mark_dirty() { _dirty.store(true, std::memory_order_release); }
+
+    /**
+     * Takes the value set since the last update, and invalidates the parts of the widget it
+     * changes. Called by the tree, on the thread that renders it.
+     */
+    virtual void update(widget_tree &tree) = 0;
+
+    /**
+     * Draws the widget. The canvas may only hold part of it, and is already clipped.
+     *
+     * @param target where to draw.
+     */
+    virtual void draw(canvas &target) = 0;
+
+private:
+    friend class widget_tree;
+
+    rect _bounds;
+    std::atomic<bool> _dirty;
+
+    /** Links of the tree. */
+    widget *_first_child;
+    widget *_next;
+};
+
+class widget_tree {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    widget_tree();
+
+    /** Sets the color drawn where no widget covers the screen. */
+    void set_background(std::uint16_t color) { _screen.set_background(color); }
+
+    /** Sets whether frames are timed against the panel refresh; see compositor::set_vsync(). */
+    void set_vsync(bool enable) { _screen.set_vsync(enable); }
+
+    /** Frame counts since construction; see compositor::stats(). */
+    compositor::frame_stats stats() const { return _screen.stats(); }
+
+    /**
+     * Adds a widget, drawn over the widgets added before it. A child is only drawn where its
+     * parent is, so keep it inside its parent's bounds.
+     *
+     * @param w      the widget, which must outlive the tree.
+     * @param parent the widget it's a part of, or nullptr for the top level.
+     */
+    void add(widget &w, widget *parent = nullptr);
+
+    /** Takes every widget's value and invalidates the whole screen, to draw it from scratch. */
+    void show();
+
+    /**
+     * Takes the values of the widgets set since the last update, without drawing them: e.g. while
+     * the tree isn't on the screen, so a text pane doesn't drop lines. Only call from the thread
+     * that owns the LCD.
+     */
+    void update() { update(_first, false); }
+
+    /**
+     * Takes the values of the widgets set since the last update, and redraws what they changed.
+     * Only call from the thread that owns the LCD.
+     *
+     * @return the number of tiles sent to the LCD.
+     */
+    std::size_t render();
+
+    /** Marks part of a widget to be redrawn on the next render, clipped to its bounds. */
+    void invalidate(const widget &w, const rect &r) { _screen.invalidate(r.intersection(w.bounds())); }
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Draws the tree as the compositor's only layer. */
+    class tree_layer : public layer {
+    public:
+        explicit tree_layer(widget_tree &tree);
+        void draw(canvas &target) override;
+
+    private:
+        widget_tree &_tree;
+    };
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    widget *_first;
+    tree_layer _layer;
+    compositor _screen;
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Updates the widgets from first on, and their children: the dirty ones, or all of them. */
+    void update(widget *first, bool all);
+
+    /** Draws the widgets from first on that are on the canvas, and their children. */
+    static void draw(widget *first, canvas &target);
+};
+
+/** A solid rectangle, to group widgets on. */
+class panel : public widget {
+public:
+    panel(const rect &bounds, std::uint16_t color) : widget { bounds }, _color { color } {
+
+    }
+
+protected:
+    void update(widget_tree &tree) override;
+    void draw(canvas &target) override;
+
+private:
+    std::uint16_t _color;
+};
+
+/** A line of text, clipped to what fits; the base of label and value_label. */
+class text_widget : public widget {
+public:
+    /** Most characters shown. */
+    static constexpr std::uint32_t MAX_COLUMNS { 32 };
+
+    enum class Align : std::uint8_t {
+        LEFT,
+        RIGHT,
+    };
+
+protected:
+    text_widget(const rect &bounds, const aa_font &font, Align align, std::uint16_t fg, std::uint16_t bg);
+    ~text_widget() = default;
+
+    /** Shows text, invalidating the characters that differ from what's shown. */
+    void show_text(widget_tree &tree, const char *text);
+
+    void draw(canvas &target) override;
+
+private:
+    const aa_font &_font;
+    Align _align;
+    std::uint16_t _fg;
+    std::uint16_t _bg;
+
+    /** Characters that fit, and where the first is drawn. */
+    std::uint32_t _columns;
+    std::uint16_t _x;
+    std::uint16_t _y;
+
+    /** What's shown, padded with spaces to _columns. */
+    char _shown[MAX_COLUMNS + 1];
+};
+
+/** Text that's replaced as a whole, e.g. a caption or a state. */
+class label : public text_widget {
+public:
+    /**
+     * @param text a C-string; see set_text().
+     */
+    label(const rect &bounds, const aa_font &font, const char *text, std::uint16_t fg, std::uint16_t bg,
+          Align align = Align::LEFT) :
+            text_widget { bounds, font, align, fg, bg }, _text { text } {
+
+    }
+
+    /**
+     * Shows another string. The string isn't copied: keep it unchanged while it's set, e.g. a
+     * literal. Safe from any thread or ISR.
+     */
+    void set_text(const char *text) {
+        _text.store(text, std::memory_order_relaxed);
+        mark_dirty();
+    }
+
+protected:
+    void update(widget_tree &tree) override;
+
+private:
+    std::atomic<const char *> _text;
+};
+
+/** A number with a unit after it, right aligned, e.g. "-67 dBm". */
+class value_label : public text_widget {
+public:
+    /**
+     * @param decimals digits of the value after the point: 1 shows 1234 as 123.4.
+     * @param unit     a C-string shown after the number, e.g. " B/s".
+     */
+    value_label(const rect &bounds, const aa_font &font, std::uint32_t decimals, const char *unit,
+                std::uint16_t fg, std::uint16_t bg) :
+            text_widget { bounds, font, Align::RIGHT, fg, bg },
+            _decimals { decimals }, _unit { unit }, _value { 0 } {
+
+    }
+
+    /** Sets the value. Safe from any thread or ISR. */
+    void set(std::int32_t value) {
+        if (_value.exchange(value, std::memory_order_relaxed) != value) {
+            mark_dirty();
+        }
+    }
+
+protected:
+    void update(widget_tree &tree) override;
+
+private:
+    std::uint32_t _decimals;
+    const char *_unit;
+    std::atomic<std::int32_t> _value;
+};
+
+/** A horizontal bar filled in proportion to a value in a range. */
+class bar : public widget {
+public:
+    bar(const rect &bounds, std::int32_t min, std::int32_t max, std::uint16_t fill, std::uint16_t track) :
+            widget { bounds }, _min { min }, _max { max }, _fill { fill }, _track { track },
+            _value { min }, _filled { 0 } {
+
+    }
+
+    /** Sets the value; it's clamped to the range. Safe from any thread or ISR. */
+    void set(std::int32_t value) {
+        if (_value.exchange(value, std::memory_order_relaxed) != value) {
+            mark_dirty();
+        }
+    }
+
+protected:
+    void update(widget_tree &tree) override;
+    void draw(canvas &target) override;
+
+private:
+    std::int32_t _min;
+    std::int32_t _max;
+    std::uint16_t _fill;
+    std::uint16_t _track;
+    std::atomic<std::int32_t> _value;
+
+    /** Columns filled on the screen. */
+    std::uint16_t _filled;
+};
+
+/** Lines of text scrolling up as lines are added, like a log. */
+class text_pane : public widget {
+public:
+    /** Most lines and characters a line shown. */
+    static constexpr std::uint32_t MAX_LINES { 10 };
+    static constexpr std::uint32_t MAX_COLUMNS { text_widget::MAX_COLUMNS };
+
+    /** Lines that can be added between renders. */
+    static constexpr std::size_t QUEUE_LINES { 8 };
+
+    text_pane(const rect &bounds, const aa_font &font, std::uint16_t fg, std::uint16_t bg);
+
+    /**
+     * Adds a line at the bottom, scrolling the others up. The text is copied, and cut to what
+     * fits. Safe from any thread or ISR.
+     *
+     * @return false if QUEUE_LINES lines are already waiting; the line is dropped.
+     */
+    bool add_line(const char *text);
+
+protected:
+    void update(widget_tree &tree) override;
+    void draw(canvas &target) override;
+
+private:
+    struct line {
+        char chars[MAX_COLUMNS + 1];
+    };
+
+    const aa_font &_font;
+    std::uint16_t _fg;
+    std::uint16_t _bg;
+
+    /** Lines and characters that fit. */
+    std::uint32_t _rows;
+    std::uint32_t _columns;
+
+    /** Lines added, waiting for the next update. */
+    mpsc_queue<line, QUEUE_LINES> _added;
+
+    /** The lines with those added, then what's shown; top line first, padded to _columns. */
+    line _text[MAX_LINES];
+    line _shown[MAX_LINES];
+};
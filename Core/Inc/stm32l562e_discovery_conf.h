@@ -47,6 +47,12 @@ extern "C" {
 #define BSP_AUDIO_OUT_IT_PRIORITY   0x07UL  /* Default is lowest priority level */
 #define BSP_AUDIO_IN_IT_PRIORITY    0x07UL  /* Default is lowest priority level */
 
+/* LCD DMA interrupt priority */
+#define BSP_LCD_DMA_IT_PRIORITY     0x07UL  /* Default is lowest priority level */
+
+/* LCD tearing effect interrupt priority; only timestamps the edge, so kept above the DMA */
+#define BSP_LCD_TE_IT_PRIORITY      0x05UL
+
 /* SD card interrupt priority */
 #define BSP_SD_IT_PRIORITY          0x07UL  /* Default is lowest priority level */
 
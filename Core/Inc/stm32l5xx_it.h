@@ -44,7 +44,9 @@ void PendSV_Handler(void);
 void SysTick_Handler(void);
 void EXTI1_IRQHandler(void);
 void EXTI2_IRQHandler(void);
+void EXTI8_IRQHandler(void);
 void EXTI13_IRQHandler(void);
+void DMA1_Channel3_IRQHandler(void);
 void DMA1_Channel4_IRQHandler(void);
 void DMA2_Channel1_IRQHandler(void);
 void SDMMC1_IRQHandler(void);
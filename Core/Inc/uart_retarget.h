@@ -10,6 +10,70 @@
 
 #include "stm32l5xx_hal.h"
 
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size of the circular DMA receive ring. Holds a whole 4 KB paste even if nothing reads it. */
+#define UART_RETARGET_RX_SIZE 4096U
+
+/* Size of the TX ring that stdout is copied into and sent from with DMA. */
+#define UART_RETARGET_TX_SIZE 2048U
+
+/* What a write does when the TX ring doesn't have room for all of it. */
+typedef enum {
+    UART_RETARGET_TX_BLOCK,     /* wait for room; writes from interrupts truncate instead */
+    UART_RETARGET_TX_DROP,      /* drop the whole write */
+    UART_RETARGET_TX_TRUNCATE,  /* queue what fits, drop the rest */
+} uart_retarget_tx_policy_t;
+
+/* Counters for each outcome of a write. */
+typedef struct {
+    uint32_t bytes_sent;        /* bytes handed to the DMA */
+    uint32_t blocked_writes;    /* writes that had to wait for room */
+    uint32_t dropped_writes;    /* writes dropped whole */
+    uint32_t dropped_bytes;     /* bytes in dropped writes */
+    uint32_t truncated_writes;  /* writes that were cut short */
+    uint32_t truncated_bytes;   /* bytes cut from truncated writes */
+} uart_retarget_tx_stats_t;
+
+/* Sets up stdio over the UART: receiving into the RX ring with circular DMA and sending from the
+ * TX ring with chained DMA transfers. Hard-coded for USART1 (COM1) on DMA1 channels 1 and 2. */
 void uart_retarget_init(UART_HandleTypeDef *uart);
 
+/* Copies data into the TX ring and returns; the DMA sends it in the background. What happens
+ * when the ring is full depends on the TX policy. Safe to call from interrupts and threads.
+ * Returns len, since the bytes are either queued or dropped on purpose. */
+size_t uart_retarget_write(const char *ptr, size_t len);
+
+/* Sets what writes do when the TX ring is full. Defaults to UART_RETARGET_TX_BLOCK. */
+void uart_retarget_set_tx_policy(uart_retarget_tx_policy_t policy);
+
+/* Copies out the TX counters. */
+void uart_retarget_get_tx_stats(uart_retarget_tx_stats_t *stats);
+
+/* Reads up to len received bytes, waiting up to timeout_ms for the first one. Wakes as soon as a
+ * burst of bytes arrives (idle line, half or full ring). Only call from an RTOS thread.
+ * Returns the number of bytes read; 0 on timeout. */
+size_t uart_retarget_read(char *ptr, size_t len, uint32_t timeout_ms);
+
+/* Number of received bytes waiting to be read. */
+size_t uart_retarget_rx_available(void);
+
+/* Number of received bytes lost because the ring filled up before they were read, plus ring bytes
+ * skipped when a reception error restarted the DMA. */
+uint32_t uart_retarget_rx_overruns(void);
+
+/* Interrupt handlers, called from stm32l5xx_it.c */
+void uart_retarget_IRQHandler(void);
+void uart_retarget_RX_DMA_IRQHandler(void);
+void uart_retarget_TX_DMA_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* INC_UART_RETARGET_H_ */
@@ -20,11 +20,17 @@
 
 #include "ble.h"
 #include "bleuart.h"
+#include "cycles.h"
+#include "display.h"
+#include "log_store.h"
 #include "logger.h"
+#include "ospi_flash.h"
+#include "uart_retarget.h"
 
 #include <cmsis_os.h>
 
 #include <cstdio>
+#include <cstring>
 
 using ble::Role;
 
@@ -38,7 +44,9 @@ static void user_input_thread(void *arg);
 // Private data
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static char g_in_buffer[128] {};
+/* How long the input thread waits on the console before checking again */
+static constexpr std::uint32_t CONSOLE_READ_TIMEOUT_MS { 10 };
+
 static char g_out_buffer[128] {};
 static std::uint8_t g_out_buffer_idx {};
 
@@ -62,6 +70,12 @@ static const osThreadAttr_t log_thread_attr = {
     .priority = (osPriority_t) osPriorityNormal,
 };
 
+static const osThreadAttr_t display_thread_attr = {
+    .name = "display_thread",
+    .stack_size = 2048,
+    .priority = (osPriority_t) osPriorityNormal,
+};
+
 static ble_uart g_ble_uart {};
 
 /* Grab the UART from main.c */
@@ -76,7 +90,13 @@ extern "C" int main_cpp()
     /* Hardware init done by the CubeMX-generated main.c,
      * only need to init app stuff here. */
 
-    logger::init(&hcom_uart[COM1]);
+    cycles::init();
+    if (!ospi_flash::init()) {
+        LOG("%s: OSPI flash init failed\n", __func__);
+    }
+    if (!log_store::init()) {
+        LOG("%s: log store init failed\n", __func__);
+    }
 
     // Initialize the BLE as a server
     if (!ble::init(Role::SERVER)) {
@@ -96,9 +116,12 @@ extern "C" int main_cpp()
 
     printf("BLE UART setup\n");
 
+    display::register_ble_callbacks();
+
     osThreadNew(ble::thread, nullptr, &ble_thread_attr);
     osThreadNew(user_input_thread, &g_ble_uart, &uin_thread_attr);
     osThreadNew(logger::thread, nullptr, &log_thread_attr);
+    osThreadNew(display::thread, &g_ble_uart, &display_thread_attr);
 
     osKernelStart();
 
@@ -117,26 +140,39 @@ static void user_input_thread(void *arg) {
     auto *uart = reinterpret_cast<ble_uart *>(arg);
 
     while (1) {
-        auto c = getchar();
-        if (c > 0) {
-            g_out_buffer[g_out_buffer_idx] = static_cast<char>(c);
-            if ((g_out_buffer[g_out_buffer_idx] == '\r' || g_out_buffer[g_out_buffer_idx] == '\n') &&
-                    g_out_buffer_idx > 0) {
-                g_out_buffer[g_out_buffer_idx] = '\0';
-                logger::log("send: %s\n", g_out_buffer);
-                uart->write(g_out_buffer, g_out_buffer_idx);
-                g_out_buffer_idx = 0;
-            } else {
+        /* Sleeps until a burst comes in over the console, but not for too long so BLE RX is
+         * still serviced */
+        char chunk[64];
+        auto count = uart_retarget_read(chunk, sizeof(chunk), CONSOLE_READ_TIMEOUT_MS);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const char c = chunk[i];
+            const bool line_end = (c == '\r' || c == '\n');
+
+            if (line_end && g_out_buffer_idx == 0) {
+                continue;
+            }
+
+            /* Long lines (e.g. pastes) are sent in buffer-sized pieces */
+            if (!line_end) {
+                g_out_buffer[g_out_buffer_idx] = c;
                 ++g_out_buffer_idx;
             }
-        }
 
-        if (uart->available() > 0) {
-            auto read = uart->read(g_in_buffer, static_cast<std::uint8_t>(sizeof(g_in_buffer)));
-            if (read > 0) {
-                g_in_buffer[read] = '\0';
-                logger::log("recv: %s\n", g_in_buffer);
+            if (line_end || g_out_buffer_idx == sizeof(g_out_buffer) - 1) {
+                g_out_buffer[g_out_buffer_idx] = '\0';
+                /* Local commands rather than something to send */
+                if (std::strcmp(g_out_buffer, "/dump") == 0) {
+                    logger::dump_store();
+                } else if (std::strcmp(g_out_buffer, "/bench") == 0) {
+                    display::request_benchmark();
+                } else {
+                    LOG("send: %s\n", g_out_buffer);
+                    uart->write(g_out_buffer, g_out_buffer_idx);
+                }
+                g_out_buffer_idx = 0;
             }
         }
+
     }
 }
@@ -23,6 +23,7 @@
 #include "stm32l5xx_hal.h"
 #include "stm32l5xx_it.h"
 #include "main.h"
+#include "uart_retarget.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -142,11 +143,36 @@ void EXTI6_IRQHandler(void)
   /* USER CODE END EXTI6_IRQn 1 */
 }
 
+void EXTI8_IRQHandler(void)
+{
+  BSP_LCD_TE_IRQHandler(0);
+}
+
 void EXTI13_IRQHandler(void)
 {
   BSP_PB_IRQHandler(BUTTON_USER);
 }
 
+void USART1_IRQHandler(void)
+{
+  uart_retarget_IRQHandler();
+}
+
+void DMA1_Channel1_IRQHandler(void)
+{
+  uart_retarget_RX_DMA_IRQHandler();
+}
+
+void DMA1_Channel2_IRQHandler(void)
+{
+  uart_retarget_TX_DMA_IRQHandler();
+}
+
+void DMA1_Channel3_IRQHandler(void)
+{
+  BSP_LCD_DMA_IRQHandler(0);
+}
+
 void DMA1_Channel4_IRQHandler(void)
 { 
   BSP_AUDIO_IN_IRQHandler(1, AUDIO_IN_DIGITAL_MIC);
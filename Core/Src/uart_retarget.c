@@ -7,38 +7,333 @@
 
 #include "uart_retarget.h"
 
+#include "FreeRTOS.h"
+#include "cmsis_os.h"
+
 #include <stdio.h>
 #include <string.h>
 
 static UART_HandleTypeDef *g_uart;
 
+/* RX ring, written by circular DMA. Head and tail are free-running byte counts; the head is
+ * only advanced from the UART/DMA interrupts, the tail only by the (single) reader. */
+static uint8_t g_rx_ring[UART_RETARGET_RX_SIZE];
+static volatile uint32_t g_rx_head;
+static volatile uint32_t g_rx_tail;
+static uint16_t g_rx_dma_pos;
+static volatile uint32_t g_rx_overruns;
+
+/* Ring bytes jumped over when a reception error restarted the DMA: the last gap ends at
+ * g_rx_gap_end (a head count) and is g_rx_gap bytes long. The reader skips them. */
+static volatile uint32_t g_rx_gap_end;
+static volatile uint32_t g_rx_gap;
+
+static DMA_HandleTypeDef g_rx_dma;
+
+/* TX ring, sent by DMA one contiguous chunk at a time. Head and tail are free-running byte
+ * counts, only changed with interrupts masked since writers can be threads or interrupts. */
+static uint8_t g_tx_ring[UART_RETARGET_TX_SIZE];
+static uint32_t g_tx_head;
+static volatile uint32_t g_tx_tail;
+static uint32_t g_tx_in_flight;
+static volatile uart_retarget_tx_policy_t g_tx_policy = UART_RETARGET_TX_BLOCK;
+static uart_retarget_tx_stats_t g_tx_stats;
+
+static DMA_HandleTypeDef g_tx_dma;
+
+/* Released from the RX interrupts to wake a waiting reader */
+static StaticSemaphore_t g_rx_sem_cb;
+static osSemaphoreId_t g_rx_sem;
+static const osSemaphoreAttr_t g_rx_sem_attr = {
+    .name = "uart_rx",
+    .cb_mem = &g_rx_sem_cb,
+    .cb_size = sizeof(g_rx_sem_cb),
+};
+
+static void rx_dma_init(void);
+static void rx_start(void);
+static uint16_t rx_distance(uint16_t from, uint16_t to);
+static size_t rx_pop(char *ptr, size_t len);
+static void tx_dma_init(void);
+static size_t tx_push(const char *ptr, size_t len);
+static void tx_kick(void);
+static int tx_can_wait(uint32_t primask);
+
 void uart_retarget_init(UART_HandleTypeDef *uart) {
     g_uart = uart;
     setvbuf(stdout, NULL, _IONBF, 0); // no buffer
     setvbuf(stdin, NULL, _IONBF, 0); // no buffer
+
+    g_rx_sem = osSemaphoreNew(1, 0, &g_rx_sem_attr);
+    rx_dma_init();
+    rx_start();
+    tx_dma_init();
 }
 
-/* Override the weak symbols defined in syscalls.h */
+size_t uart_retarget_write(const char *ptr, size_t len) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
 
-int _read(int file, char *ptr, int len) { // non-blocking
-    if (!(g_uart->Instance->ISR & USART_ISR_RXNE_RXFNE)) {
-        return -1; // nothing to read
+    uart_retarget_tx_policy_t policy = g_tx_policy;
+    size_t space = UART_RETARGET_TX_SIZE - (g_tx_head - g_tx_tail);
+
+    if (space >= len) {
+        tx_push(ptr, len);
+    } else if (policy == UART_RETARGET_TX_DROP) {
+        ++g_tx_stats.dropped_writes;
+        g_tx_stats.dropped_bytes += len;
+    } else if (policy == UART_RETARGET_TX_TRUNCATE || !tx_can_wait(primask)) {
+        tx_push(ptr, space);
+        ++g_tx_stats.truncated_writes;
+        g_tx_stats.truncated_bytes += len - space;
+    } else {
+        /* Block: queue what fits and wait for the DMA to make room for the rest */
+        ++g_tx_stats.blocked_writes;
+        size_t queued = 0;
+        while (queued < len) {
+            queued += tx_push(&ptr[queued], len - queued);
+            __set_PRIMASK(primask);
+            if (queued < len && osKernelGetState() == osKernelRunning) {
+                osDelay(1);
+            }
+            __disable_irq();
+        }
     }
 
-    int read = 0;
-    while ((g_uart->Instance->ISR & USART_ISR_RXNE_RXFNE)) {
-        ptr[read] = (char) g_uart->Instance->RDR;
-        ++read;
+    __set_PRIMASK(primask);
+
+    return len;
+}
+
+void uart_retarget_set_tx_policy(uart_retarget_tx_policy_t policy) {
+    g_tx_policy = policy;
+}
+
+void uart_retarget_get_tx_stats(uart_retarget_tx_stats_t *stats) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = g_tx_stats;
+    __set_PRIMASK(primask);
+}
+
+size_t uart_retarget_read(char *ptr, size_t len, uint32_t timeout_ms) {
+    uint32_t start = osKernelGetTickCount();
+    uint32_t timeout = timeout_ms * osKernelGetTickFreq() / 1000U;
+
+    while (1) {
+        size_t count = rx_pop(ptr, len);
+        if (count > 0) {
+            return count;
+        }
+
+        uint32_t elapsed = osKernelGetTickCount() - start;
+        if (elapsed >= timeout || osSemaphoreAcquire(g_rx_sem, timeout - elapsed) != osOK) {
+            return 0;
+        }
     }
-    return read;
 }
 
-int _write(int file, char *ptr, int len) { // blocking
-    HAL_StatusTypeDef ret = HAL_UART_Transmit(g_uart, (uint8_t *) ptr, (uint16_t) len, HAL_MAX_DELAY);
+size_t uart_retarget_rx_available(void) {
+    uint32_t available = g_rx_head - g_rx_tail;
+    return (available < UART_RETARGET_RX_SIZE) ? available : UART_RETARGET_RX_SIZE;
+}
 
-    if (ret == HAL_OK) {
-        return len;
-    } else {
-        return 0;
+uint32_t uart_retarget_rx_overruns(void) {
+    return g_rx_overruns;
+}
+
+void uart_retarget_IRQHandler(void) {
+    HAL_UART_IRQHandler(g_uart);
+}
+
+void uart_retarget_RX_DMA_IRQHandler(void) {
+    HAL_DMA_IRQHandler(&g_rx_dma);
+}
+
+void uart_retarget_TX_DMA_IRQHandler(void) {
+    HAL_DMA_IRQHandler(&g_tx_dma);
+}
+
+/* Called by the HAL on idle line, half ring and full ring. Size is the DMA position in the ring. */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size) {
+    if (huart != g_uart) {
+        return;
+    }
+
+    uint16_t received = rx_distance(g_rx_dma_pos, Size);
+    g_rx_dma_pos = (uint16_t) (Size % UART_RETARGET_RX_SIZE);
+
+    g_rx_head += received;
+    osSemaphoreRelease(g_rx_sem);
+}
+
+/* Called by the HAL when a DMA transfer has gone out; chain the next chunk */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) {
+    if (huart != g_uart) {
+        return;
+    }
+
+    g_tx_tail += g_tx_in_flight;
+    g_tx_in_flight = 0;
+    tx_kick();
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
+    /* Framing/noise errors abort the DMA reception, so start it again */
+    if (huart != g_uart || huart->RxState != HAL_UART_STATE_READY) {
+        return;
+    }
+
+    /* Count what the DMA wrote since the last event, then skip the head to the start of the
+     * ring, where the restarted DMA writes */
+    uint16_t position = (uint16_t) ((UART_RETARGET_RX_SIZE - __HAL_DMA_GET_COUNTER(huart->hdmarx)) %
+                                    UART_RETARGET_RX_SIZE);
+    uint32_t head = g_rx_head + rx_distance(g_rx_dma_pos, position);
+    uint32_t gap = (UART_RETARGET_RX_SIZE - head % UART_RETARGET_RX_SIZE) % UART_RETARGET_RX_SIZE;
+
+    g_rx_gap = gap;
+    g_rx_gap_end = head + gap;
+    g_rx_head = head + gap;
+    g_rx_overruns += gap;
+
+    rx_start();
+    osSemaphoreRelease(g_rx_sem);
+}
+
+static void rx_dma_init(void) {
+    __HAL_RCC_DMAMUX1_CLK_ENABLE();
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    g_rx_dma.Instance = DMA1_Channel1;
+    g_rx_dma.Init.Request = DMA_REQUEST_USART1_RX;
+    g_rx_dma.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    g_rx_dma.Init.PeriphInc = DMA_PINC_DISABLE;
+    g_rx_dma.Init.MemInc = DMA_MINC_ENABLE;
+    g_rx_dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    g_rx_dma.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    g_rx_dma.Init.Mode = DMA_CIRCULAR;
+    g_rx_dma.Init.Priority = DMA_PRIORITY_HIGH;
+    HAL_DMA_Init(&g_rx_dma);
+    __HAL_LINKDMA(g_uart, hdmarx, g_rx_dma);
+
+    /* Below configMAX_SYSCALL_INTERRUPT_PRIORITY so the callbacks can use the RTOS */
+    HAL_NVIC_SetPriority(DMA1_Channel1_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+    HAL_NVIC_SetPriority(USART1_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(USART1_IRQn);
+}
+
+static void rx_start(void) {
+    /* A fresh reception starts at the beginning of the ring */
+    g_rx_dma_pos = 0;
+    HAL_UARTEx_ReceiveToIdle_DMA(g_uart, g_rx_ring, UART_RETARGET_RX_SIZE);
+}
+
+/* Bytes the DMA moved on from one ring position to another */
+static uint16_t rx_distance(uint16_t from, uint16_t to) {
+    return (to >= from) ? (uint16_t) (to - from) : (uint16_t) (UART_RETARGET_RX_SIZE - from + to);
+}
+
+static size_t rx_pop(char *ptr, size_t len) {
+    /* The gap and head are changed together from the error callback */
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t head = g_rx_head;
+    uint32_t gap_end = g_rx_gap_end;
+    uint32_t gap = g_rx_gap;
+    __set_PRIMASK(primask);
+
+    uint32_t tail = g_rx_tail;
+
+    /* The DMA has lapped the reader, the oldest bytes were overwritten */
+    if (head - tail > UART_RETARGET_RX_SIZE) {
+        g_rx_overruns += head - tail - UART_RETARGET_RX_SIZE;
+        tail = head - UART_RETARGET_RX_SIZE;
+    }
+
+    /* Nothing was received in the gap; those bytes are stale */
+    if (gap_end - tail - 1U < gap) {
+        tail = gap_end;
+    }
+
+    size_t available = head - tail;
+    size_t count = (len < available) ? len : available;
+
+    for (size_t i = 0; i < count; ++i) {
+        ptr[i] = (char) g_rx_ring[(tail + i) % UART_RETARGET_RX_SIZE];
     }
+    g_rx_tail = tail + count;
+
+    return count;
+}
+
+static void tx_dma_init(void) {
+    g_tx_dma.Instance = DMA1_Channel2;
+    g_tx_dma.Init.Request = DMA_REQUEST_USART1_TX;
+    g_tx_dma.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    g_tx_dma.Init.PeriphInc = DMA_PINC_DISABLE;
+    g_tx_dma.Init.MemInc = DMA_MINC_ENABLE;
+    g_tx_dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    g_tx_dma.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    g_tx_dma.Init.Mode = DMA_NORMAL;
+    g_tx_dma.Init.Priority = DMA_PRIORITY_MEDIUM;
+    HAL_DMA_Init(&g_tx_dma);
+    __HAL_LINKDMA(g_uart, hdmatx, g_tx_dma);
+
+    HAL_NVIC_SetPriority(DMA1_Channel2_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Channel2_IRQn);
+}
+
+/* Copies as much as fits into the TX ring and starts the DMA if it's idle. Interrupts must be
+ * masked. Returns the number of bytes queued. */
+static size_t tx_push(const char *ptr, size_t len) {
+    size_t space = UART_RETARGET_TX_SIZE - (g_tx_head - g_tx_tail);
+    size_t count = (len < space) ? len : space;
+
+    for (size_t i = 0; i < count; ++i) {
+        g_tx_ring[(g_tx_head + i) % UART_RETARGET_TX_SIZE] = (uint8_t) ptr[i];
+    }
+    g_tx_head += count;
+
+    tx_kick();
+
+    return count;
+}
+
+/* Starts a DMA transfer of the next contiguous run of the ring, if none is in flight. Interrupts
+ * must be masked (or called from the TX complete interrupt). */
+static void tx_kick(void) {
+    if (g_tx_in_flight != 0 || g_tx_head == g_tx_tail) {
+        return;
+    }
+
+    uint32_t offset = g_tx_tail % UART_RETARGET_TX_SIZE;
+    uint32_t pending = g_tx_head - g_tx_tail;
+    uint32_t contiguous = UART_RETARGET_TX_SIZE - offset;
+    uint32_t count = (pending < contiguous) ? pending : contiguous;
+
+    if (HAL_UART_Transmit_DMA(g_uart, &g_tx_ring[offset], (uint16_t) count) == HAL_OK) {
+        g_tx_in_flight = count;
+        g_tx_stats.bytes_sent += count;
+    }
+}
+
+/* Whether the caller can wait for room in the TX ring. Interrupts can't, and neither can callers
+ * that have interrupts masked since the DMA would never finish. */
+static int tx_can_wait(uint32_t primask) {
+    return __get_IPSR() == 0 && primask == 0;
+}
+
+/* Override the weak symbols defined in syscalls.h */
+
+int _read(int file, char *ptr, int len) { // non-blocking
+    size_t read = rx_pop(ptr, (size_t) len);
+    if (read == 0) {
+        return -1; // nothing to read
+    }
+    return (int) read;
+}
+
+int _write(int file, char *ptr, int len) { // only copies into the TX ring
+    return (int) uart_retarget_write(ptr, (size_t) len);
 }
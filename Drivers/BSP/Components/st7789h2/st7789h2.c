@@ -67,7 +67,11 @@ ST7789H2_Drv_t   ST7789H2_Driver =
 static int32_t ST7789H2_ReadRegWrap(void *handle, uint16_t Reg, uint8_t *pData, uint32_t Length);
 static int32_t ST7789H2_WriteRegWrap(void *handle, uint16_t Reg, uint8_t *pData, uint32_t Length);
 static int32_t ST7789H2_SendDataWrap(void *handle, uint8_t *pData, uint32_t Length);
+static int32_t ST7789H2_FillRegWrap(void *handle, uint16_t Reg, uint16_t Value, uint32_t Length);
+static int32_t ST7789H2_FillWindow(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color);
 static void    ST7789H2_Delay(ST7789H2_Object_t *pObj, uint32_t Delay);
+static int32_t ST7789H2_WriteScrollArea(ST7789H2_Object_t *pObj, uint32_t Top, uint32_t Height);
+static int32_t ST7789H2_WriteScrollStart(ST7789H2_Object_t *pObj, uint32_t Start);
 /**
   * @}
   */
@@ -98,10 +102,12 @@ int32_t ST7789H2_RegisterBusIO(ST7789H2_Object_t *pObj, ST7789H2_IO_t *pIO)
     pObj->IO.ReadReg   = pIO->ReadReg;
     pObj->IO.SendData  = pIO->SendData;
     pObj->IO.GetTick   = pIO->GetTick;
+    pObj->IO.FillReg   = pIO->FillReg;
 
     pObj->Ctx.ReadReg   = ST7789H2_ReadRegWrap;
     pObj->Ctx.WriteReg  = ST7789H2_WriteRegWrap;
     pObj->Ctx.SendData  = ST7789H2_SendDataWrap;
+    pObj->Ctx.FillReg   = ST7789H2_FillRegWrap;
     pObj->Ctx.handle    = pObj;
 
     if (pObj->IO.Init != NULL)
@@ -344,13 +350,15 @@ int32_t ST7789H2_Init(ST7789H2_Object_t *pObj, uint32_t ColorCoding, uint32_t Or
     parameter[27] = 0x00;
     ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_NV_GAMMA_CTRL, parameter, 14);
 
-    /* Tearing Effect Line On: Option (00h:VSYNC Interface OFF, 01h:VSYNC Interface ON) */
-    parameter[0] = 0x01;
+    /* Tearing Effect Line On: Option (00h: V-blanking only, 01h: V and H-blanking) */
+    parameter[0] = 0x00;
     parameter[1] = 0x00;
     ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_TE_LINE_ON, parameter, 1);
 
     pObj->IsInitialized = 1U;
     pObj->Orientation   = Orientation;
+    pObj->ScrollYpos    = 0U;
+    pObj->ScrollHeight  = 0U;
   }
 
   if (ret != ST7789H2_OK)
@@ -535,6 +543,12 @@ int32_t ST7789H2_SetOrientation(ST7789H2_Object_t *pObj, uint32_t Orientation)
   parameter[1] = 0x00U;
   ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_MADCTL, parameter, 1);
 
+  /* A scroll area only makes sense in the orientation it was set for: back to no scrolling */
+  ret += ST7789H2_WriteScrollArea(pObj, 0U, 320U);
+  ret += ST7789H2_WriteScrollStart(pObj, 0U);
+  pObj->ScrollYpos   = 0U;
+  pObj->ScrollHeight = 0U;
+
   pObj->Orientation = Orientation;
 
   return ret;
@@ -625,6 +639,127 @@ int32_t ST7789H2_SetCursor(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos
   return ret;
 }
 
+/**
+  * @brief  Set the vertical scroll area.
+  * @note   Hardware scrolling moves along the panel's rows, so it is only available in the
+  *         portrait orientations. The area starts unscrolled; see SetScrollStart.
+  * @param  pObj Pointer to component object.
+  * @param  Ypos Y position of the area on LCD.
+  * @param  Height Height of the area.
+  * @retval Component status.
+  */
+int32_t ST7789H2_SetScrollArea(ST7789H2_Object_t *pObj, uint32_t Ypos, uint32_t Height)
+{
+  int32_t  ret = ST7789H2_OK;
+  uint32_t top;
+
+  if ((pObj->Orientation == ST7789H2_ORIENTATION_LANDSCAPE) ||
+      (pObj->Orientation == ST7789H2_ORIENTATION_LANDSCAPE_ROT180) ||
+      (Height == 0U) || ((Ypos + Height) > 240U))
+  {
+    return ST7789H2_ERROR;
+  }
+
+  pObj->ScrollYpos   = Ypos;
+  pObj->ScrollHeight = Height;
+
+  /* See SetScrollStart for the rot180 mirroring */
+  top = (pObj->Orientation == ST7789H2_ORIENTATION_PORTRAIT_ROT180) ? (240U - Ypos - Height) : Ypos;
+  ret += ST7789H2_WriteScrollArea(pObj, top, Height);
+  ret += ST7789H2_SetScrollStart(pObj, 0U);
+
+  if (ret != ST7789H2_OK)
+  {
+    ret = ST7789H2_ERROR;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Scroll the vertical scroll area.
+  * @note   The area row written at Ypos + Line is shown at the top of the area, the rows
+  *         above it wrap around to the bottom.
+  * @param  pObj Pointer to component object.
+  * @param  Line Scroll position, from 0 to the area height - 1.
+  * @retval Component status.
+  */
+int32_t ST7789H2_SetScrollStart(ST7789H2_Object_t *pObj, uint32_t Line)
+{
+  int32_t  ret;
+  uint32_t top;
+  uint32_t height = pObj->ScrollHeight;
+
+  if ((height == 0U) || (Line >= height))
+  {
+    return ST7789H2_ERROR;
+  }
+
+  /* Frame memory row r is always refreshed to panel line r. In portrait, screen rows are memory
+     rows. In portrait rot180 (MY = 1, 0x50 row offset) screen row y is memory row 239 - y, so
+     the area is mirrored and scrolls the other way. */
+  if (pObj->Orientation == ST7789H2_ORIENTATION_PORTRAIT_ROT180)
+  {
+    top = 240U - pObj->ScrollYpos - height;
+    ret = ST7789H2_WriteScrollStart(pObj, top + ((height - Line) % height));
+  }
+  else
+  {
+    top = pObj->ScrollYpos;
+    ret = ST7789H2_WriteScrollStart(pObj, top + Line);
+  }
+
+  if (ret != ST7789H2_OK)
+  {
+    ret = ST7789H2_ERROR;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Set the tearing effect output.
+  * @note   In ST7789H2_TE_VBLANK mode the TE line goes high once per refresh, when the panel
+  *         has finished scanning the frame memory; its rising edge marks the start of a frame.
+  * @param  pObj Pointer to component object.
+  * @param  Mode ST7789H2_TE_OFF, ST7789H2_TE_VBLANK or ST7789H2_TE_VHBLANK.
+  * @retval Component status.
+  */
+int32_t ST7789H2_SetTearingEffect(ST7789H2_Object_t *pObj, uint32_t Mode)
+{
+  int32_t ret;
+  uint8_t parameter[2];
+
+  parameter[1] = 0x00U;
+
+  if (Mode == ST7789H2_TE_OFF)
+  {
+    parameter[0] = ST7789H2_TE_LINE_OFF;
+    ret = st7789h2_send_data(&pObj->Ctx, parameter, 1);
+  }
+  else if (Mode == ST7789H2_TE_VBLANK)
+  {
+    parameter[0] = 0x00U; /* TEM = 0 */
+    ret = st7789h2_write_reg(&pObj->Ctx, ST7789H2_TE_LINE_ON, parameter, 1);
+  }
+  else if (Mode == ST7789H2_TE_VHBLANK)
+  {
+    parameter[0] = 0x01U; /* TEM = 1 */
+    ret = st7789h2_write_reg(&pObj->Ctx, ST7789H2_TE_LINE_ON, parameter, 1);
+  }
+  else
+  {
+    ret = ST7789H2_ERROR;
+  }
+
+  if (ret != ST7789H2_OK)
+  {
+    ret = ST7789H2_ERROR;
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Display a bitmap picture.
   * @param  pObj Pointer to component object.
@@ -794,41 +929,52 @@ int32_t ST7789H2_DrawBitmap(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypo
 }
 
 /**
-  * @brief  Fill rectangle with RGB buffer.
+  * @brief  Set the GRAM window written by the next WRITE_RAM.
+  * @note   Pixels written to GRAM fill the window row by row, so a rectangle can be sent as one
+  *         stream after a single CASET/RASET pair. SetCursor resets the window to the full panel.
   * @param  pObj Pointer to component object.
   * @param  Xpos X position on LCD.
   * @param  Ypos Y position on LCD.
-  * @param  pData Pointer on RGB pixels buffer.
-  * @param  Width Width of the rectangle.
-  * @param  Height Height of the rectangle.
+  * @param  Width Width of the window.
+  * @param  Height Height of the window.
   * @retval Component status.
   */
-int32_t ST7789H2_FillRGBRect(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height)
+int32_t ST7789H2_SetDisplayWindow(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height)
 {
   int32_t  ret = ST7789H2_OK;
-  uint8_t  buffer[480];
-  uint8_t *rect; 
-  uint32_t i, j;
+  uint8_t  parameter[8];
+  uint32_t Xstart, Xstop;
+  uint32_t Ystart, Ystop;
 
-  rect = pData;
-  
-  for(i = 0; i < Height; i++)
-  {
-    /* Set Cursor */
-    ret += ST7789H2_SetCursor(pObj, Xpos, Ypos + i);
+  /* Apply the same GRAM offsets as SetCursor */
+  Xstart = (pObj->Orientation == ST7789H2_ORIENTATION_LANDSCAPE) ? (Xpos + 0x50U) : Xpos;
+  Ystart = (pObj->Orientation == ST7789H2_ORIENTATION_PORTRAIT_ROT180) ? (Ypos + 0x50U) : Ypos;
+  Xstop  = Xstart + Width - 1U;
+  Ystop  = Ystart + Height - 1U;
 
-    /* Sent a complete line */
-    for(j = 0; j < Width; j++)
-    {
-      buffer[2U*j]      = *rect;
-      rect++;
-      buffer[(2U*j)+1U] = *rect;
-      rect++;
-    }
-    ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_WRITE_RAM, buffer, Width);
-  }
+  /* CASET: Column Address Set */
+  parameter[0] = (uint8_t)(Xstart >> 8);  /* XS[15:8] */
+  parameter[1] = 0x00;
+  parameter[2] = (uint8_t) Xstart;        /* XS[7:0] */
+  parameter[3] = 0x00;
+  parameter[4] = (uint8_t)(Xstop >> 8);   /* XE[15:8] */
+  parameter[5] = 0x00;
+  parameter[6] = (uint8_t) Xstop;         /* XE[7:0] */
+  parameter[7] = 0x00;
+  ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_CASET, parameter, 4);
 
-  if(ret != ST7789H2_OK)
+  /* RASET: Row Address Set */
+  parameter[0] = (uint8_t)(Ystart >> 8);  /* YS[15:8] */
+  parameter[1] = 0x00;
+  parameter[2] = (uint8_t) Ystart;        /* YS[7:0] */
+  parameter[3] = 0x00;
+  parameter[4] = (uint8_t)(Ystop >> 8);   /* YE[15:8] */
+  parameter[5] = 0x00;
+  parameter[6] = (uint8_t) Ystop;         /* YE[7:0] */
+  parameter[7] = 0x00;
+  ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_RASET, parameter, 4);
+
+  if (ret != ST7789H2_OK)
   {
     ret = ST7789H2_ERROR;
   }
@@ -837,40 +983,39 @@ int32_t ST7789H2_FillRGBRect(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Yp
 }
 
 /**
-  * @brief  Display a horizontal line.
+  * @brief  Fill rectangle with RGB buffer.
+  * @note   The window is set once and every pixel is streamed straight from pData in a single
+  *         GRAM write, so a full screen blit is one transaction.
   * @param  pObj Pointer to component object.
   * @param  Xpos X position on LCD.
   * @param  Ypos Y position on LCD.
-  * @param  Length Length of the line.
-  * @param  Color  Color of the line.
+  * @param  pData Pointer on RGB pixels buffer.
+  * @param  Width Width of the rectangle.
+  * @param  Height Height of the rectangle.
   * @retval Component status.
   */
-int32_t ST7789H2_DrawHLine(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
+int32_t ST7789H2_FillRGBRect(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height)
 {
   int32_t  ret = ST7789H2_OK;
-  uint8_t  parameter[2];
-  uint32_t i;
-
-  /* Set Cursor */
-  ret += ST7789H2_SetCursor(pObj, Xpos, Ypos);
+  uint32_t last;
 
-  /* Sent a complete line */
-  parameter[0] = (uint8_t)(Color & 0xFFU);
-  parameter[1] = (uint8_t)((Color >> 8) & 0xFFU);
-  ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_WRITE_RAM, parameter, 1);
-  for (i = 1; i < Length; i++)
+  if ((Width == 0U) || (Height == 0U))
   {
-    ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_WRITE_RAM_CONTINUE, parameter, 1);
+    return ret;
   }
 
-  /* Workaround for last pixel */
-  if ((Xpos + Length) == 240U)
+  /* Set GRAM window and write all pixels in one go */
+  ret += ST7789H2_SetDisplayWindow(pObj, Xpos, Ypos, Width, Height);
+  ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_WRITE_RAM, pData, Width * Height);
+
+  /* Workaround for last pixel, as in DrawHLine. Rows before it wrap inside the window. */
+  if ((Xpos + Width) == 240U)
   {
-    /* Write last pixel */
-    ret += ST7789H2_SetCursor(pObj, (Xpos + Length - 1U), Ypos);
-    ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_WRITE_RAM, parameter, 1);
+    last = 2U * ((Width * Height) - 1U);
+    ret += ST7789H2_SetCursor(pObj, (Xpos + Width - 1U), (Ypos + Height - 1U));
+    ret += st7789h2_write_reg(&pObj->Ctx, ST7789H2_WRITE_RAM, &pData[last], 1);
   }
-  
+
   if (ret != ST7789H2_OK)
   {
     ret = ST7789H2_ERROR;
@@ -879,6 +1024,20 @@ int32_t ST7789H2_DrawHLine(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos
   return ret;
 }
 
+/**
+  * @brief  Display a horizontal line.
+  * @param  pObj Pointer to component object.
+  * @param  Xpos X position on LCD.
+  * @param  Ypos Y position on LCD.
+  * @param  Length Length of the line.
+  * @param  Color  Color of the line.
+  * @retval Component status.
+  */
+int32_t ST7789H2_DrawHLine(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
+{
+  return ST7789H2_FillWindow(pObj, Xpos, Ypos, Length, 1U, Color);
+}
+
 /**
   * @brief  Display a vertical line.
   * @param  pObj Pointer to component object.
@@ -890,21 +1049,7 @@ int32_t ST7789H2_DrawHLine(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos
   */
 int32_t ST7789H2_DrawVLine(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
 {
-  int32_t  ret = ST7789H2_OK;
-  uint32_t i;
-
-  /* Sent a complete line */
-  for (i = 0; i < Length; i++)
-  {
-    ret += ST7789H2_SetPixel(pObj, Xpos, (Ypos + i), Color);
-  }
-
-  if (ret != ST7789H2_OK)
-  {
-    ret = ST7789H2_ERROR;
-  }
-
-  return ret;
+  return ST7789H2_FillWindow(pObj, Xpos, Ypos, 1U, Length, Color);
 }
 
 /**
@@ -919,19 +1064,7 @@ int32_t ST7789H2_DrawVLine(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos
   */
 int32_t ST7789H2_FillRect(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color)
 {
-  int32_t  ret = ST7789H2_OK;
-  uint32_t i;
-
-  for (i = 0U; i < Height; i++)
-  {
-    if (ST7789H2_DrawHLine(pObj, Xpos, (i + Ypos), Width, Color) != ST7789H2_OK)
-    {
-      ret = ST7789H2_ERROR;
-      break;
-    }
-  }
-
-  return ret;
+  return ST7789H2_FillWindow(pObj, Xpos, Ypos, Width, Height, Color);
 }
 
 /**
@@ -1072,6 +1205,130 @@ static int32_t ST7789H2_SendDataWrap(void *handle, uint8_t *pData, uint32_t Leng
   return pObj->IO.SendData(pData, Length);
 }
 
+/**
+  * @brief  Fill register wrapped function.
+  * @note   Without a FillReg bus function, the value is sent from a small buffer; the chunks
+  *         after the first are written to WRITE_RAM_CONTINUE, so Reg must be a GRAM write.
+  * @param  handle Component object handle.
+  * @param  Reg    The target register address to write.
+  * @param  Value  The value to be written.
+  * @param  Length Number of times to write it.
+  * @retval error status.
+  */
+static int32_t ST7789H2_FillRegWrap(void *handle, uint16_t Reg, uint16_t Value, uint32_t Length)
+{
+  ST7789H2_Object_t *pObj = (ST7789H2_Object_t *)handle;
+  int32_t  ret = ST7789H2_OK;
+  uint8_t  buffer[64];
+  uint32_t i, count;
+
+  if (pObj->IO.FillReg != NULL)
+  {
+    return pObj->IO.FillReg(pObj->IO.Address, Reg, Value, Length);
+  }
+
+  for (i = 0U; i < (sizeof(buffer) / 2U); i++)
+  {
+    buffer[2U*i]        = (uint8_t)(Value & 0xFFU);
+    buffer[(2U*i) + 1U] = (uint8_t)(Value >> 8);
+  }
+
+  while (Length > 0U)
+  {
+    count = (Length < (sizeof(buffer) / 2U)) ? Length : (sizeof(buffer) / 2U);
+    ret += pObj->IO.WriteReg(pObj->IO.Address, Reg, buffer, count);
+    Reg = ST7789H2_WRITE_RAM_CONTINUE;
+    Length -= count;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Fill a window with one color.
+  * @note   The window is set once and the color repeated into GRAM in a single write.
+  * @param  pObj Pointer to component object.
+  * @param  Xpos X position on LCD.
+  * @param  Ypos Y position on LCD.
+  * @param  Width Width of the window.
+  * @param  Height Height of the window.
+  * @param  Color Color of the window.
+  * @retval Component status.
+  */
+static int32_t ST7789H2_FillWindow(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color)
+{
+  int32_t ret = ST7789H2_OK;
+
+  if ((Width == 0U) || (Height == 0U))
+  {
+    return ret;
+  }
+
+  ret += ST7789H2_SetDisplayWindow(pObj, Xpos, Ypos, Width, Height);
+  ret += st7789h2_fill_reg(&pObj->Ctx, ST7789H2_WRITE_RAM, (uint16_t)Color, Width * Height);
+
+  /* Workaround for last pixel */
+  if ((Xpos + Width) == 240U)
+  {
+    ret += ST7789H2_SetPixel(pObj, (Xpos + Width - 1U), (Ypos + Height - 1U), Color);
+  }
+
+  if (ret != ST7789H2_OK)
+  {
+    ret = ST7789H2_ERROR;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Write the vertical scroll definition.
+  * @param  pObj Pointer to component object.
+  * @param  Top First frame memory row of the scroll area.
+  * @param  Height Number of rows in the scroll area.
+  * @retval Component status.
+  */
+static int32_t ST7789H2_WriteScrollArea(ST7789H2_Object_t *pObj, uint32_t Top, uint32_t Height)
+{
+  uint8_t  parameter[12];
+  uint32_t bottom = 320U - Top - Height;
+
+  /* VSCRDEF: Vertical Scroll Definition */
+  parameter[0]  = (uint8_t)(Top >> 8);       /* TFA[15:8] */
+  parameter[1]  = 0x00;
+  parameter[2]  = (uint8_t) Top;             /* TFA[7:0] */
+  parameter[3]  = 0x00;
+  parameter[4]  = (uint8_t)(Height >> 8);    /* VSA[15:8] */
+  parameter[5]  = 0x00;
+  parameter[6]  = (uint8_t) Height;          /* VSA[7:0] */
+  parameter[7]  = 0x00;
+  parameter[8]  = (uint8_t)(bottom >> 8);    /* BFA[15:8] */
+  parameter[9]  = 0x00;
+  parameter[10] = (uint8_t) bottom;          /* BFA[7:0] */
+  parameter[11] = 0x00;
+
+  return st7789h2_write_reg(&pObj->Ctx, ST7789H2_VSCRDEF, parameter, 6);
+}
+
+/**
+  * @brief  Write the vertical scroll start address.
+  * @param  pObj Pointer to component object.
+  * @param  Start Frame memory row shown at the top of the scroll area.
+  * @retval Component status.
+  */
+static int32_t ST7789H2_WriteScrollStart(ST7789H2_Object_t *pObj, uint32_t Start)
+{
+  uint8_t parameter[4];
+
+  /* VSCSAD: Vertical Scroll Start Address of RAM */
+  parameter[0] = (uint8_t)(Start >> 8);      /* VSP[15:8] */
+  parameter[1] = 0x00;
+  parameter[2] = (uint8_t) Start;            /* VSP[7:0] */
+  parameter[3] = 0x00;
+
+  return st7789h2_write_reg(&pObj->Ctx, ST7789H2_VSCSAD, parameter, 2);
+}
+
 /**
   * @brief  ST7789H2 delay
   * @param  Delay Delay in ms
@@ -52,6 +52,7 @@ typedef int32_t (*ST7789H2_Delay_Func)(uint32_t);
 typedef int32_t (*ST7789H2_WriteReg_Func)(uint16_t, uint16_t, uint8_t *, uint32_t);
 typedef int32_t (*ST7789H2_ReadReg_Func)(uint16_t, uint16_t, uint8_t *, uint32_t);
 typedef int32_t (*ST7789H2_SendData_Func)(uint8_t *, uint32_t);
+typedef int32_t (*ST7789H2_FillReg_Func)(uint16_t, uint16_t, uint16_t, uint32_t);
 
 typedef struct
 {
@@ -62,6 +63,7 @@ typedef struct
   ST7789H2_ReadReg_Func       ReadReg;
   ST7789H2_SendData_Func      SendData;
   ST7789H2_GetTick_Func       GetTick;
+  ST7789H2_FillReg_Func       FillReg;   /* Optional, NULL to fill from a line buffer */
 } ST7789H2_IO_t;
 
 typedef struct
@@ -70,6 +72,8 @@ typedef struct
   ST7789H2_ctx_t        Ctx;
   uint8_t               IsInitialized;
   uint32_t              Orientation;
+  uint32_t              ScrollYpos;    /* Vertical scroll area, on screen */
+  uint32_t              ScrollHeight;  /* 0 when no scroll area is set */
 } ST7789H2_Object_t;
 
 typedef struct
@@ -118,6 +122,10 @@ typedef struct
 #define ST7789H2_FORMAT_RBG444                0x03U /* Pixel format chosen is RGB444 : 12 bpp (currently not supported)  */
 #define ST7789H2_FORMAT_RBG565                0x05U /* Pixel format chosen is RGB565 : 16 bpp */
 #define ST7789H2_FORMAT_RBG666                0x06U /* Pixel format chosen is RGB666 : 18 bpp (currently not supported)  */
+
+#define ST7789H2_TE_OFF                       0x00U /* No tearing effect output */
+#define ST7789H2_TE_VBLANK                    0x01U /* Tearing effect output during V-blanking only */
+#define ST7789H2_TE_VHBLANK                   0x02U /* Tearing effect output during V-blanking and H-blanking */
 /**
   * @}
   */
@@ -144,6 +152,10 @@ int32_t ST7789H2_GetBrightness(ST7789H2_Object_t *pObj, uint32_t *Brightness);
 int32_t ST7789H2_SetOrientation(ST7789H2_Object_t *pObj, uint32_t Orientation);
 int32_t ST7789H2_GetOrientation(ST7789H2_Object_t *pObj, uint32_t *Orientation);
 int32_t ST7789H2_SetCursor(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos);
+int32_t ST7789H2_SetDisplayWindow(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height);
+int32_t ST7789H2_SetScrollArea(ST7789H2_Object_t *pObj, uint32_t Ypos, uint32_t Height);
+int32_t ST7789H2_SetScrollStart(ST7789H2_Object_t *pObj, uint32_t Line);
+int32_t ST7789H2_SetTearingEffect(ST7789H2_Object_t *pObj, uint32_t Mode);
 int32_t ST7789H2_DrawBitmap(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint8_t *pBmp);
 int32_t ST7789H2_FillRGBRect(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height);
 int32_t ST7789H2_DrawHLine(ST7789H2_Object_t *pObj, uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color);
@@ -69,6 +69,18 @@ int32_t st7789h2_send_data(ST7789H2_ctx_t *ctx, uint8_t *pdata, uint32_t length)
 {
   return ctx->SendData(ctx->handle, pdata, length);
 }
+
+/*******************************************************************************
+* Function Name : st7789h2_fill_reg
+* Description   : Generic Filling function, writes the same value length times.
+* Input         : Driver context, Register Address, value to be written,
+*                 number of times to write it.
+* Output        : Status.
+*******************************************************************************/
+int32_t st7789h2_fill_reg(ST7789H2_ctx_t *ctx, uint16_t reg, uint16_t value, uint32_t length)
+{
+  return ctx->FillReg(ctx->handle, reg, value, length);
+}
 /**
   * @}
   */
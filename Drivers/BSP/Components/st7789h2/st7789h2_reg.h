@@ -141,12 +141,14 @@ extern "C" {
 typedef int32_t (*ST7789H2_Write_Func)(void *, uint16_t, uint8_t *, uint32_t);
 typedef int32_t (*ST7789H2_Read_Func)(void *, uint16_t, uint8_t *, uint32_t);
 typedef int32_t (*ST7789H2_Send_Func)(void *, uint8_t *, uint32_t);
+typedef int32_t (*ST7789H2_Fill_Func)(void *, uint16_t, uint16_t, uint32_t);
 
 typedef struct
 {
   ST7789H2_Write_Func   WriteReg;
   ST7789H2_Read_Func    ReadReg;
   ST7789H2_Send_Func    SendData;
+  ST7789H2_Fill_Func    FillReg;
   void                  *handle;
 } ST7789H2_ctx_t;
 /**
@@ -159,6 +161,7 @@ typedef struct
 int32_t st7789h2_write_reg(ST7789H2_ctx_t *ctx, uint16_t reg, uint8_t *pdata, uint32_t length);
 int32_t st7789h2_read_reg(ST7789H2_ctx_t *ctx, uint16_t reg, uint8_t *pdata, uint32_t length);
 int32_t st7789h2_send_data(ST7789H2_ctx_t *ctx, uint8_t *pdata, uint32_t length);
+int32_t st7789h2_fill_reg(ST7789H2_ctx_t *ctx, uint16_t reg, uint16_t value, uint32_t length);
 /**
   * @}
   */
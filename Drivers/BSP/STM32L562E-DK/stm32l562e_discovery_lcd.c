@@ -35,6 +35,15 @@
        o Call BSP_LCD_DrawBitmap() to draw a bitmap.
        o Call BSP_LCD_FillRect() to draw a rectangle.
        o Call BSP_LCD_FillRGBRect() to draw a rectangle with RGB buffer.
+       o Call BSP_LCD_SetScrollArea() to define a band of the screen for hardware
+         vertical scrolling, then BSP_LCD_SetScrollStart() to scroll it. Only
+         available in the portrait orientations.
+       o Call BSP_LCD_FillRGBRect_DMA() to queue a rectangle with RGB buffer
+         for DMA transfer. BSP_LCD_TransferComplete_CallBack() is called from
+         the DMA interrupt when its buffer may be reused, and the next queued
+         rectangle is started. BSP_LCD_GetTransferStatus() reports how many
+         rectangles are still queued. Other drawing functions wait for the
+         queue to drain before using the bus.
 
     + De-initialization steps:
        o De-initialize the LCD using the BSP_LCD_DeInit() function.
@@ -86,6 +95,17 @@
 #define LCD_DATA_ADDR     (FMC_BANK1_1 | 0x00000002UL)
 
 #define LCD_FMC_ADDRESS   1U
+
+#define LCD_DMA_INSTANCE       DMA1_Channel3
+#define LCD_DMA_IRQn           DMA1_Channel3_IRQn
+#define LCD_DMA_QUEUE_SIZE     4U      /* Rectangles queued, including the one in transfer */
+#define LCD_DMA_MAX_TRANSFER   65535U  /* Pixels per DMA transfer (CNDTR is 16 bits) */
+
+#define LCD_TE_GPIO_PORT                  GPIOA
+#define LCD_TE_GPIO_PIN                   GPIO_PIN_8
+#define LCD_TE_GPIO_CLOCK_ENABLE()        __HAL_RCC_GPIOA_CLK_ENABLE()
+#define LCD_TE_EXTI_LINE                  EXTI_LINE_8
+#define LCD_TE_EXTI_IRQn                  EXTI8_IRQn
 /**
   * @}
   */
@@ -96,6 +116,27 @@
 #if (USE_HAL_SRAM_REGISTER_CALLBACKS == 1)
 static uint32_t Lcd_IsSramMspCbValid[LCD_INSTANCES_NBR] = {0};
 #endif
+
+typedef struct
+{
+  uint32_t Xpos;
+  uint32_t Ypos;
+  uint32_t Width;
+  uint32_t Height;
+  uint8_t *pData;
+} LCD_DMA_Rect_t;
+
+static DMA_HandleTypeDef hlcd_dma;
+
+/* Queue of rectangles to transfer. Head and tail are free running; the rectangle at the tail is
+   the one on the bus, along with how much of it is still to be sent. */
+static LCD_DMA_Rect_t    Lcd_DmaQueue[LCD_DMA_QUEUE_SIZE];
+static volatile uint32_t Lcd_DmaHead = 0;
+static volatile uint32_t Lcd_DmaTail = 0;
+static uint8_t          *Lcd_DmaNext = NULL;
+static uint32_t          Lcd_DmaRemaining = 0;
+
+static EXTI_HandleTypeDef hlcd_te_exti;
 /**
   * @}
   */
@@ -123,7 +164,16 @@ static int32_t LCD_FMC_DeInit(void);
 static int32_t LCD_FMC_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint32_t Length);
 static int32_t LCD_FMC_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint32_t Length);
 static int32_t LCD_FMC_Send(uint8_t *pData, uint32_t Length);
+static int32_t LCD_FMC_FillReg16(uint16_t DevAddr, uint16_t Reg, uint16_t Value, uint32_t Length);
 static int32_t LCD_FMC_GetTick(void);
+static int32_t LCD_DMA_Init(void);
+static void    LCD_DMA_DeInit(void);
+static void    LCD_DMA_WaitIdle(void);
+static void    LCD_DMA_StartRect(void);
+static void    LCD_DMA_StartChunk(void);
+static void    LCD_DMA_XferCplt(DMA_HandleTypeDef *hdma);
+static void    LCD_DMA_XferError(DMA_HandleTypeDef *hdma);
+static void    LCD_TE_EXTI_Callback(void);
 static void    FMC_MspInit(SRAM_HandleTypeDef *hSram);
 static void    FMC_MspDeInit(SRAM_HandleTypeDef *hSram);
 /**
@@ -158,6 +208,11 @@ int32_t BSP_LCD_Init(uint32_t Instance, uint32_t Orientation)
     {
       status = BSP_ERROR_COMPONENT_FAILURE;
     }
+    /* Configure the DMA used for asynchronous GRAM writes */
+    else if (LCD_DMA_Init() != BSP_ERROR_NONE)
+    {
+      status = BSP_ERROR_PERIPH_FAILURE;
+    }
   }
 
   return status;
@@ -178,6 +233,10 @@ int32_t BSP_LCD_DeInit(uint32_t Instance)
   }
   else
   {
+    LCD_DMA_WaitIdle();
+    LCD_DMA_DeInit();
+    HAL_NVIC_DisableIRQ(LCD_TE_EXTI_IRQn);
+
     /* De-Init the LCD driver */
     if (Lcd_Drv[Instance]->DeInit(Lcd_CompObj[Instance]) < 0)
     {
@@ -205,6 +264,8 @@ int32_t BSP_LCD_DisplayOn(uint32_t Instance)
   }
   else
   {
+    LCD_DMA_WaitIdle();
+
     /* Set the display on */
     if (Lcd_Drv[Instance]->DisplayOn(Lcd_CompObj[Instance]) < 0)
     {
@@ -230,6 +291,8 @@ int32_t BSP_LCD_DisplayOff(uint32_t Instance)
   }
   else
   {
+    LCD_DMA_WaitIdle();
+
     /* Set the display off */
     if (Lcd_Drv[Instance]->DisplayOff(Lcd_CompObj[Instance]) < 0)
     {
@@ -385,6 +448,8 @@ int32_t BSP_LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
   }
   else
   {
+    LCD_DMA_WaitIdle();
+
     /* Draw the bitmap on LCD */
     if (Lcd_Drv[Instance]->DrawBitmap(Lcd_CompObj[Instance], Xpos, Ypos, pBmp) < 0)
     {
@@ -415,6 +480,8 @@ int32_t BSP_LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uin
   }
   else
   {
+    LCD_DMA_WaitIdle();
+
     /* Fill rectangle on LCD */
     if (Lcd_Drv[Instance]->FillRGBRect(Lcd_CompObj[Instance], Xpos, Ypos, pData, Width, Height) < 0)
     {
@@ -444,6 +511,8 @@ int32_t BSP_LCD_DrawHLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint3
   }
   else
   {
+    LCD_DMA_WaitIdle();
+
     /* Draw the horizontal line on LCD */
     if (Lcd_Drv[Instance]->DrawHLine(Lcd_CompObj[Instance], Xpos, Ypos, Length, Color) < 0)
     {
@@ -473,6 +542,8 @@ int32_t BSP_LCD_DrawVLine(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint3
   }
   else
   {
+    LCD_DMA_WaitIdle();
+
     /* Draw the vertical line on LCD */
     if (Lcd_Drv[Instance]->DrawVLine(Lcd_CompObj[Instance], Xpos, Ypos, Length, Color) < 0)
     {
@@ -503,6 +574,8 @@ int32_t BSP_LCD_FillRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32
   }
   else
   {
+    LCD_DMA_WaitIdle();
+
     /* Draw an fill rectangle on LCD */
     if (Lcd_Drv[Instance]->FillRect(Lcd_CompObj[Instance], Xpos, Ypos, Width, Height, Color) < 0)
     {
@@ -531,6 +604,8 @@ int32_t BSP_LCD_ReadPixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint3
   }
   else
   {
+    LCD_DMA_WaitIdle();
+
     /* Read pixel on LCD */
     if (Lcd_Drv[Instance]->GetPixel(Lcd_CompObj[Instance], Xpos, Ypos, Color) < 0)
     {
@@ -559,6 +634,8 @@ int32_t BSP_LCD_WritePixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
   }
   else
   {
+    LCD_DMA_WaitIdle();
+
     /* Write pixel on LCD */
     if (Lcd_Drv[Instance]->SetPixel(Lcd_CompObj[Instance], Xpos, Ypos, Color) < 0)
     {
@@ -569,6 +646,304 @@ int32_t BSP_LCD_WritePixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
   return status;
 }
 
+/**
+  * @brief  Set the hardware vertical scroll area.
+  * @param  Instance LCD Instance.
+  * @param  Ypos Y position of the area.
+  * @param  Height Height of the area.
+  * @retval BSP status.
+  */
+int32_t BSP_LCD_SetScrollArea(uint32_t Instance, uint32_t Ypos, uint32_t Height)
+{
+  int32_t  status = BSP_ERROR_NONE;
+  uint32_t orientation;
+
+  if (Instance >= LCD_INSTANCES_NBR)
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Lcd_Drv[Instance]->GetOrientation(Lcd_CompObj[Instance], &orientation) < 0)
+  {
+    status = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if ((orientation == LCD_ORIENTATION_LANDSCAPE) || (orientation == LCD_ORIENTATION_LANDSCAPE_ROT180))
+  {
+    status = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else
+  {
+    LCD_DMA_WaitIdle();
+
+    /* Set scroll area on LCD */
+    if (ST7789H2_SetScrollArea((ST7789H2_Object_t *)Lcd_CompObj[Instance], Ypos, Height) < 0)
+    {
+      status = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Scroll the hardware vertical scroll area.
+  * @param  Instance LCD Instance.
+  * @param  Line Row of the area, relative to its top, to show at the top of the area.
+  * @retval BSP status.
+  */
+int32_t BSP_LCD_SetScrollStart(uint32_t Instance, uint32_t Line)
+{
+  int32_t status = BSP_ERROR_NONE;
+
+  if (Instance >= LCD_INSTANCES_NBR)
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    LCD_DMA_WaitIdle();
+
+    /* Scroll LCD */
+    if (ST7789H2_SetScrollStart((ST7789H2_Object_t *)Lcd_CompObj[Instance], Line) < 0)
+    {
+      status = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Queue a rectangle with RGB buffer for DMA transfer.
+  * @note   The buffer must stay valid and unchanged until BSP_LCD_TransferComplete_CallBack()
+  *         is called for it. Rectangles are drawn in the order they are queued.
+  * @param  Instance LCD Instance.
+  * @param  Xpos X position on LCD.
+  * @param  Ypos Y position on LCD.
+  * @param  pData Pointer on RGB pixels buffer, 16-bit aligned.
+  * @param  Width Width of the rectangle.
+  * @param  Height Height of the rectangle.
+  * @retval BSP status, BSP_ERROR_BUSY if the queue is full.
+  */
+int32_t BSP_LCD_FillRGBRect_DMA(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height)
+{
+  int32_t  status = BSP_ERROR_NONE;
+  uint32_t primask;
+  LCD_DMA_Rect_t *rect;
+
+  if ((Instance >= LCD_INSTANCES_NBR) || (pData == NULL) || (((uint32_t)pData & 1U) != 0U) ||
+      (Width == 0U) || (Height == 0U))
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    if ((Lcd_DmaHead - Lcd_DmaTail) == LCD_DMA_QUEUE_SIZE)
+    {
+      status = BSP_ERROR_BUSY;
+    }
+    else
+    {
+      rect = &Lcd_DmaQueue[Lcd_DmaHead % LCD_DMA_QUEUE_SIZE];
+      rect->Xpos   = Xpos;
+      rect->Ypos   = Ypos;
+      rect->Width  = Width;
+      rect->Height = Height;
+      rect->pData  = pData;
+      Lcd_DmaHead++;
+
+      /* Nothing on the bus, start it now; otherwise the DMA interrupt will */
+      if ((Lcd_DmaHead - Lcd_DmaTail) == 1U)
+      {
+        LCD_DMA_StartRect();
+      }
+    }
+
+    __set_PRIMASK(primask);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Get the state of the DMA transfers.
+  * @param  Instance LCD Instance.
+  * @param  Pending Number of rectangles queued, including the one in transfer. May be NULL.
+  * @retval BSP status, BSP_ERROR_BUSY while any rectangle is queued or in transfer.
+  */
+int32_t BSP_LCD_GetTransferStatus(uint32_t Instance, uint32_t *Pending)
+{
+  int32_t  status = BSP_ERROR_NONE;
+  uint32_t count;
+
+  if (Instance >= LCD_INSTANCES_NBR)
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    count = Lcd_DmaHead - Lcd_DmaTail;
+    if (Pending != NULL)
+    {
+      *Pending = count;
+    }
+    if (count != 0U)
+    {
+      status = BSP_ERROR_BUSY;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Manage the end of a rectangle DMA transfer.
+  * @note   Called from the DMA interrupt.
+  * @param  Instance LCD Instance.
+  * @param  pData The buffer of the rectangle, which may now be reused.
+  * @retval None.
+  */
+__weak void BSP_LCD_TransferComplete_CallBack(uint32_t Instance, uint8_t *pData)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+  UNUSED(pData);
+}
+
+/**
+  * @brief  Manage a DMA transfer error. The failed rectangle is dropped.
+  * @note   Called from the DMA interrupt.
+  * @param  Instance LCD Instance.
+  * @retval None.
+  */
+__weak void BSP_LCD_Error_CallBack(uint32_t Instance)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+}
+
+/**
+  * @brief  BSP LCD DMA interrupt handler.
+  * @param  Instance LCD Instance.
+  * @retval None.
+  */
+void BSP_LCD_DMA_IRQHandler(uint32_t Instance)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+
+  HAL_DMA_IRQHandler(&hlcd_dma);
+}
+
+/**
+  * @brief  Enable the tearing effect interrupt.
+  * @note   The panel raises its TE line once per refresh, at the start of vertical blanking;
+  *         BSP_LCD_TearingEffect_Callback() is called on each rising edge.
+  * @param  Instance LCD Instance.
+  * @retval BSP status.
+  */
+int32_t BSP_LCD_EnableTearingEffect(uint32_t Instance)
+{
+  int32_t          status = BSP_ERROR_NONE;
+  GPIO_InitTypeDef gpio_init;
+
+  if (Instance >= LCD_INSTANCES_NBR)
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    LCD_DMA_WaitIdle();
+
+    /* TE output during V-blanking only, so there is one edge per frame */
+    if (ST7789H2_SetTearingEffect((ST7789H2_Object_t *)Lcd_CompObj[Instance], ST7789H2_TE_VBLANK) < 0)
+    {
+      status = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      /* Configure TE interrupt GPIO */
+      LCD_TE_GPIO_CLOCK_ENABLE();
+      gpio_init.Pin   = LCD_TE_GPIO_PIN;
+      gpio_init.Speed = GPIO_SPEED_FREQ_HIGH;
+      gpio_init.Mode  = GPIO_MODE_IT_RISING;
+      gpio_init.Pull  = GPIO_NOPULL;
+      HAL_GPIO_Init(LCD_TE_GPIO_PORT, &gpio_init);
+
+      if (HAL_EXTI_GetHandle(&hlcd_te_exti, LCD_TE_EXTI_LINE) != HAL_OK)
+      {
+        status = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else if (HAL_EXTI_RegisterCallback(&hlcd_te_exti, HAL_EXTI_RISING_CB_ID, LCD_TE_EXTI_Callback) != HAL_OK)
+      {
+        status = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else
+      {
+        HAL_NVIC_SetPriority(LCD_TE_EXTI_IRQn, BSP_LCD_TE_IT_PRIORITY, 0);
+        HAL_NVIC_EnableIRQ(LCD_TE_EXTI_IRQn);
+      }
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Disable the tearing effect interrupt.
+  * @param  Instance LCD Instance.
+  * @retval BSP status.
+  */
+int32_t BSP_LCD_DisableTearingEffect(uint32_t Instance)
+{
+  int32_t status = BSP_ERROR_NONE;
+
+  if (Instance >= LCD_INSTANCES_NBR)
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    HAL_NVIC_DisableIRQ(LCD_TE_EXTI_IRQn);
+
+    LCD_DMA_WaitIdle();
+
+    if (ST7789H2_SetTearingEffect((ST7789H2_Object_t *)Lcd_CompObj[Instance], ST7789H2_TE_OFF) < 0)
+    {
+      status = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Manage the start of a panel refresh.
+  * @note   Called from the TE EXTI interrupt.
+  * @param  Instance LCD Instance.
+  * @retval None.
+  */
+__weak void BSP_LCD_TearingEffect_Callback(uint32_t Instance)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+}
+
+/**
+  * @brief  BSP LCD TE interrupt handler.
+  * @param  Instance LCD Instance.
+  * @retval None.
+  */
+void BSP_LCD_TE_IRQHandler(uint32_t Instance)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+
+  HAL_EXTI_IRQHandler(&hlcd_te_exti);
+}
+
 /**
   * @brief  Get pixel format supported by LCD.
   * @param  Instance LCD Instance.
@@ -742,6 +1117,7 @@ static int32_t ST7789H2_Probe(uint32_t Orientation)
   IOCtx.WriteReg    = LCD_FMC_WriteReg16;
   IOCtx.SendData    = LCD_FMC_Send;
   IOCtx.GetTick     = LCD_FMC_GetTick;
+  IOCtx.FillReg     = LCD_FMC_FillReg16;
 
   if (ST7789H2_RegisterBusIO(&ST7789H2Obj, &IOCtx) != ST7789H2_OK)
   {
@@ -1011,6 +1387,52 @@ static int32_t LCD_FMC_Send(uint8_t *pData, uint32_t Length)
   return ret;
 }
 
+/**
+  * @brief  Write the same 16bit value many times in a register of the device through BUS.
+  * @param  DevAddr Device address on Bus.
+  * @param  Reg     The target register address to write.
+  * @param  Value   Value to write.
+  * @param  Length  Number of times to write it.
+  * @retval BSP status.
+  */
+static int32_t LCD_FMC_FillReg16(uint16_t DevAddr, uint16_t Reg, uint16_t Value, uint32_t Length)
+{
+  int32_t  ret = BSP_ERROR_NONE;
+  volatile uint16_t *data = (volatile uint16_t *)LCD_DATA_ADDR;
+
+  if ((DevAddr != LCD_FMC_ADDRESS) || (Length == 0U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* Write register address */
+    *(uint16_t *)LCD_REGISTER_ADDR = Reg;
+
+    /* Write register value, unrolled so the FMC write FIFO stays full */
+    while (Length >= 8U)
+    {
+      *data = Value;
+      *data = Value;
+      *data = Value;
+      *data = Value;
+      *data = Value;
+      *data = Value;
+      *data = Value;
+      *data = Value;
+      Length -= 8U;
+    }
+    while (Length > 0U)
+    {
+      *data = Value;
+      Length--;
+    }
+  }
+
+  /* BSP status */
+  return ret;
+}
+
 /**
   * @brief  Provide a tick value in millisecond.
   * @retval Tick value.
@@ -1110,6 +1532,172 @@ static void FMC_MspDeInit(SRAM_HandleTypeDef *hSram)
   /* Disable FMC clock */
   __HAL_RCC_FMC_CLK_DISABLE();
 }
+
+/**
+  * @brief  Configure the DMA used for asynchronous GRAM writes.
+  * @note   Memory to memory mode: the source buffer is the incremented "peripheral" side and
+  *         the FMC data address is the fixed "memory" side.
+  * @retval BSP status.
+  */
+static int32_t LCD_DMA_Init(void)
+{
+  int32_t status = BSP_ERROR_NONE;
+
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  __HAL_RCC_DMAMUX1_CLK_ENABLE();
+
+  hlcd_dma.Instance                 = LCD_DMA_INSTANCE;
+  hlcd_dma.Init.Request             = DMA_REQUEST_MEM2MEM;
+  hlcd_dma.Init.Direction           = DMA_MEMORY_TO_MEMORY;
+  hlcd_dma.Init.PeriphInc           = DMA_PINC_ENABLE;
+  hlcd_dma.Init.MemInc              = DMA_MINC_DISABLE;
+  hlcd_dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  hlcd_dma.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
+  hlcd_dma.Init.Mode                = DMA_NORMAL;
+  hlcd_dma.Init.Priority            = DMA_PRIORITY_LOW;
+
+  if (HAL_DMA_Init(&hlcd_dma) != HAL_OK)
+  {
+    status = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    hlcd_dma.XferCpltCallback  = LCD_DMA_XferCplt;
+    hlcd_dma.XferErrorCallback = LCD_DMA_XferError;
+
+    HAL_NVIC_SetPriority(LCD_DMA_IRQn, BSP_LCD_DMA_IT_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(LCD_DMA_IRQn);
+  }
+
+  Lcd_DmaHead = 0;
+  Lcd_DmaTail = 0;
+
+  return status;
+}
+
+/**
+  * @brief  De-initialize the DMA used for asynchronous GRAM writes.
+  * @retval None.
+  */
+static void LCD_DMA_DeInit(void)
+{
+  HAL_NVIC_DisableIRQ(LCD_DMA_IRQn);
+  (void)HAL_DMA_DeInit(&hlcd_dma);
+}
+
+/**
+  * @brief  Wait until every queued rectangle has been sent, so the bus is free.
+  * @retval None.
+  */
+static void LCD_DMA_WaitIdle(void)
+{
+  while (Lcd_DmaHead != Lcd_DmaTail)
+  {
+  }
+}
+
+/**
+  * @brief  Start sending the rectangle at the tail of the queue.
+  * @note   Called with the DMA interrupt masked, or from it.
+  * @retval None.
+  */
+static void LCD_DMA_StartRect(void)
+{
+  LCD_DMA_Rect_t *rect = &Lcd_DmaQueue[Lcd_DmaTail % LCD_DMA_QUEUE_SIZE];
+
+  (void)ST7789H2_SetDisplayWindow((ST7789H2_Object_t *)Lcd_CompObj[0], rect->Xpos, rect->Ypos, rect->Width, rect->Height);
+
+  /* Pixels follow the GRAM write command, the DMA sends them */
+  *(uint16_t *)LCD_REGISTER_ADDR = ST7789H2_WRITE_RAM;
+
+  Lcd_DmaNext      = rect->pData;
+  Lcd_DmaRemaining = rect->Width * rect->Height;
+  LCD_DMA_StartChunk();
+}
+
+/**
+  * @brief  Start the next DMA transfer of the rectangle in progress.
+  * @retval None.
+  */
+static void LCD_DMA_StartChunk(void)
+{
+  uint32_t count = (Lcd_DmaRemaining > LCD_DMA_MAX_TRANSFER) ? LCD_DMA_MAX_TRANSFER : Lcd_DmaRemaining;
+  uint8_t *src = Lcd_DmaNext;
+
+  Lcd_DmaNext      += 2U * count;
+  Lcd_DmaRemaining -= count;
+
+  if (HAL_DMA_Start_IT(&hlcd_dma, (uint32_t)src, LCD_DATA_ADDR, count) != HAL_OK)
+  {
+    LCD_DMA_XferError(&hlcd_dma);
+  }
+}
+
+/**
+  * @brief  DMA transfer complete callback. Finishes the rectangle and starts the next one.
+  * @param  hdma DMA handle.
+  * @retval None.
+  */
+static void LCD_DMA_XferCplt(DMA_HandleTypeDef *hdma)
+{
+  LCD_DMA_Rect_t *rect = &Lcd_DmaQueue[Lcd_DmaTail % LCD_DMA_QUEUE_SIZE];
+  uint8_t  *pData = rect->pData;
+  uint32_t last;
+
+  UNUSED(hdma);
+
+  /* A rectangle larger than one transfer continues in the same GRAM window */
+  if (Lcd_DmaRemaining != 0U)
+  {
+    LCD_DMA_StartChunk();
+    return;
+  }
+
+  /* Workaround for last pixel, as in the ST7789H2 driver */
+  if ((rect->Xpos + rect->Width) == 240U)
+  {
+    last = 2U * ((rect->Width * rect->Height) - 1U);
+    (void)Lcd_Drv[0]->SetPixel(Lcd_CompObj[0], (rect->Xpos + rect->Width - 1U), (rect->Ypos + rect->Height - 1U),
+                               ((uint32_t)pData[last + 1U] << 8) | (uint32_t)pData[last]);
+  }
+
+  /* The slot may be reused as soon as the tail moves on */
+  Lcd_DmaTail++;
+  BSP_LCD_TransferComplete_CallBack(0, pData);
+
+  if (Lcd_DmaHead != Lcd_DmaTail)
+  {
+    LCD_DMA_StartRect();
+  }
+}
+
+/**
+  * @brief  DMA transfer error callback. Drops the rectangle and carries on with the queue.
+  * @param  hdma DMA handle.
+  * @retval None.
+  */
+static void LCD_DMA_XferError(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+
+  Lcd_DmaRemaining = 0;
+  Lcd_DmaTail++;
+  BSP_LCD_Error_CallBack(0);
+
+  if (Lcd_DmaHead != Lcd_DmaTail)
+  {
+    LCD_DMA_StartRect();
+  }
+}
+
+/**
+  * @brief  TE EXTI callback.
+  * @retval None.
+  */
+static void LCD_TE_EXTI_Callback(void)
+{
+  BSP_LCD_TearingEffect_Callback(0);
+}
 /**
   * @}
   */
@@ -133,6 +133,18 @@ int32_t  BSP_LCD_ReadPixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
 int32_t  BSP_LCD_WritePixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint32_t Color);
 int32_t  BSP_LCD_GetFormat(uint32_t Instance, uint32_t *Format);
 
+int32_t  BSP_LCD_SetScrollArea(uint32_t Instance, uint32_t Ypos, uint32_t Height);
+int32_t  BSP_LCD_SetScrollStart(uint32_t Instance, uint32_t Line);
+int32_t  BSP_LCD_FillRGBRect_DMA(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height);
+int32_t  BSP_LCD_GetTransferStatus(uint32_t Instance, uint32_t *Pending);
+void     BSP_LCD_TransferComplete_CallBack(uint32_t Instance, uint8_t *pData);
+void     BSP_LCD_Error_CallBack(uint32_t Instance);
+void     BSP_LCD_DMA_IRQHandler(uint32_t Instance);
+int32_t  BSP_LCD_EnableTearingEffect(uint32_t Instance);
+int32_t  BSP_LCD_DisableTearingEffect(uint32_t Instance);
+void     BSP_LCD_TearingEffect_Callback(uint32_t Instance);
+void     BSP_LCD_TE_IRQHandler(uint32_t Instance);
+
 #if (USE_HAL_SRAM_REGISTER_CALLBACKS == 1)
 int32_t  BSP_LCD_RegisterDefaultMspCallbacks(uint32_t Instance);
 int32_t  BSP_LCD_RegisterMspCallbacks(uint32_t Instance, BSP_LCD_Cb_t *Callback);
@@ -0,0 +1,119 @@
+/*
+ * font_aa.c
+ *
+ * Makes the anti-aliased fonts (see Core/Display/aa_font.h) by scaling Font24 down: each output
+ * pixel's coverage is the share of its area, in the source cell, that is ink, rounded to 4 bits.
+ * Writes the tables as C++ to stdout.
+ *
+ * Build and run (from the repository root):
+ *   cc -O2 -IUtilities/Fonts Host/font_pack/font_aa.c Utilities/Fonts/font24.c -o font_aa -lm
+ *   ./font_aa > Core/Display/aa_fonts.cpp
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "fonts.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#define FIRST_CHAR  ' '
+#define GLYPH_COUNT 95U
+
+typedef struct {
+    unsigned width;
+    unsigned height;
+} target_t;
+
+static const target_t g_targets[] = {
+    { 9,  12 },
+    { 11, 16 },
+};
+
+static int ink(const sFONT *font, unsigned glyph, unsigned x, unsigned y);
+static unsigned coverage(const sFONT *font, unsigned glyph, const target_t *target, unsigned x, unsigned y);
+static void emit(const sFONT *font, const target_t *target);
+
+int main(void) {
+    printf("/*\n"
+           " * aa_fonts.cpp\n"
+           " *\n"
+           " * Anti-aliased fonts scaled from Font24. Generated by Host/font_pack/font_aa; don't edit.\n"
+           " *\n"
+           " * Copyright (c) 2021 Cameron Kluza\n"
+           " * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)\n"
+           " */\n"
+           "\n"
+           "#include \"aa_font.h\"\n");
+
+    for (size_t i = 0; i < sizeof(g_targets) / sizeof(g_targets[0]); ++i) {
+        emit(&Font24, &g_targets[i]);
+    }
+
+    return 0;
+}
+
+/* Whether a pixel of a glyph is ink, in the sFONT layout */
+static int ink(const sFONT *font, unsigned glyph, unsigned x, unsigned y) {
+    const unsigned row_bytes = (font->Width + 7U) / 8U;
+    const uint8_t *row = &font->table[(glyph * font->Height + y) * row_bytes];
+
+    return (row[x / 8U] & (0x80U >> (x % 8U))) != 0;
+}
+
+/* Coverage, 0 to 15, of one target pixel: the inked share of the source area under it */
+static unsigned coverage(const sFONT *font, unsigned glyph, const target_t *target, unsigned x, unsigned y) {
+    const double scale_x = (double)font->Width / target->width;
+    const double scale_y = (double)font->Height / target->height;
+    const double left = x * scale_x, right = (x + 1U) * scale_x;
+    const double top = y * scale_y, bottom = (y + 1U) * scale_y;
+    double area = 0.0;
+
+    for (unsigned sy = (unsigned)floor(top); sy < font->Height && sy < bottom; ++sy) {
+        const double height = fmin(bottom, sy + 1.0) - fmax(top, sy);
+
+        for (unsigned sx = (unsigned)floor(left); sx < font->Width && sx < right; ++sx) {
+            if (ink(font, glyph, sx, sy)) {
+                area += height * (fmin(right, sx + 1.0) - fmax(left, sx));
+            }
+        }
+    }
+
+    return (unsigned)lround(15.0 * area / (scale_x * scale_y));
+}
+
+static void emit(const sFONT *font, const target_t *target) {
+    const unsigned glyph_size = (target->width * target->height + 1U) / 2U;
+
+    printf("\n"
+           "////////////////////////////////////////////////////////////////////////////////////////////////////\n"
+           "// AAFont%u\n"
+           "////////////////////////////////////////////////////////////////////////////////////////////////////\n"
+           "\n", target->height);
+
+    printf("static const std::uint8_t g_aa_font%u_coverage[] = {\n", target->height);
+    for (unsigned g = 0; g < GLYPH_COUNT; ++g) {
+        unsigned char glyph[(24U * 32U + 1U) / 2U] = { 0 };
+        const int c = FIRST_CHAR + (int)g;
+
+        for (unsigned i = 0; i < target->width * target->height; ++i) {
+            const unsigned value = coverage(font, g, target, i % target->width, i / target->width);
+            glyph[i / 2U] |= (unsigned char)(value << ((i % 2U) ? 0U : 4U));
+        }
+
+        printf("    /* ");
+        printf((c == '\\' || c == '/') ? "0x%02X" : "'%c'", c);
+        printf(" */");
+        for (unsigned i = 0; i < glyph_size; ++i) {
+            printf((i % 16U == 0U) ? "\n    0x%02X," : " 0x%02X,", glyph[i]);
+        }
+        printf("\n");
+    }
+    printf("};\n\n");
+
+    printf("const aa_font AAFont%u {\n"
+           "    g_aa_font%u_coverage, %u, %u, '%c', %u,\n"
+           "};\n", target->height, target->height, target->width, target->height,
+           FIRST_CHAR, GLYPH_COUNT);
+}
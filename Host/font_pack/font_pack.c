@@ -0,0 +1,112 @@
+/*
+ * font_pack.c
+ *
+ * Converts the sFONT tables in Utilities/Fonts to packed fonts (see Core/Display/packed_font.h
+ * and packer.h). Writes the tables as C++ to stdout, and the size of each font before and after
+ * to stderr.
+ *
+ * Build and run (from the repository root):
+ *   cc -O2 -IUtilities/Fonts Host/font_pack/font_pack.c Host/font_pack/packer.c \
+ *      Utilities/Fonts/font*.c -o font_pack
+ *   ./font_pack > Core/Display/packed_fonts.cpp
+ *
+ * Each packed font is checked by unpacking it again and comparing every pixel with the source.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "fonts.h"
+#include "packer.h"
+
+#include <stdio.h>
+
+#define FIRST_CHAR  ' '
+#define GLYPH_COUNT 95U
+
+typedef struct {
+    const sFONT *font;
+    const char *name;
+} source_t;
+
+static const source_t g_sources[] = {
+    { &Font8,  "8"  },
+    { &Font12, "12" },
+    { &Font16, "16" },
+    { &Font20, "20" },
+    { &Font24, "24" },
+};
+
+static int ink(const void *context, unsigned glyph, unsigned x, unsigned y);
+
+int main(void) {
+    unsigned total_before = 0, total_after = 0;
+
+    printf("/*\n"
+           " * packed_fonts.cpp\n"
+           " *\n"
+           " * Font8 to Font24 as packed fonts. Generated by Host/font_pack; don't edit.\n"
+           " *\n"
+           " * Copyright (c) 2021 Cameron Kluza\n"
+           " * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)\n"
+           " */\n"
+           "\n"
+           "#include \"packed_font.h\"\n");
+
+    fprintf(stderr, "%-8s %8s %8s %6s\n", "font", "sFONT", "packed", "saved");
+
+    for (size_t i = 0; i < sizeof(g_sources) / sizeof(g_sources[0]); ++i) {
+        static packer_font_t packed;
+        const sFONT *font = g_sources[i].font;
+        const char *name = g_sources[i].name;
+        const packer_source_t source = { ink, font, GLYPH_COUNT, font->Width, font->Height };
+        char table[16];
+
+        if (!packer_pack(&source, &packed)) {
+            fprintf(stderr, "Font%s is too big\n", name);
+            return 1;
+        }
+        if (!packer_verify(&source, &packed)) {
+            fprintf(stderr, "Font%s doesn't unpack to the original\n", name);
+            return 1;
+        }
+
+        printf("\n"
+               "////////////////////////////////////////////////////////////////////////////////////////////////////\n"
+               "// Font%s\n"
+               "////////////////////////////////////////////////////////////////////////////////////////////////////\n"
+               "\n", name);
+
+        snprintf(table, sizeof(table), "font%s", name);
+        if (!packer_emit(table, &packed, GLYPH_COUNT)) {
+            fprintf(stderr, "Font%s needs wider offsets or box indices\n", name);
+            return 1;
+        }
+
+        printf("const packed_font PackedFont%s {\n"
+               "    g_%s_offsets, g_%s_box_indices, g_%s_boxes, g_%s_bits,\n"
+               "    sizeof(g_%s_bits), %u, %u, %u, '%c', %u,\n"
+               "};\n", name, table, table, table, table, table,
+               packed.box_count, font->Width, font->Height, FIRST_CHAR, GLYPH_COUNT);
+
+        const unsigned before = GLYPH_COUNT * font->Height * ((font->Width + 7U) / 8U);
+        const unsigned after = packer_size(&packed, GLYPH_COUNT);
+        total_before += before;
+        total_after += after;
+        fprintf(stderr, "Font%-4s %8u %8u %5u%%\n", name, before, after,
+                100U - (100U * after + before / 2U) / before);
+    }
+
+    fprintf(stderr, "%-8s %8u %8u %5u%%\n", "total", total_before, total_after,
+            100U - (100U * total_after + total_before / 2U) / total_before);
+    return 0;
+}
+
+/* Whether a pixel of a glyph is ink, in the sFONT layout */
+static int ink(const void *context, unsigned glyph, unsigned x, unsigned y) {
+    const sFONT *font = context;
+    const unsigned row_bytes = (font->Width + 7U) / 8U;
+    const uint8_t *row = &font->table[(glyph * font->Height + y) * row_bytes];
+
+    return (row[x / 8U] & (0x80U >> (x % 8U))) != 0;
+}
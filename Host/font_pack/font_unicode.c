@@ -0,0 +1,579 @@
+/*
+ * font_unicode.c
+ *
+ * Makes UnicodeFont16 (see Core/Display/unicode_font.h): Font16's ASCII, all of Latin-1 and a
+ * configurable set of extra characters, packed (see packer.h) with a codepoint range index.
+ *
+ * Accented Latin-1 letters are built from Font16's base letters and a small set of marks;
+ * capitals give up a repeated row so the mark fits above them. The other Latin-1 characters and
+ * the extras are drawn here. Writes the tables as C++ to stdout.
+ *
+ *   font_unicode [-x first-last]...
+ *
+ * With no -x every extra below is included; otherwise only those in the given hex ranges, e.g.
+ * -x 2500-257F for the box drawing characters. Pass -x 0-0 for none.
+ *
+ * Build and run (from the repository root):
+ *   cc -O2 -IUtilities/Fonts Host/font_pack/font_unicode.c Host/font_pack/packer.c \
+ *      Utilities/Fonts/font16.c -o font_unicode
+ *   ./font_unicode > Core/Display/unicode_fonts.cpp
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "fonts.h"
+#include "packer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WIDTH       11U
+#define HEIGHT      16U
+#define MAX_RANGES  16U
+#define REPLACEMENT 0xFFFDU
+
+/* Columns and rows the marks and line drawing characters center on */
+#define CENTER_X    5
+#define CENTER_Y    7
+
+typedef struct {
+    unsigned codepoint;
+    unsigned char ink[HEIGHT][WIDTH];
+} glyph_t;
+
+typedef enum {
+    MARK_GRAVE,
+    MARK_ACUTE,
+    MARK_CIRCUMFLEX,
+    MARK_TILDE,
+    MARK_DIAERESIS,
+    MARK_RING,
+    MARK_CEDILLA,
+    MARK_NONE,
+} mark_t;
+
+/* Marks, 5 columns wide and 2 rows high; the cedilla goes below the baseline */
+static const char *const g_marks[][2] = {
+    [MARK_GRAVE]      = { ".##..", "...##" },
+    [MARK_ACUTE]      = { "...##", ".##.." },
+    [MARK_CIRCUMFLEX] = { "..#..", ".#.#." },
+    [MARK_TILDE]      = { ".##.#", "#.##." },
+    [MARK_DIAERESIS]  = { "##.##", "....." },
+    [MARK_RING]       = { ".###.", ".#.#." },
+    [MARK_CEDILLA]    = { "..##.", ".##.." },
+};
+
+/* Latin-1 letters made from an ASCII letter and a mark */
+typedef struct {
+    unsigned codepoint;
+    char base;
+    mark_t mark;
+} composite_t;
+
+static const composite_t g_composites[] = {
+    { 0xC0, 'A', MARK_GRAVE }, { 0xC1, 'A', MARK_ACUTE }, { 0xC2, 'A', MARK_CIRCUMFLEX },
+    { 0xC3, 'A', MARK_TILDE }, { 0xC4, 'A', MARK_DIAERESIS }, { 0xC5, 'A', MARK_RING },
+    { 0xC7, 'C', MARK_CEDILLA },
+    { 0xC8, 'E', MARK_GRAVE }, { 0xC9, 'E', MARK_ACUTE }, { 0xCA, 'E', MARK_CIRCUMFLEX },
+    { 0xCB, 'E', MARK_DIAERESIS },
+    { 0xCC, 'I', MARK_GRAVE }, { 0xCD, 'I', MARK_ACUTE }, { 0xCE, 'I', MARK_CIRCUMFLEX },
+    { 0xCF, 'I', MARK_DIAERESIS },
+    { 0xD1, 'N', MARK_TILDE },
+    { 0xD2, 'O', MARK_GRAVE }, { 0xD3, 'O', MARK_ACUTE }, { 0xD4, 'O', MARK_CIRCUMFLEX },
+    { 0xD5, 'O', MARK_TILDE }, { 0xD6, 'O', MARK_DIAERESIS },
+    { 0xD9, 'U', MARK_GRAVE }, { 0xDA, 'U', MARK_ACUTE }, { 0xDB, 'U', MARK_CIRCUMFLEX },
+    { 0xDC, 'U', MARK_DIAERESIS },
+    { 0xDD, 'Y', MARK_ACUTE },
+    { 0xE0, 'a', MARK_GRAVE }, { 0xE1, 'a', MARK_ACUTE }, { 0xE2, 'a', MARK_CIRCUMFLEX },
+    { 0xE3, 'a', MARK_TILDE }, { 0xE4, 'a', MARK_DIAERESIS }, { 0xE5, 'a', MARK_RING },
+    { 0xE7, 'c', MARK_CEDILLA },
+    { 0xE8, 'e', MARK_GRAVE }, { 0xE9, 'e', MARK_ACUTE }, { 0xEA, 'e', MARK_CIRCUMFLEX },
+    { 0xEB, 'e', MARK_DIAERESIS },
+    { 0xEC, 'i', MARK_GRAVE }, { 0xED, 'i', MARK_ACUTE }, { 0xEE, 'i', MARK_CIRCUMFLEX },
+    { 0xEF, 'i', MARK_DIAERESIS },
+    { 0xF1, 'n', MARK_TILDE },
+    { 0xF2, 'o', MARK_GRAVE }, { 0xF3, 'o', MARK_ACUTE }, { 0xF4, 'o', MARK_CIRCUMFLEX },
+    { 0xF5, 'o', MARK_TILDE }, { 0xF6, 'o', MARK_DIAERESIS },
+    { 0xF9, 'u', MARK_GRAVE }, { 0xFA, 'u', MARK_ACUTE }, { 0xFB, 'u', MARK_CIRCUMFLEX },
+    { 0xFC, 'u', MARK_DIAERESIS },
+    { 0xFD, 'y', MARK_ACUTE }, { 0xFF, 'y', MARK_DIAERESIS },
+    /* Spacing marks */
+    { 0xA8, ' ', MARK_DIAERESIS }, { 0xB4, ' ', MARK_ACUTE }, { 0xB8, ' ', MARK_CEDILLA },
+};
+
+/* Characters drawn here, as rows of '#' starting at a given row */
+typedef struct {
+    unsigned codepoint;
+    unsigned top;
+    const char *rows[13];
+} drawn_t;
+
+static const drawn_t g_drawn[] = {
+    { 0xA3, 2, { "....####...", "...##..##..", "...##......", "...##......", ".######....",
+                 "...##......", "...##......", "..##....#..", ".########.." } },
+    { 0xA4, 3, { ".##.....##.", "..#######..", "..##...##..", "..##...##..", "..##...##..",
+                 "..#######..", ".##.....##." } },
+    { 0xA6, 1, { ".....##....", ".....##....", ".....##....", ".....##....", ".....##....",
+                 "...........", "...........", ".....##....", ".....##....", ".....##....",
+                 ".....##....", ".....##...." } },
+    { 0xA7, 1, { "...#####...", "..##...##..", "..##.......", "...####....", "..##..##...",
+                 "..##...##..", "...##..##..", "....####...", "......##...", "..##...##..",
+                 "...#####..." } },
+    { 0xA9, 1, { "...#####...", "..#.....#..", ".#..###..#.", ".#.#...#.#.", ".#.#.....#.",
+                 ".#.#.....#.", ".#.#...#.#.", ".#..###..#.", "..#.....#..", "...#####..." } },
+    { 0xAA, 1, { "...###.....", "......#....", "...####....", "..#...#....", "...####....",
+                 "...........", "..#####...." } },
+    { 0xAB, 4, { "....##..##.", "...##..##..", "..##..##...", "...##..##..", "....##..##." } },
+    { 0xAC, 6, { ".########..", ".......##..", ".......##.." } },
+    { 0xAE, 1, { "...#####...", "..#.....#..", ".#.###...#.", ".#.#..#..#.", ".#.###...#.",
+                 ".#.#.#...#.", ".#.#..#..#.", ".#.......#.", "..#.....#..", "...#####..." } },
+    { 0xAF, 1, { ".#########." } },
+    { 0xB0, 1, { "...###.....", "..#...#....", "..#...#....", "...###....." } },
+    { 0xB1, 2, { ".....##....", ".....##....", ".#########.", ".....##....", ".....##....",
+                 "...........", ".#########." } },
+    { 0xB2, 1, { "..###......", ".#...#.....", "....#......", "...#.......", "..#####...." } },
+    { 0xB3, 1, { "..###......", ".....#.....", "...##......", ".....#.....", "..###......" } },
+    { 0xB5, 4, { ".##....##..", ".##....##..", ".##....##..", ".##....##..", ".##....##..",
+                 ".###..###..", ".##.###.##.", ".##........", ".##........", ".##........" } },
+    { 0xB6, 2, { "..#######..", ".#####.#...", ".#####.#...", "..####.#...", "....##.#...",
+                 ".....#.#...", ".....#.#...", ".....#.#...", ".....#.#...", ".....#.#...",
+                 ".....#.#..." } },
+    { 0xB7, 6, { ".....##....", ".....##...." } },
+    { 0xB9, 1, { "...#.......", "..##.......", "...#.......", "...#.......", "..###......" } },
+    { 0xBA, 1, { "...###.....", "..#...#....", "..#...#....", "..#...#....", "...###.....",
+                 "...........", "..#####...." } },
+    { 0xBB, 4, { ".##..##....", "..##..##...", "...##..##..", "..##..##...", ".##..##...." } },
+    { 0xC6, 2, { "..########.", "..##.##..#.", ".##..##....", ".##..##.#..", ".#######...",
+                 "##...##.#..", "##...##....", "##...##..#.", "###.######." } },
+    { 0xD7, 4, { "..##...##..", "...##.##...", "....###....", "...##.##...", "..##...##.." } },
+    { 0xDE, 2, { ".####......", "..##.......", "..######...", "..##...##..", "..##...##..",
+                 "..######...", "..##.......", "..##.......", ".####......" } },
+    { 0xDF, 1, { "...####....", "..##..##...", "..##..##...", "..##.##....", "..##.###...",
+                 "..##...##..", "..##...##..", "..##...##..", "..##.###...", ".###.##...." } },
+    { 0xE6, 4, { ".###.###...", "....##..#..", "....##..#..", ".########..", "##..##.....",
+                 "##..##...#.", ".###.####.." } },
+    { 0xF0, 1, { "..##.#.....", "...###.....", "..#..##....", "......##...", "...######..",
+                 "..##....##.", ".##.....##.", ".##.....##.", "..##...##..", "...#####..." } },
+    { 0xF7, 3, { ".....##....", ".....##....", "...........", ".#########.", "...........",
+                 ".....##....", ".....##...." } },
+    { 0xFE, 1, { ".###.......", "..##.......", "..##.......", "..##.###...", "..###..##..",
+                 "..##....##.", "..##....##.", "..##....##.", "..###..##..", "..##.###...",
+                 "..##.......", "..##.......", ".####......" } },
+    /* Extras */
+    { 0x2013, 6, { ".#########." } },
+    { 0x2014, 6, { "###########" } },
+    { 0x2018, 1, { "......#....", ".....#.....", ".....##....", ".....##...." } },
+    { 0x2019, 1, { ".....##....", ".....##....", "......#....", ".....#....." } },
+    { 0x201C, 1, { "....#...#..", "...#...#...", "...##..##..", "...##..##.." } },
+    { 0x201D, 1, { "...##..##..", "...##..##..", "....#...#..", "...#...#..." } },
+    { 0x2022, 5, { "....###....", "...#####...", "...#####...", "...#####...", "....###...." } },
+    { 0x2026, 9, { "##..##..##.", "##..##..##." } },
+    { 0x20AC, 2, { "....#####..", "...##...##.", "..##.......", "#######....", "..##.......",
+                 "#######....", "..##.......", "...##...##.", "....#####.." } },
+    { 0x2190, 4, { "....#......", "...##......", "..###......", ".##########", "..###......",
+                 "...##......", "....#......" } },
+    { 0x2191, 2, { ".....#.....", "....###....", "...#####...", "..#######..", ".....#.....",
+                 ".....#.....", ".....#.....", ".....#.....", ".....#.....", ".....#.....",
+                 ".....#.....", ".....#....." } },
+    { 0x2192, 4, { "......#....", "......##...", "......###..", "##########.", "......###..",
+                 "......##...", "......#...." } },
+    { 0x2193, 2, { ".....#.....", ".....#.....", ".....#.....", ".....#.....", ".....#.....",
+                 ".....#.....", ".....#.....", ".....#.....", "..#######..", "...#####...",
+                 "....###....", ".....#....." } },
+    { REPLACEMENT, 2, { "#########..", "#.......#..", "#..###..#..", "#.#...#.#..", "#....#..#..",
+                 "#...#...#..", "#.......#..", "#...#...#..", "#.......#..", "#########.." } },
+};
+
+/* Box drawing: which arms leave the center */
+enum { ARM_LEFT = 1, ARM_RIGHT = 2, ARM_UP = 4, ARM_DOWN = 8 };
+
+static const struct {
+    unsigned codepoint;
+    unsigned arms;
+} g_lines[] = {
+    { 0x2500, ARM_LEFT | ARM_RIGHT },
+    { 0x2502, ARM_UP | ARM_DOWN },
+    { 0x250C, ARM_RIGHT | ARM_DOWN },
+    { 0x2510, ARM_LEFT | ARM_DOWN },
+    { 0x2514, ARM_RIGHT | ARM_UP },
+    { 0x2518, ARM_LEFT | ARM_UP },
+    { 0x251C, ARM_RIGHT | ARM_UP | ARM_DOWN },
+    { 0x2524, ARM_LEFT | ARM_UP | ARM_DOWN },
+    { 0x252C, ARM_LEFT | ARM_RIGHT | ARM_DOWN },
+    { 0x2534, ARM_LEFT | ARM_RIGHT | ARM_UP },
+    { 0x253C, ARM_LEFT | ARM_RIGHT | ARM_UP | ARM_DOWN },
+};
+
+/* Block elements and shades, as a test per pixel */
+static int block_upper(unsigned x, unsigned y) { (void)x; return y < HEIGHT / 2U; }
+static int block_lower(unsigned x, unsigned y) { (void)x; return y >= HEIGHT / 2U; }
+static int block_full(unsigned x, unsigned y) { (void)x; (void)y; return 1; }
+static int block_left(unsigned x, unsigned y) { (void)y; return x <= CENTER_X; }
+static int block_right(unsigned x, unsigned y) { (void)y; return x > CENTER_X; }
+static int shade_light(unsigned x, unsigned y) { return (y % 2U == 0U) && ((x + y / 2U) % 2U == 0U); }
+static int shade_medium(unsigned x, unsigned y) { return (x + y) % 2U == 0U; }
+static int shade_dark(unsigned x, unsigned y) { return !shade_light(x, y); }
+
+static const struct {
+    unsigned codepoint;
+    int (*ink)(unsigned x, unsigned y);
+} g_blocks[] = {
+    { 0x2580, block_upper },
+    { 0x2584, block_lower },
+    { 0x2588, block_full },
+    { 0x258C, block_left },
+    { 0x2590, block_right },
+    { 0x2591, shade_light },
+    { 0x2592, shade_medium },
+    { 0x2593, shade_dark },
+};
+
+/* Small digits for the vulgar fractions, 3 columns by 5 rows */
+static const char *const g_small_digits[][5] = {
+    ['1'] = { ".#.", "##.", ".#.", ".#.", "###" },
+    ['2'] = { "##.", "..#", ".#.", "#..", "###" },
+    ['3'] = { "##.", "..#", ".#.", "..#", "##." },
+    ['4'] = { "#.#", "#.#", "###", "..#", "..#" },
+};
+
+static glyph_t g_glyphs[PACKER_MAX_GLYPHS];
+static unsigned g_glyph_count;
+
+static unsigned g_selected[MAX_RANGES][2];
+static unsigned g_selected_count;
+
+static glyph_t *add(unsigned codepoint);
+static void load_ascii(glyph_t *glyph, char c);
+static void draw_rows(glyph_t *glyph, unsigned top, const char *const *rows, unsigned count);
+static void put_mark(glyph_t *glyph, mark_t mark, int center);
+static void make_room_above(glyph_t *glyph);
+static void slash(glyph_t *glyph, unsigned top, unsigned bottom);
+static void rotate(glyph_t *glyph);
+static void fraction(glyph_t *glyph, char numerator, char denominator);
+static int ink_center(const glyph_t *glyph);
+static int selected(unsigned codepoint);
+static int compare(const void *a, const void *b);
+static int ink(const void *context, unsigned glyph, unsigned x, unsigned y);
+
+int main(int argc, char **argv) {
+    for (int i = 1; i < argc; ++i) {
+        unsigned first, last;
+        if (strcmp(argv[i], "-x") == 0 && i + 1 < argc && g_selected_count < MAX_RANGES &&
+            sscanf(argv[++i], "%x-%x", &first, &last) == 2) {
+            g_selected[g_selected_count][0] = first;
+            g_selected[g_selected_count][1] = last;
+            ++g_selected_count;
+        } else {
+            fprintf(stderr, "usage: %s [-x first-last]...\n", argv[0]);
+            return 2;
+        }
+    }
+
+    /* ASCII */
+    for (char c = ' '; c <= '~'; ++c) {
+        load_ascii(add((unsigned char)c), c);
+    }
+
+    /* Latin-1 */
+    load_ascii(add(0xA0), ' ');
+    load_ascii(add(0xAD), '-');
+
+    glyph_t *glyph = add(0xA1);
+    load_ascii(glyph, '!');
+    rotate(glyph);
+    glyph = add(0xBF);
+    load_ascii(glyph, '?');
+    rotate(glyph);
+
+    glyph = add(0xA2);
+    load_ascii(glyph, 'c');
+    for (unsigned y = 2; y < 13; ++y) {
+        glyph->ink[y][CENTER_X] = 1;
+    }
+
+    glyph = add(0xA5);
+    load_ascii(glyph, 'Y');
+    for (unsigned x = 2; x < 9; ++x) {
+        glyph->ink[7][x] = glyph->ink[8][x] = 1;
+    }
+
+    glyph = add(0xD0);
+    load_ascii(glyph, 'D');
+    for (unsigned x = 0; x < 5; ++x) {
+        glyph->ink[6][x] = 1;
+    }
+
+    glyph = add(0xD8);
+    load_ascii(glyph, 'O');
+    slash(glyph, 1, 11);
+    glyph = add(0xF8);
+    load_ascii(glyph, 'o');
+    slash(glyph, 3, 11);
+
+    fraction(add(0xBC), '1', '4');
+    fraction(add(0xBD), '1', '2');
+    fraction(add(0xBE), '3', '4');
+
+    for (size_t i = 0; i < sizeof(g_composites) / sizeof(g_composites[0]); ++i) {
+        const composite_t *composite = &g_composites[i];
+        glyph = add(composite->codepoint);
+        load_ascii(glyph, composite->base);
+
+        if (composite->base == 'i') {
+            /* Dotless */
+            memset(glyph->ink[0], 0, sizeof(glyph->ink[0]) * 4U);
+        } else if (composite->base >= 'A' && composite->base <= 'Z' && composite->mark != MARK_CEDILLA) {
+            make_room_above(glyph);
+        }
+        put_mark(glyph, composite->mark, (composite->base == ' ') ? CENTER_X : ink_center(glyph));
+    }
+
+    /* Drawn Latin-1 characters, and the extras that are selected */
+    for (size_t i = 0; i < sizeof(g_drawn) / sizeof(g_drawn[0]); ++i) {
+        const drawn_t *drawn = &g_drawn[i];
+        unsigned count = 0;
+
+        if (drawn->codepoint > 0xFF && drawn->codepoint != REPLACEMENT && !selected(drawn->codepoint)) {
+            continue;
+        }
+        while (count < 13U && drawn->rows[count] != NULL) {
+            ++count;
+        }
+        draw_rows(add(drawn->codepoint), drawn->top, drawn->rows, count);
+    }
+
+    for (size_t i = 0; i < sizeof(g_lines) / sizeof(g_lines[0]); ++i) {
+        const unsigned arms = g_lines[i].arms;
+        if (!selected(g_lines[i].codepoint)) {
+            continue;
+        }
+
+        glyph = add(g_lines[i].codepoint);
+        for (unsigned x = 0; x < WIDTH; ++x) {
+            if (((arms & ARM_LEFT) && x <= CENTER_X) || ((arms & ARM_RIGHT) && x >= CENTER_X)) {
+                glyph->ink[CENTER_Y][x] = 1;
+            }
+        }
+        for (unsigned y = 0; y < HEIGHT; ++y) {
+            if (((arms & ARM_UP) && y <= CENTER_Y) || ((arms & ARM_DOWN) && y >= CENTER_Y)) {
+                glyph->ink[y][CENTER_X] = 1;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < sizeof(g_blocks) / sizeof(g_blocks[0]); ++i) {
+        if (!selected(g_blocks[i].codepoint)) {
+            continue;
+        }
+
+        glyph = add(g_blocks[i].codepoint);
+        for (unsigned y = 0; y < HEIGHT; ++y) {
+            for (unsigned x = 0; x < WIDTH; ++x) {
+                glyph->ink[y][x] = (unsigned char)g_blocks[i].ink(x, y);
+            }
+        }
+    }
+
+    qsort(g_glyphs, g_glyph_count, sizeof(g_glyphs[0]), compare);
+
+    /* Pack, and index runs of consecutive codepoints */
+    static packer_font_t packed;
+    const packer_source_t source = { ink, NULL, g_glyph_count, WIDTH, HEIGHT };
+    if (!packer_pack(&source, &packed) || !packer_verify(&source, &packed)) {
+        fprintf(stderr, "couldn't pack the font\n");
+        return 1;
+    }
+
+    printf("/*\n"
+           " * unicode_fonts.cpp\n"
+           " *\n"
+           " * Font16 with Latin-1 and extras. Generated by Host/font_pack/font_unicode; don't edit.\n"
+           " *\n"
+           " * Copyright (c) 2021 Cameron Kluza\n"
+           " * Distributed under the MIT license (see LICENSE or https://opensource.org/licenses/MIT)\n"
+           " */\n"
+           "\n"
+           "#include \"unicode_font.h\"\n"
+           "\n");
+
+    if (!packer_emit("unicode16", &packed, g_glyph_count)) {
+        fprintf(stderr, "the font needs wider offsets or box indices\n");
+        return 1;
+    }
+
+    unsigned ranges = 0, replacement = 0;
+    printf("static const codepoint_range g_unicode16_ranges[] = {\n");
+    for (unsigned g = 0; g < g_glyph_count;) {
+        unsigned count = 1;
+        while (g + count < g_glyph_count && g_glyphs[g + count].codepoint == g_glyphs[g].codepoint + count) {
+            ++count;
+        }
+        printf("    { 0x%04X, %3u, %3u },\n", g_glyphs[g].codepoint, count, g);
+        ++ranges;
+        g += count;
+    }
+    printf("};\n\n");
+
+    for (unsigned g = 0; g < g_glyph_count; ++g) {
+        if (g_glyphs[g].codepoint == REPLACEMENT) {
+            replacement = g;
+        }
+    }
+
+    printf("const unicode_font UnicodeFont16 {\n"
+           "    {\n"
+           "        g_unicode16_offsets, g_unicode16_box_indices, g_unicode16_boxes, g_unicode16_bits,\n"
+           "        sizeof(g_unicode16_bits), %u, %u, %u, 0, %u,\n"
+           "    },\n"
+           "    g_unicode16_ranges, %u, %u,\n"
+           "};\n", packed.box_count, WIDTH, HEIGHT, g_glyph_count, ranges, replacement);
+
+    fprintf(stderr, "%u glyphs in %u ranges, %u bytes\n", g_glyph_count, ranges,
+            packer_size(&packed, g_glyph_count) + ranges * 8U);
+    return 0;
+}
+
+static glyph_t *add(unsigned codepoint) {
+    if (g_glyph_count == PACKER_MAX_GLYPHS) {
+        fprintf(stderr, "too many glyphs\n");
+        exit(1);
+    }
+
+    glyph_t *glyph = &g_glyphs[g_glyph_count++];
+    memset(glyph, 0, sizeof(*glyph));
+    glyph->codepoint = codepoint;
+    return glyph;
+}
+
+static void load_ascii(glyph_t *glyph, char c) {
+    const unsigned row_bytes = (Font16.Width + 7U) / 8U;
+
+    for (unsigned y = 0; y < HEIGHT; ++y) {
+        const uint8_t *row = &Font16.table[((unsigned)(c - ' ') * Font16.Height + y) * row_bytes];
+        for (unsigned x = 0; x < WIDTH; ++x) {
+            glyph->ink[y][x] = (row[x / 8U] & (0x80U >> (x % 8U))) != 0;
+        }
+    }
+}
+
+static void draw_rows(glyph_t *glyph, unsigned top, const char *const *rows, unsigned count) {
+    for (unsigned y = 0; y < count && top + y < HEIGHT; ++y) {
+        for (unsigned x = 0; x < WIDTH && rows[y][x] != '\0'; ++x) {
+            glyph->ink[top + y][x] = rows[y][x] == '#';
+        }
+    }
+}
+
+/* Puts a mark centered on a column: cedillas below the baseline, others above the glyph */
+static void put_mark(glyph_t *glyph, mark_t mark, int center) {
+    int highest = HEIGHT;
+
+    if (mark == MARK_NONE) {
+        return;
+    }
+
+    for (unsigned y = 0; y < HEIGHT && highest == (int)HEIGHT; ++y) {
+        for (unsigned x = 0; x < WIDTH; ++x) {
+            if (glyph->ink[y][x]) {
+                highest = (int)y;
+                break;
+            }
+        }
+    }
+
+    /* Above capitals (ink from row 3) the mark takes rows 0 and 1, above lowercase 1 and 2 */
+    const int row = (mark == MARK_CEDILLA) ? 11 : ((highest <= 3) ? 0 : 1);
+
+    for (int y = 0; y < 2; ++y) {
+        for (int x = 0; x < 5; ++x) {
+            const int column = center - 2 + x;
+            if (g_marks[mark][y][x] == '#' && column >= 0 && column < (int)WIDTH) {
+                glyph->ink[row + y][column] = 1;
+            }
+        }
+    }
+}
+
+/* Drops a row from a capital that repeats the one above it, moving the top of the glyph down
+ * one row so a mark fits above it with a row to spare */
+static void make_room_above(glyph_t *glyph) {
+    for (unsigned r = 4; r < 10; ++r) {
+        if (memcmp(glyph->ink[r], glyph->ink[r - 1], WIDTH) == 0) {
+            memmove(glyph->ink[3], glyph->ink[2], WIDTH * (r - 2));
+            memset(glyph->ink[2], 0, WIDTH);
+            return;
+        }
+    }
+}
+
+/* A stroke from the top right to the bottom left */
+static void slash(glyph_t *glyph, unsigned top, unsigned bottom) {
+    for (unsigned y = top; y <= bottom; ++y) {
+        const unsigned x = 9U - (y - top) * 8U / (bottom - top);
+        glyph->ink[y][x] = 1;
+    }
+}
+
+/* Turns a glyph upside down, about the middle of the rows from the cap height to the descender */
+static void rotate(glyph_t *glyph) {
+    glyph_t turned = *glyph;
+
+    memset(turned.ink, 0, sizeof(turned.ink));
+    for (unsigned y = 1; y < 14; ++y) {
+        for (unsigned x = 0; x < WIDTH; ++x) {
+            turned.ink[14U - y][WIDTH - 1U - x] = glyph->ink[y][x];
+        }
+    }
+    memcpy(glyph->ink, turned.ink, sizeof(turned.ink));
+}
+
+static void fraction(glyph_t *glyph, char numerator, char denominator) {
+    for (unsigned y = 0; y < 5; ++y) {
+        for (unsigned x = 0; x < 3; ++x) {
+            glyph->ink[1 + y][x] |= g_small_digits[(unsigned char)numerator][y][x] == '#';
+            glyph->ink[8 + y][7 + x] |= g_small_digits[(unsigned char)denominator][y][x] == '#';
+        }
+    }
+    slash(glyph, 1, 12);
+}
+
+/* Middle column of a glyph's ink, or -1 if it has none */
+static int ink_center(const glyph_t *glyph) {
+    int left = WIDTH, right = -1;
+
+    for (unsigned y = 0; y < HEIGHT; ++y) {
+        for (unsigned x = 0; x < WIDTH; ++x) {
+            if (glyph->ink[y][x]) {
+                left = ((int)x < left) ? (int)x : left;
+                right = ((int)x > right) ? (int)x : right;
+            }
+        }
+    }
+
+    return (right < 0) ? -1 : (left + right) / 2;
+}
+
+static int selected(unsigned codepoint) {
+    if (g_selected_count == 0U) {
+        return 1;
+    }
+    for (unsigned i = 0; i < g_selected_count; ++i) {
+        if (codepoint >= g_selected[i][0] && codepoint <= g_selected[i][1]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int compare(const void *a, const void *b) {
+    const unsigned left = ((const glyph_t *)a)->codepoint;
+    const unsigned right = ((const glyph_t *)b)->codepoint;
+    return (left > right) - (left < right);
+}
+
+static int ink(const void *context, unsigned glyph, unsigned x, unsigned y) {
+    (void)context;
+    return g_glyphs[glyph].ink[y][x];
+}
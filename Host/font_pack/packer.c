@@ -0,0 +1,129 @@
+/*
+ * packer.c
+ *
+ * Packs 1-bpp glyphs into the packed font tables.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "packer.h"
+
+#include <stdio.h>
+#include <string.h>
+
+int packer_pack(const packer_source_t *source, packer_font_t *packed) {
+    unsigned bit = 0;
+
+    if (source->glyph_count > PACKER_MAX_GLYPHS ||
+        source->width > PACKER_MAX_WIDTH || source->height > PACKER_MAX_HEIGHT) {
+        return 0;
+    }
+
+    memset(packed, 0, sizeof(*packed));
+
+    for (unsigned g = 0; g < source->glyph_count; ++g) {
+        unsigned left = source->width, top = source->height, right = 0, bottom = 0;
+        packer_box_t box = { 0, 0, 0, 0 };
+
+        for (unsigned y = 0; y < source->height; ++y) {
+            for (unsigned x = 0; x < source->width; ++x) {
+                if (source->ink(source->context, g, x, y)) {
+                    left = (x < left) ? x : left;
+                    right = (x + 1U > right) ? x + 1U : right;
+                    top = (y < top) ? y : top;
+                    bottom = (y + 1U > bottom) ? y + 1U : bottom;
+                }
+            }
+        }
+        if (right != 0U) {
+            box.x = left;
+            box.y = top;
+            box.width = right - left;
+            box.height = bottom - top;
+        }
+
+        unsigned b = 0;
+        while (b < packed->box_count && memcmp(&packed->boxes[b], &box, sizeof(box)) != 0) {
+            ++b;
+        }
+        if (b == packed->box_count) {
+            packed->boxes[packed->box_count++] = box;
+        }
+
+        packed->offsets[g] = bit;
+        packed->box_indices[g] = b;
+
+        for (unsigned y = box.y; y < box.y + box.height; ++y) {
+            for (unsigned x = box.x; x < box.x + box.width; ++x, ++bit) {
+                if (source->ink(source->context, g, x, y)) {
+                    packed->bits[bit / 8U] |= (unsigned char)(0x80U >> (bit % 8U));
+                }
+            }
+        }
+    }
+
+    packed->bits_size = (bit + 7U) / 8U;
+    return 1;
+}
+
+int packer_verify(const packer_source_t *source, const packer_font_t *packed) {
+    for (unsigned g = 0; g < source->glyph_count; ++g) {
+        const packer_box_t *box = &packed->boxes[packed->box_indices[g]];
+        unsigned bit = packed->offsets[g];
+
+        for (unsigned y = 0; y < source->height; ++y) {
+            for (unsigned x = 0; x < source->width; ++x) {
+                int ink = 0;
+                if (y >= box->y && y < box->y + box->height &&
+                    x >= box->x && x < box->x + box->width) {
+                    ink = (packed->bits[bit / 8U] & (0x80U >> (bit % 8U))) != 0;
+                    ++bit;
+                }
+                if (ink != (source->ink(source->context, g, x, y) != 0)) {
+                    return 0;
+                }
+            }
+        }
+    }
+
+    return 1;
+}
+
+unsigned packer_size(const packer_font_t *packed, unsigned glyph_count) {
+    return glyph_count * 3U + packed->box_count * 4U + packed->bits_size;
+}
+
+int packer_emit(const char *name, const packer_font_t *packed, unsigned glyph_count) {
+    if (packed->bits_size * 8U > 0xFFFFU || packed->box_count > 0x100U) {
+        return 0;
+    }
+
+    printf("static const std::uint16_t g_%s_offsets[] = {", name);
+    for (unsigned g = 0; g < glyph_count; ++g) {
+        printf((g % 12U == 0U) ? "\n    %5u," : " %5u,", packed->offsets[g]);
+    }
+    printf("\n};\n\n");
+
+    printf("static const std::uint8_t g_%s_box_indices[] = {", name);
+    for (unsigned g = 0; g < glyph_count; ++g) {
+        printf((g % 16U == 0U) ? "\n    %3u," : " %3u,", packed->box_indices[g]);
+    }
+    printf("\n};\n\n");
+
+    printf("static const packed_box g_%s_boxes[] = {", name);
+    for (unsigned b = 0; b < packed->box_count; ++b) {
+        const packer_box_t *box = &packed->boxes[b];
+        printf((b % 4U == 0U) ? "\n    { %2u, %2u, %2u, %2u }," : " { %2u, %2u, %2u, %2u },",
+               box->x, box->y, box->width, box->height);
+    }
+    printf("\n};\n\n");
+
+    printf("static const std::uint8_t g_%s_bits[] = {", name);
+    for (unsigned i = 0; i < packed->bits_size; ++i) {
+        printf((i % 16U == 0U) ? "\n    0x%02X," : " 0x%02X,", packed->bits[i]);
+    }
+    printf("\n};\n\n");
+
+    return 1;
+}
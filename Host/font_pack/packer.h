@@ -0,0 +1,58 @@
+/*
+ * packer.h
+ *
+ * Packs 1-bpp glyphs into the packed font tables (see Core/Display/packed_font.h): each glyph is
+ * cropped to its ink box, the boxes are deduplicated, and the pixels in the boxes are bit-packed
+ * back to back. Shared by the font generators in this directory.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#ifndef PACKER_H_
+#define PACKER_H_
+
+#define PACKER_MAX_GLYPHS 512U
+#define PACKER_MAX_WIDTH  24U
+#define PACKER_MAX_HEIGHT 32U
+#define PACKER_MAX_BITS   (PACKER_MAX_GLYPHS * PACKER_MAX_WIDTH * PACKER_MAX_HEIGHT / 8U)
+
+/* Whether a pixel of a glyph is ink */
+typedef int (*packer_ink_fn)(const void *context, unsigned glyph, unsigned x, unsigned y);
+
+typedef struct {
+    packer_ink_fn ink;
+    const void *context;
+    unsigned glyph_count;
+    unsigned width;
+    unsigned height;
+} packer_source_t;
+
+typedef struct {
+    unsigned x, y, width, height;
+} packer_box_t;
+
+typedef struct {
+    unsigned offsets[PACKER_MAX_GLYPHS];     /* in bits */
+    unsigned box_indices[PACKER_MAX_GLYPHS];
+    packer_box_t boxes[PACKER_MAX_GLYPHS];
+    unsigned box_count;
+    unsigned char bits[PACKER_MAX_BITS];
+    unsigned bits_size;                      /* in bytes */
+} packer_font_t;
+
+/* Packs every glyph of a source. Returns 0 if the source is too big. */
+int packer_pack(const packer_source_t *source, packer_font_t *packed);
+
+/* Unpacks every glyph and compares it with the source. Returns 1 if they all match. */
+int packer_verify(const packer_source_t *source, const packer_font_t *packed);
+
+/* Flash the tables take, in bytes: per glyph a 16-bit offset and an 8-bit box index, 4 bytes
+ * per box, and the bits. */
+unsigned packer_size(const packer_font_t *packed, unsigned glyph_count);
+
+/* Prints the tables as C++ arrays named g_<name>_offsets, _box_indices, _boxes and _bits.
+ * Returns 0 if they don't fit the packed_font field widths. */
+int packer_emit(const char *name, const packer_font_t *packed, unsigned glyph_count);
+
+#endif /* PACKER_H_ */
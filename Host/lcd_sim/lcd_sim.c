@@ -0,0 +1,417 @@
+/*
+ * lcd_sim.c
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "lcd_sim.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/* Bus accesses for a CASET + RASET pair (SetCursor or SetDisplayWindow): two commands and four
+ * parameters each. */
+#define WINDOW_COMMANDS 2U
+#define WINDOW_DATA     8U
+
+/* DrawBitmap also flips MADCTL for the bottom-up rows and restores the window and MADCTL. */
+#define BITMAP_EXTRA_COMMANDS (WINDOW_COMMANDS + 2U)
+#define BITMAP_EXTRA_DATA     (WINDOW_DATA + 2U)
+
+/* GetPixel reads a dummy word and two words of RGB888. */
+#define PIXEL_READS 3U
+
+static uint16_t g_framebuffer[LCD_SIM_WIDTH * LCD_SIM_HEIGHT];
+static lcd_sim_stats_t g_stats;
+
+static int32_t draw_bitmap(uint32_t instance, uint32_t x, uint32_t y, uint8_t *bmp);
+static int32_t fill_rgb_rect(uint32_t instance, uint32_t x, uint32_t y, uint8_t *data, uint32_t width, uint32_t height);
+static int32_t draw_hline(uint32_t instance, uint32_t x, uint32_t y, uint32_t length, uint32_t color);
+static int32_t draw_vline(uint32_t instance, uint32_t x, uint32_t y, uint32_t length, uint32_t color);
+static int32_t fill_rect(uint32_t instance, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t color);
+static int32_t get_pixel(uint32_t instance, uint32_t x, uint32_t y, uint32_t *color);
+static int32_t set_pixel(uint32_t instance, uint32_t x, uint32_t y, uint32_t color);
+static int32_t get_x_size(uint32_t instance, uint32_t *size);
+static int32_t get_y_size(uint32_t instance, uint32_t *size);
+static int32_t set_layer(uint32_t instance, uint32_t layer);
+static int32_t get_format(uint32_t instance, uint32_t *format);
+
+static void charge_window(void);
+static void charge_gram_write(uint32_t x, uint32_t width, uint32_t pixels);
+static int in_bounds(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+static void plot(uint32_t x, uint32_t y, uint16_t color);
+static void fill_window(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint16_t color);
+static void to_rgb888(uint16_t pixel, uint8_t *rgb);
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len);
+static void png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len);
+static void put_be32(uint8_t *dst, uint32_t value);
+
+const LCD_UTILS_Drv_t lcd_sim_driver = {
+    .DrawBitmap = draw_bitmap,
+    .FillRGBRect = fill_rgb_rect,
+    .DrawHLine = draw_hline,
+    .DrawVLine = draw_vline,
+    .FillRect = fill_rect,
+    .GetPixel = get_pixel,
+    .SetPixel = set_pixel,
+    .GetXSize = get_x_size,
+    .GetYSize = get_y_size,
+    .SetLayer = set_layer,
+    .GetFormat = get_format,
+};
+
+void lcd_sim_reset(uint16_t color) {
+    for (size_t i = 0; i < LCD_SIM_WIDTH * LCD_SIM_HEIGHT; ++i) {
+        g_framebuffer[i] = color;
+    }
+    lcd_sim_reset_stats();
+}
+
+void lcd_sim_reset_stats(void) {
+    memset(&g_stats, 0, sizeof(g_stats));
+}
+
+void lcd_sim_get_stats(lcd_sim_stats_t *stats) {
+    *stats = g_stats;
+    stats->transactions = g_stats.commands + g_stats.data_writes + g_stats.data_reads;
+    stats->bytes = 2U * stats->transactions;
+}
+
+const uint16_t *lcd_sim_framebuffer(void) {
+    return g_framebuffer;
+}
+
+int lcd_sim_write_ppm(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return -1;
+    }
+
+    fprintf(f, "P6\n%u %u\n255\n", LCD_SIM_WIDTH, LCD_SIM_HEIGHT);
+    for (size_t i = 0; i < LCD_SIM_WIDTH * LCD_SIM_HEIGHT; ++i) {
+        uint8_t rgb[3];
+        to_rgb888(g_framebuffer[i], rgb);
+        fwrite(rgb, 1, sizeof(rgb), f);
+    }
+
+    return (fclose(f) == 0) ? 0 : -1;
+}
+
+int lcd_sim_write_png(const char *path) {
+    /* Each row is a filter byte (0, none) and RGB888 pixels */
+    enum { ROW_SIZE = 1 + 3 * LCD_SIM_WIDTH, RAW_SIZE = ROW_SIZE * LCD_SIM_HEIGHT };
+    /* Stored (uncompressed) deflate blocks: up to 65535 bytes each, 5 bytes of header */
+    enum { BLOCK_MAX = 65535, BLOCKS = (RAW_SIZE + BLOCK_MAX - 1) / BLOCK_MAX };
+    static uint8_t raw[RAW_SIZE];
+    static uint8_t zlib[2 + RAW_SIZE + 5 * BLOCKS + 4];
+
+    for (uint32_t y = 0; y < LCD_SIM_HEIGHT; ++y) {
+        uint8_t *row = &raw[y * ROW_SIZE];
+        row[0] = 0;
+        for (uint32_t x = 0; x < LCD_SIM_WIDTH; ++x) {
+            to_rgb888(g_framebuffer[y * LCD_SIM_WIDTH + x], &row[1 + 3 * x]);
+        }
+    }
+
+    size_t out = 0;
+    zlib[out++] = 0x78;  /* deflate, 32 KB window */
+    zlib[out++] = 0x01;  /* no preset dictionary, fastest; (0x7801 % 31) == 0 */
+
+    uint32_t adler_a = 1, adler_b = 0;
+    for (size_t done = 0; done < RAW_SIZE;) {
+        size_t len = RAW_SIZE - done;
+        if (len > BLOCK_MAX) {
+            len = BLOCK_MAX;
+        }
+
+        zlib[out++] = (done + len == RAW_SIZE) ? 1 : 0;  /* BFINAL, BTYPE = stored */
+        zlib[out++] = (uint8_t)len;
+        zlib[out++] = (uint8_t)(len >> 8);
+        zlib[out++] = (uint8_t)~len;
+        zlib[out++] = (uint8_t)(~len >> 8);
+        memcpy(&zlib[out], &raw[done], len);
+        out += len;
+
+        for (size_t i = 0; i < len; ++i) {
+            adler_a = (adler_a + raw[done + i]) % 65521U;
+            adler_b = (adler_b + adler_a) % 65521U;
+        }
+        done += len;
+    }
+    put_be32(&zlib[out], (adler_b << 16) | adler_a);
+    out += 4;
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        return -1;
+    }
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(signature, 1, sizeof(signature), f);
+
+    uint8_t header[13];
+    put_be32(&header[0], LCD_SIM_WIDTH);
+    put_be32(&header[4], LCD_SIM_HEIGHT);
+    header[8] = 8;    /* bit depth */
+    header[9] = 2;    /* truecolor */
+    header[10] = 0;   /* deflate */
+    header[11] = 0;   /* adaptive filtering */
+    header[12] = 0;   /* no interlace */
+    png_chunk(f, "IHDR", header, sizeof(header));
+    png_chunk(f, "IDAT", zlib, (uint32_t)out);
+    png_chunk(f, "IEND", NULL, 0);
+
+    return (fclose(f) == 0) ? 0 : -1;
+}
+
+long lcd_sim_compare_ppm(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) {
+        return -1;
+    }
+
+    unsigned width, height, max;
+    if (fscanf(f, "P6 %u %u %u", &width, &height, &max) != 3 || width != LCD_SIM_WIDTH ||
+            height != LCD_SIM_HEIGHT || max != 255 || fgetc(f) == EOF) {
+        fclose(f);
+        return -1;
+    }
+
+    long mismatches = 0;
+    for (size_t i = 0; i < LCD_SIM_WIDTH * LCD_SIM_HEIGHT; ++i) {
+        uint8_t golden[3], rgb[3];
+        if (fread(golden, 1, sizeof(golden), f) != sizeof(golden)) {
+            fclose(f);
+            return -1;
+        }
+        to_rgb888(g_framebuffer[i], rgb);
+        if (memcmp(golden, rgb, sizeof(rgb)) != 0) {
+            ++mismatches;
+        }
+    }
+
+    fclose(f);
+    return mismatches;
+}
+
+/* Same as ST7789H2_DrawBitmap: a 16 bpp BMP, rows stored bottom-up. */
+static int32_t draw_bitmap(uint32_t instance, uint32_t x, uint32_t y, uint8_t *bmp) {
+    (void)instance;
+    ++g_stats.calls;
+
+    const uint32_t size = (uint32_t)bmp[2] | ((uint32_t)bmp[3] << 8) | ((uint32_t)bmp[4] << 16) | ((uint32_t)bmp[5] << 24);
+    const uint32_t index = (uint32_t)bmp[10] | ((uint32_t)bmp[11] << 8) | ((uint32_t)bmp[12] << 16) | ((uint32_t)bmp[13] << 24);
+    const uint32_t width = (uint32_t)bmp[18] | ((uint32_t)bmp[19] << 8) | ((uint32_t)bmp[20] << 16) | ((uint32_t)bmp[21] << 24);
+    const uint32_t height = (uint32_t)bmp[22] | ((uint32_t)bmp[23] << 8) | ((uint32_t)bmp[24] << 16) | ((uint32_t)bmp[25] << 24);
+    const uint32_t pixels = (size - index) / 2U;
+
+    charge_window();
+    g_stats.commands += BITMAP_EXTRA_COMMANDS;
+    g_stats.data_writes += BITMAP_EXTRA_DATA;
+    ++g_stats.commands;
+    g_stats.data_writes += pixels;
+    g_stats.pixels += pixels;
+
+    if (!in_bounds(x, y, width, height)) {
+        ++g_stats.out_of_bounds;
+    }
+
+    const uint8_t *data = &bmp[index];
+    for (uint32_t i = 0; i < pixels && i < width * height; ++i) {
+        const uint32_t row = height - 1U - i / width;
+        plot(x + i % width, y + row, (uint16_t)(data[2 * i] | (data[2 * i + 1] << 8)));
+    }
+
+    return 0;
+}
+
+static int32_t fill_rgb_rect(uint32_t instance, uint32_t x, uint32_t y, uint8_t *data, uint32_t width, uint32_t height) {
+    (void)instance;
+    ++g_stats.calls;
+
+    if (width == 0U || height == 0U) {
+        return 0;
+    }
+
+    charge_gram_write(x, width, width * height);
+    if (!in_bounds(x, y, width, height)) {
+        ++g_stats.out_of_bounds;
+    }
+
+    for (uint32_t row = 0; row < height; ++row) {
+        for (uint32_t column = 0; column < width; ++column) {
+            const uint8_t *pixel = &data[2U * (row * width + column)];
+            plot(x + column, y + row, (uint16_t)(pixel[0] | (pixel[1] << 8)));
+        }
+    }
+
+    return 0;
+}
+
+static int32_t draw_hline(uint32_t instance, uint32_t x, uint32_t y, uint32_t length, uint32_t color) {
+    return fill_rect(instance, x, y, length, 1U, color);
+}
+
+static int32_t draw_vline(uint32_t instance, uint32_t x, uint32_t y, uint32_t length, uint32_t color) {
+    return fill_rect(instance, x, y, 1U, length, color);
+}
+
+static int32_t fill_rect(uint32_t instance, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t color) {
+    (void)instance;
+    ++g_stats.calls;
+
+    if (width == 0U || height == 0U) {
+        return 0;
+    }
+
+    charge_gram_write(x, width, width * height);
+    if (!in_bounds(x, y, width, height)) {
+        ++g_stats.out_of_bounds;
+    }
+
+    fill_window(x, y, width, height, (uint16_t)color);
+    return 0;
+}
+
+static int32_t get_pixel(uint32_t instance, uint32_t x, uint32_t y, uint32_t *color) {
+    (void)instance;
+    ++g_stats.calls;
+
+    charge_window();
+    ++g_stats.commands;
+    g_stats.data_reads += PIXEL_READS;
+
+    if (!in_bounds(x, y, 1U, 1U)) {
+        ++g_stats.out_of_bounds;
+        *color = 0;
+        return 0;
+    }
+
+    *color = g_framebuffer[y * LCD_SIM_WIDTH + x];
+    return 0;
+}
+
+static int32_t set_pixel(uint32_t instance, uint32_t x, uint32_t y, uint32_t color) {
+    (void)instance;
+    ++g_stats.calls;
+
+    charge_window();
+    ++g_stats.commands;
+    ++g_stats.data_writes;
+    ++g_stats.pixels;
+
+    if (!in_bounds(x, y, 1U, 1U)) {
+        ++g_stats.out_of_bounds;
+    }
+    plot(x, y, (uint16_t)color);
+    return 0;
+}
+
+static int32_t get_x_size(uint32_t instance, uint32_t *size) {
+    (void)instance;
+    *size = LCD_SIM_WIDTH;
+    return 0;
+}
+
+static int32_t get_y_size(uint32_t instance, uint32_t *size) {
+    (void)instance;
+    *size = LCD_SIM_HEIGHT;
+    return 0;
+}
+
+static int32_t set_layer(uint32_t instance, uint32_t layer) {
+    (void)instance;
+    (void)layer;
+    return 0;
+}
+
+static int32_t get_format(uint32_t instance, uint32_t *format) {
+    (void)instance;
+    *format = LCD_PIXEL_FORMAT_RGB565;
+    return 0;
+}
+
+static void charge_window(void) {
+    g_stats.commands += WINDOW_COMMANDS;
+    g_stats.data_writes += WINDOW_DATA;
+}
+
+/* A window, a WRITE_RAM burst, and the ST7789H2 last-column workaround: a window ending on the
+ * right edge has its last pixel written again through SetPixel. */
+static void charge_gram_write(uint32_t x, uint32_t width, uint32_t pixels) {
+    charge_window();
+    ++g_stats.commands;
+    g_stats.data_writes += pixels;
+    g_stats.pixels += pixels;
+
+    if (x + width == LCD_SIM_WIDTH) {
+        charge_window();
+        ++g_stats.commands;
+        ++g_stats.data_writes;
+        ++g_stats.pixels;
+    }
+}
+
+static int in_bounds(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    return x < LCD_SIM_WIDTH && y < LCD_SIM_HEIGHT &&
+           width <= LCD_SIM_WIDTH - x && height <= LCD_SIM_HEIGHT - y;
+}
+
+static void plot(uint32_t x, uint32_t y, uint16_t color) {
+    if (x < LCD_SIM_WIDTH && y < LCD_SIM_HEIGHT) {
+        g_framebuffer[y * LCD_SIM_WIDTH + x] = color;
+    }
+}
+
+static void fill_window(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint16_t color) {
+    for (uint32_t row = 0; row < height; ++row) {
+        for (uint32_t column = 0; column < width; ++column) {
+            plot(x + column, y + row, color);
+        }
+    }
+}
+
+/* Expands like the panel does: the top bits repeat into the low bits */
+static void to_rgb888(uint16_t pixel, uint8_t *rgb) {
+    const uint8_t r = (uint8_t)((pixel >> 11) & 0x1FU);
+    const uint8_t g = (uint8_t)((pixel >> 5) & 0x3FU);
+    const uint8_t b = (uint8_t)(pixel & 0x1FU);
+
+    rgb[0] = (uint8_t)((r << 3) | (r >> 2));
+    rgb[1] = (uint8_t)((g << 2) | (g >> 4));
+    rgb[2] = (uint8_t)((b << 3) | (b >> 2));
+}
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+        }
+    }
+    return crc;
+}
+
+static void png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len) {
+    uint8_t word[4];
+
+    put_be32(word, len);
+    fwrite(word, 1, sizeof(word), f);
+    fwrite(type, 1, 4, f);
+    if (len > 0) {
+        fwrite(data, 1, len, f);
+    }
+
+    uint32_t crc = crc32_update(0xFFFFFFFFU, (const uint8_t *)type, 4);
+    crc = crc32_update(crc, data, len);
+    put_be32(word, crc ^ 0xFFFFFFFFU);
+    fwrite(word, 1, sizeof(word), f);
+}
+
+static void put_be32(uint8_t *dst, uint32_t value) {
+    dst[0] = (uint8_t)(value >> 24);
+    dst[1] = (uint8_t)(value >> 16);
+    dst[2] = (uint8_t)(value >> 8);
+    dst[3] = (uint8_t)value;
+}
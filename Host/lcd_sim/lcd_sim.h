@@ -0,0 +1,76 @@
+/*
+ * lcd_sim.h
+ *
+ * A host (Linux) stand-in for the STM32L562E-DK LCD, so Utilities/lcd and the fonts can be run
+ * and measured without the board. Implements the LCD_UTILS_Drv_t table that UTIL_LCD draws
+ * through, writing into an in-memory 240x240 RGB565 framebuffer.
+ *
+ * Every call is also charged the FMC bus accesses the ST7789H2 driver would make for it (window
+ * and cursor commands, GRAM data, the last-column workaround, reads), so a rendering change can
+ * be compared by bus cost as well as by pixels. Snapshots can be written as PPM or PNG and
+ * compared against a golden PPM.
+ *
+ * Build (from the repository root), together with whatever draws through it:
+ *   cc -O2 -IHost/lcd_sim -IUtilities/lcd -IDrivers/BSP/Components/Common \
+ *      Host/lcd_sim/lcd_sim.c Host/lcd_sim/lcd_sim_main.c Utilities/lcd/stm32_lcd.c -o lcd_sim
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#ifndef LCD_SIM_H_
+#define LCD_SIM_H_
+
+#include "lcd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size of the visible screen in pixels. */
+#define LCD_SIM_WIDTH  240U
+#define LCD_SIM_HEIGHT 240U
+
+/* Emulated bus accesses since the last reset. Each access moves 16 bits over the FMC. */
+typedef struct {
+    uint32_t calls;          /* driver table calls */
+    uint32_t commands;       /* register (command) writes */
+    uint32_t data_writes;    /* parameter and GRAM writes */
+    uint32_t data_reads;     /* parameter and GRAM reads */
+    uint32_t transactions;   /* commands + data_writes + data_reads */
+    uint32_t bytes;          /* transactions * 2 */
+    uint32_t pixels;         /* pixels written to GRAM */
+    uint32_t out_of_bounds;  /* calls that reached outside the screen; those pixels are dropped */
+} lcd_sim_stats_t;
+
+/* The table to hand to UTIL_LCD_SetFuncDriver(). */
+extern const LCD_UTILS_Drv_t lcd_sim_driver;
+
+/* Fills the framebuffer with an RGB565 color and zeroes the counters. */
+void lcd_sim_reset(uint16_t color);
+
+/* Zeroes the counters only. */
+void lcd_sim_reset_stats(void);
+
+/* Copies out the counters. */
+void lcd_sim_get_stats(lcd_sim_stats_t *stats);
+
+/* The framebuffer, LCD_SIM_WIDTH * LCD_SIM_HEIGHT RGB565 pixels, row by row. */
+const uint16_t *lcd_sim_framebuffer(void);
+
+/* Writes the framebuffer as a binary (P6) PPM or an RGB PNG. Returns 0 on success. */
+int lcd_sim_write_ppm(const char *path);
+int lcd_sim_write_png(const char *path);
+
+/* Compares the framebuffer against a PPM written by lcd_sim_write_ppm(). Returns the number of
+ * differing pixels, or -1 if the file couldn't be read or is a different size. */
+long lcd_sim_compare_ppm(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LCD_SIM_H_ */
@@ -0,0 +1,142 @@
+/*
+ * lcd_sim_main.c
+ *
+ * Draws a fixed test screen through UTIL_LCD into the simulated LCD, reports the emulated bus
+ * cost of each step, and writes the result as <prefix>.ppm and <prefix>.png.
+ *
+ *   lcd_sim [-o prefix] [-g golden.ppm]
+ *
+ * With -g the screen is compared against a golden image (e.g. one written before a change), and
+ * the exit status is 1 if any pixel differs.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "lcd_sim.h"
+
+#include "stm32_lcd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void report(const char *step);
+static void draw_text(void);
+static void draw_shapes(void);
+
+int main(int argc, char **argv) {
+    const char *prefix = "lcd_sim";
+    const char *golden = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            prefix = argv[++i];
+        } else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+            golden = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [-o prefix] [-g golden.ppm]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    lcd_sim_reset(0);
+    UTIL_LCD_SetFuncDriver(&lcd_sim_driver);
+
+    printf("%-12s %8s %10s %10s %8s %10s\n", "step", "calls", "commands", "data", "reads", "bytes");
+
+    UTIL_LCD_Clear(UTIL_LCD_COLOR_BLACK);
+    report("clear");
+
+    draw_text();
+    draw_shapes();
+
+    char path[256];
+    snprintf(path, sizeof(path), "%s.ppm", prefix);
+    if (lcd_sim_write_ppm(path) != 0) {
+        fprintf(stderr, "couldn't write %s\n", path);
+        return 2;
+    }
+    snprintf(path, sizeof(path), "%s.png", prefix);
+    if (lcd_sim_write_png(path) != 0) {
+        fprintf(stderr, "couldn't write %s\n", path);
+        return 2;
+    }
+
+    if (golden != NULL) {
+        const long mismatches = lcd_sim_compare_ppm(golden);
+        if (mismatches < 0) {
+            fprintf(stderr, "couldn't read %s\n", golden);
+            return 2;
+        }
+        printf("%ld pixels differ from %s\n", mismatches, golden);
+        return (mismatches == 0) ? 0 : 1;
+    }
+
+    return 0;
+}
+
+/* Prints and resets the counters for one step */
+static void report(const char *step) {
+    lcd_sim_stats_t stats;
+    lcd_sim_get_stats(&stats);
+
+    printf("%-12s %8u %10u %10u %8u %10u\n", step, stats.calls, stats.commands,
+           stats.data_writes, stats.data_reads, stats.bytes);
+    if (stats.out_of_bounds != 0) {
+        printf("%-12s %u calls reached off screen\n", "", stats.out_of_bounds);
+    }
+
+    lcd_sim_reset_stats();
+}
+
+static void draw_text(void) {
+    static const char text[] = "The quick brown fox 0123";
+    sFONT *const fonts[] = { &Font8, &Font12, &Font16, &Font20, &Font24 };
+    uint32_t y = 0;
+
+    UTIL_LCD_SetTextColor(UTIL_LCD_COLOR_WHITE);
+    UTIL_LCD_SetBackColor(UTIL_LCD_COLOR_BLACK);
+
+    for (size_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); ++i) {
+        char step[16];
+
+        UTIL_LCD_SetFont(fonts[i]);
+        UTIL_LCD_DisplayStringAt(0, y, (uint8_t *)text, LEFT_MODE);
+        y += fonts[i]->Height;
+
+        snprintf(step, sizeof(step), "Font%u", (unsigned)fonts[i]->Height);
+        report(step);
+    }
+
+    UTIL_LCD_SetFont(&Font16);
+    UTIL_LCD_SetTextColor(UTIL_LCD_COLOR_YELLOW);
+    UTIL_LCD_SetBackColor(UTIL_LCD_COLOR_DARKBLUE);
+    UTIL_LCD_DisplayStringAt(0, y, (uint8_t *)"centered", CENTER_MODE);
+    UTIL_LCD_DisplayStringAt(0, y + Font16.Height, (uint8_t *)"right", RIGHT_MODE);
+    report("aligned");
+
+    /* Runs off the right edge */
+    UTIL_LCD_SetTextColor(UTIL_LCD_COLOR_BLACK);
+    UTIL_LCD_SetBackColor(UTIL_LCD_COLOR_LIGHTGRAY);
+    UTIL_LCD_DisplayStringAt(150, y + (2 * Font16.Height), (uint8_t *)text, LEFT_MODE);
+    report("clipped");
+}
+
+static void draw_shapes(void) {
+    const uint32_t top = 160;
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        UTIL_LCD_FillRect(i * 30, top, 28, 20, (i % 2) ? UTIL_LCD_COLOR_RED : UTIL_LCD_COLOR_GREEN);
+    }
+    report("rects");
+
+    UTIL_LCD_DrawHLine(0, top + 24, 240, UTIL_LCD_COLOR_WHITE);
+    UTIL_LCD_DrawVLine(239, top, 80, UTIL_LCD_COLOR_WHITE);
+    UTIL_LCD_DrawRect(4, top + 28, 60, 40, UTIL_LCD_COLOR_CYAN);
+    report("lines");
+
+    UTIL_LCD_DrawCircle(120, top + 48, 20, UTIL_LCD_COLOR_MAGENTA);
+    UTIL_LCD_FillCircle(190, top + 48, 20, UTIL_LCD_COLOR_ORANGE);
+    report("circles");
+}
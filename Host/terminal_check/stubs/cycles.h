@@ -0,0 +1,20 @@
+/*
+ * cycles.h
+ *
+ * Host stand-in for Util/cycles.h: there's no cycle counter, so time stands still.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace cycles {
+
+inline std::uint64_t now() { return 0; }
+
+inline std::uint64_t to_us(std::uint64_t count) { return count; }
+
+}  // namespace cycles
@@ -0,0 +1,14 @@
+/*
+ * logger.h
+ *
+ * Host stand-in for Util/logger.h: logs are printed straight away.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#pragma once
+
+#include <cstdio>
+
+#define LOG(...) std::printf(__VA_ARGS__)
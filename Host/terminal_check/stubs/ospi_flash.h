@@ -0,0 +1,18 @@
+/*
+ * ospi_flash.h
+ *
+ * Host stand-in for Util/ospi_flash.h: only what the scrollback's declaration needs.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace ospi_flash {
+
+inline constexpr std::uint32_t SECTOR_SIZE { 4096 };
+
+}  // namespace ospi_flash
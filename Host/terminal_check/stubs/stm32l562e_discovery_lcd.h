@@ -0,0 +1,18 @@
+/*
+ * stm32l562e_discovery_lcd.h
+ *
+ * Host stand-in for the BSP LCD header: just the hardware scroll the terminal uses, which
+ * terminal_check.cpp implements.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#define BSP_ERROR_NONE 0
+
+std::int32_t BSP_LCD_SetScrollArea(std::uint32_t Instance, std::uint32_t Ypos, std::uint32_t Height);
+std::int32_t BSP_LCD_SetScrollStart(std::uint32_t Instance, std::uint32_t Line);
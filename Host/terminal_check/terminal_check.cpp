@@ -0,0 +1,105 @@
+/*
+ * terminal_check.cpp
+ *
+ * Writes byte sequences to a terminal and compares the text on its top rows against what's
+ * expected; the exit status is 1 if any differ. Draws through Host/lcd_sim, with the BSP, cycle
+ * counter, logger and flash swapped for the stand-ins in stubs/. Build from the repository root
+ * with:
+ *
+ *   cc -c -IHost/lcd_sim -IUtilities/lcd -IDrivers/BSP/Components/Common \
+ *      Host/lcd_sim/lcd_sim.c Utilities/lcd/stm32_lcd.c
+ *   g++ -std=gnu++17 -IHost/terminal_check/stubs -IHost/lcd_sim -IUtilities/lcd \
+ *       -IDrivers/BSP/Components/Common -ICore/Display -IUtil Host/terminal_check/terminal_check.cpp \
+ *       Core/Display/{terminal,ansi_parser,unicode_font,unicode_fonts,packed_font}.cpp \
+ *       lcd_sim.o stm32_lcd.o -o terminal_check
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "lcd_sim.h"
+#include "scrollback.h"
+#include "stm32_lcd.h"
+#include "stm32l562e_discovery_lcd.h"
+#include "terminal.h"
+
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+
+static bool check(const char *name, const std::string &input, std::initializer_list<const char *> expected);
+static std::string row_text(const terminal &term, std::uint32_t row);
+
+/* The whole of the top row, leaving a wrap pending */
+static const std::string FULL_ROW(terminal::COLUMNS, 'a');
+
+int main() {
+    UTIL_LCD_SetFuncDriver(&lcd_sim_driver);
+
+    bool ok = true;
+
+    ok &= check("text", "ab", { "ab" });
+    ok &= check("wrap", FULL_ROW + "b", { FULL_ROW.c_str(), "b" });
+    ok &= check("backspace", "ab\bc", { "ac" });
+    ok &= check("backspace at the left", "\bab", { "ab" });
+
+    /* Like xterm, a backspace drops a pending wrap and then moves left from the last column */
+    ok &= check("backspace, wrap pending", FULL_ROW + "\bb",
+                { (FULL_ROW.substr(0, terminal::COLUMNS - 2) + "ba").c_str(), "" });
+
+    std::printf("%s\n", ok ? "all passed" : "FAILED");
+    return ok ? 0 : 1;
+}
+
+/* The terminal only ever passes the scrollback through; the host has no flash to keep it in */
+void scrollback::push(const terminal::Cell *cells) {
+    (void) cells;
+}
+
+std::int32_t BSP_LCD_SetScrollArea(std::uint32_t Instance, std::uint32_t Ypos, std::uint32_t Height) {
+    (void) Instance;
+    (void) Ypos;
+    (void) Height;
+    return BSP_ERROR_NONE;
+}
+
+std::int32_t BSP_LCD_SetScrollStart(std::uint32_t Instance, std::uint32_t Line) {
+    (void) Instance;
+    (void) Line;
+    return BSP_ERROR_NONE;
+}
+
+static bool check(const char *name, const std::string &input, std::initializer_list<const char *> expected) {
+    static terminal term {};
+    term.clear();
+    term.write(input.data(), input.size());
+
+    bool same = true;
+    std::uint32_t row = 0;
+    for (auto text : expected) {
+        same &= row_text(term, row++) == text;
+    }
+
+    if (same) {
+        return true;
+    }
+
+    std::printf("%s: got\n", name);
+    for (row = 0; row < expected.size(); ++row) {
+        std::printf("  \"%s\"\n", row_text(term, row).c_str());
+    }
+    return false;
+}
+
+/* A row's characters, without the blanks at the end */
+static std::string row_text(const terminal &term, std::uint32_t row) {
+    std::string text {};
+    const auto *cells = term.row(row);
+
+    for (std::uint32_t column = 0; column < terminal::COLUMNS; ++column) {
+        text += static_cast<char>(cells[column].ch);
+    }
+
+    text.erase(text.find_last_not_of(' ') + 1);
+    return text;
+}
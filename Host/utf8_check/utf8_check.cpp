@@ -0,0 +1,65 @@
+/*
+ * utf8_check.cpp
+ *
+ * Feeds byte sequences through utf8_decoder and compares the codepoints emitted against what's
+ * expected; the exit status is 1 if any differ. Build from the repository root with:
+ *
+ *   g++ -std=c++17 -IUtil Host/utf8_check/utf8_check.cpp -o utf8_check
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "utf8_decoder.h"
+
+#include <cstdio>
+#include <initializer_list>
+#include <vector>
+
+static constexpr char32_t FFFD { utf8_decoder::REPLACEMENT };
+
+static bool check(const char *name, std::initializer_list<std::uint8_t> bytes,
+                  std::initializer_list<char32_t> expected);
+
+int main() {
+    bool ok = true;
+
+    ok &= check("ascii", { 0x41, 0x7E }, { 0x41, 0x7E });
+    ok &= check("two bytes", { 0xC3, 0xA9 }, { 0xE9 });
+    ok &= check("three bytes", { 0xE2, 0x82, 0xAC }, { 0x20AC });
+    ok &= check("four bytes", { 0xF0, 0x9F, 0x98, 0x80 }, { 0x1F600 });
+    ok &= check("stray continuation", { 0x80, 0x41 }, { FFFD, 0x41 });
+    ok &= check("C0 and F5", { 0xC0, 0xF5 }, { FFFD, FFFD });
+    ok &= check("overlong E0", { 0xE0, 0x80, 0x80 }, { FFFD, FFFD, FFFD });
+    ok &= check("surrogate", { 0xED, 0xA0, 0x80 }, { FFFD, FFFD, FFFD });
+    ok &= check("above U+10FFFF", { 0xF4, 0x90, 0x80, 0x80 }, { FFFD, FFFD, FFFD, FFFD });
+    ok &= check("cut short", { 0xE2, 0x82, 0x41 }, { FFFD, 0x41 });
+
+    /* A narrowed range mustn't outlive a sequence cut short */
+    ok &= check("E0 cut short", { 0xE0, 0x41, 0xC3, 0x83 }, { FFFD, 0x41, 0xC3 });
+    ok &= check("F4 cut short", { 0xF4, 0xC3, 0xA9 }, { FFFD, 0xE9 });
+
+    std::printf("%s\n", ok ? "all passed" : "FAILED");
+    return ok ? 0 : 1;
+}
+
+static bool check(const char *name, std::initializer_list<std::uint8_t> bytes,
+                  std::initializer_list<char32_t> expected) {
+    utf8_decoder decoder {};
+    std::vector<char32_t> decoded {};
+
+    for (auto byte : bytes) {
+        decoder.feed(byte, [&decoded](char32_t c) { decoded.push_back(c); });
+    }
+
+    if (decoded == std::vector<char32_t> { expected }) {
+        return true;
+    }
+
+    std::printf("%s: got", name);
+    for (auto c : decoded) {
+        std::printf(" U+%04X", static_cast<unsigned>(c));
+    }
+    std::printf("\n");
+    return false;
+}
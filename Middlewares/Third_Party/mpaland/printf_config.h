@@ -8,9 +8,8 @@
 #ifndef THIRD_PARTY_MPALAND_PRINTF_CONFIG_H_
 #define THIRD_PARTY_MPALAND_PRINTF_CONFIG_H_
 
-/* I only need a little bit of the printf support, disable most of it */
-#define PRINTF_DISABLE_SUPPORT_FLOAT
+/* I only need a little bit of the printf support, disable most of it. The logger packs 64-bit and
+ * floating point arguments, so long long and %f are kept. */
 #define PRINTF_DISABLE_SUPPORT_EXPONENTIAL
-#define PRINTF_DISABLE_SUPPORT_LONG_LONG
 
 #endif /* THIRD_PARTY_MPALAND_PRINTF_CONFIG_H_ */
@@ -0,0 +1,29 @@
+/*
+ * cycles.cpp
+ *
+ * A 64-bit cycle counter built on the DWT cycle counter (CYCCNT). Used for timestamps and
+ * benchmarks. Hard-coded to work with STM32L5 HAL.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "cycles.h"
+
+namespace cycles {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void init() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+
+    DWT->CYCCNT = 0;
+    detail::g_high = 0;
+    detail::g_last = 0;
+
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+}  // namespace cycles
@@ -0,0 +1,74 @@
+/*
+ * cycles.h
+ *
+ * A 64-bit cycle counter built on the DWT cycle counter (CYCCNT). Used for timestamps and
+ * benchmarks. Hard-coded to work with STM32L5 HAL.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#pragma once
+
+#include "stm32l5xx_hal.h"
+
+#include <cstdint>
+
+namespace cycles {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/* Upper word of the counter and the last lower word seen, for catching wraps. */
+inline std::uint32_t g_high {};
+inline std::uint32_t g_last {};
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Enables and zeroes the DWT cycle counter. */
+void init();
+
+/**
+ * Gets the number of core cycles since init().
+ *
+ * CYCCNT wraps every 2^32 cycles (~39 s at 110 MHz); wraps are caught by comparing against the
+ * last read, so this has to be called at least once per wrap period. The log thread does.
+ *
+ * Safe to call from any context, including ISRs.
+ *
+ * @return the 64-bit cycle count.
+ */
+inline std::uint64_t now() {
+    const auto primask = __get_PRIMASK();
+    __disable_irq();
+
+    const std::uint32_t low = DWT->CYCCNT;
+    if (low < detail::g_last) {
+        ++detail::g_high;
+    }
+    detail::g_last = low;
+    const std::uint32_t high = detail::g_high;
+
+    __set_PRIMASK(primask);
+
+    return (static_cast<std::uint64_t>(high) << 32) | low;
+}
+
+/**
+ * Converts a cycle count to microseconds at the current core clock.
+ *
+ * @param count the number of cycles.
+ * @return      the number of whole microseconds.
+ */
+inline std::uint64_t to_us(std::uint64_t count) {
+    return count / (SystemCoreClock / 1000000U);
+}
+
+}  // namespace cycles
@@ -0,0 +1,314 @@
+/*
+ * log_store.cpp
+ *
+ * An append-only log store in the OSPI NOR flash (MX25LM51245G), so logs survive a lock-up or
+ * reset. Hard-coded to work with the STM32L562E-DK BSP.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "log_store.h"
+
+#include "stm32l5xx_hal.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace log_store {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Starts every sector in use. An erased (all 0xFF) header is never valid. */
+struct SectorHeader {
+    std::uint32_t magic;
+    std::uint32_t sequence;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static constexpr std::uint32_t INSTANCE { ospi_flash::INSTANCE };
+static constexpr std::uint32_t MAGIC { 0x53474F4C };  /* "LOGS" */
+static constexpr std::uint32_t PAGE_SIZE { MX25LM51245G_PAGE_SIZE };
+static constexpr std::uint32_t DATA_OFFSET { sizeof(SectorHeader) };
+static constexpr std::uint8_t ERASED { 0xFF };
+
+/* Whether init() succeeded; nothing touches the flash otherwise. */
+static bool g_ready { false };
+
+/* Head sector, its sequence number, and whether its header still has to be programmed. */
+static std::uint32_t g_sector {};
+static std::uint32_t g_sequence {};
+static bool g_header_pending { false };
+
+/* Flash address the first staged byte goes to. */
+static std::uint32_t g_write_address {};
+
+static std::uint8_t g_staging[STAGING_SIZE];
+static std::uint32_t g_staged {};
+static std::uint32_t g_staged_tick {};
+
+static std::uint32_t g_dropped {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private prototypes
+////////////////////////////////////////////////////////////////////////////////////////////////////
+static std::uint32_t sector_address(std::uint32_t sector);
+static bool read_header(std::uint32_t sector, SectorHeader &header);
+static bool flash_busy();
+static void start_sector(std::uint32_t sector, std::uint32_t sequence);
+static std::uint32_t find_write_offset(std::uint32_t sector);
+static bool program_staged(bool partial);
+static void dump_sector(std::uint32_t sector, void (*out)(const char *data, std::size_t size));
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool init() {
+    if (!ospi_flash::ready()) {
+        return false;
+    }
+
+    /* Only the sector headers are read to find the head: the valid one with the newest sequence */
+    bool found = false;
+    for (std::uint32_t sector = 0; sector < SECTOR_COUNT; ++sector) {
+        SectorHeader header;
+        if (!read_header(sector, header)) {
+            return false;
+        }
+        if (header.magic == MAGIC && (!found || header.sequence > g_sequence)) {
+            found = true;
+            g_sector = sector;
+            g_sequence = header.sequence;
+        }
+    }
+
+    if (!found) {
+        /* Fresh store */
+        if (BSP_OSPI_NOR_Erase_Block(INSTANCE, sector_address(0), BSP_OSPI_NOR_ERASE_4K) != BSP_ERROR_NONE) {
+            return false;
+        }
+        start_sector(0, 1);
+    } else {
+        const auto offset = find_write_offset(g_sector);
+        if (offset == 0) {
+            return false;
+        }
+        g_write_address = sector_address(g_sector) + offset;
+        g_header_pending = false;
+
+        /* The next sector should already be erased, but an erase may have been cut short */
+        const auto next = (g_sector + 1) % SECTOR_COUNT;
+        if (BSP_OSPI_NOR_Erase_Block(INSTANCE, sector_address(next), BSP_OSPI_NOR_ERASE_4K) != BSP_ERROR_NONE) {
+            return false;
+        }
+    }
+
+    g_staged = 0;
+    g_ready = true;
+
+    static constexpr char boot_marker[] = "--- boot ---\n";
+    append(boot_marker, sizeof(boot_marker) - 1);
+
+    return true;
+}
+
+void append(const char *data, std::size_t size) {
+    if (!g_ready) {
+        return;
+    }
+
+    ospi_flash::lock lock {};
+
+    while (size > 0) {
+        if (g_staged == STAGING_SIZE && !program_staged(false)) {
+            g_dropped += size;
+            return;
+        }
+
+        if (g_staged == 0) {
+            g_staged_tick = HAL_GetTick();
+        }
+
+        const auto count = std::min<std::size_t>(size, STAGING_SIZE - g_staged);
+        for (std::size_t i = 0; i < count; ++i) {
+            /* 0xFF marks erased flash when recovering the head, so it can't be stored */
+            const auto c = static_cast<std::uint8_t>(data[i]);
+            g_staging[g_staged + i] = (c == ERASED) ? '?' : c;
+        }
+        g_staged += count;
+        data += count;
+        size -= count;
+    }
+
+    /* Program whole pages as they fill up */
+    while (program_staged(false)) {
+        /* Keep going */
+    }
+}
+
+void poll() {
+    if (!g_ready || g_staged == 0) {
+        return;
+    }
+
+    ospi_flash::lock lock {};
+
+    const bool partial = (HAL_GetTick() - g_staged_tick) >= FLUSH_DELAY_MS;
+    while (program_staged(partial)) {
+        /* Keep going */
+    }
+}
+
+void dump(void (*out)(const char *data, std::size_t size)) {
+    if (!g_ready) {
+        return;
+    }
+
+    /* The sector after the head is the oldest, if it's been used yet */
+    for (std::uint32_t i = 1; i <= SECTOR_COUNT; ++i) {
+        dump_sector((g_sector + i) % SECTOR_COUNT, out);
+    }
+
+    if (g_staged > 0) {
+        out(reinterpret_cast<const char *>(g_staging), g_staged);
+    }
+}
+
+std::uint32_t dropped() {
+    return g_dropped;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::uint32_t sector_address(std::uint32_t sector) {
+    return BASE_ADDRESS + sector * SECTOR_SIZE;
+}
+
+static bool read_header(std::uint32_t sector, SectorHeader &header) {
+    return BSP_OSPI_NOR_Read(INSTANCE, reinterpret_cast<std::uint8_t *>(&header),
+                             sector_address(sector), sizeof(header)) == BSP_ERROR_NONE;
+}
+
+static bool flash_busy() {
+    return ospi_flash::busy();
+}
+
+/* Makes an (erased) sector the head. Its header is programmed along with the first text. */
+static void start_sector(std::uint32_t sector, std::uint32_t sequence) {
+    g_sector = sector;
+    g_sequence = sequence;
+    g_header_pending = true;
+    g_write_address = sector_address(sector) + DATA_OFFSET;
+}
+
+/* Stored text never contains 0xFF, so the first erased byte of the data area is the head.
+ * Binary search for it rather than scanning. Returns 0 on a read failure. */
+static std::uint32_t find_write_offset(std::uint32_t sector) {
+    std::uint32_t low = DATA_OFFSET;
+    std::uint32_t high = SECTOR_SIZE;
+
+    while (low < high) {
+        const auto mid = low + (high - low) / 2;
+        std::uint8_t byte;
+        if (BSP_OSPI_NOR_Read(INSTANCE, &byte, sector_address(sector) + mid, 1) != BSP_ERROR_NONE) {
+            return 0;
+        }
+
+        if (byte == ERASED) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+
+    return low;
+}
+
+/* Programs staged text up to the next page boundary. Unless partial is set, only whole pages are
+ * programmed. Returns whether anything was programmed; never waits on a busy flash. */
+static bool program_staged(bool partial) {
+    if (g_staged == 0) {
+        return false;
+    }
+
+    /* A full head sector moves on to the pre-erased next one */
+    if (g_write_address == sector_address(g_sector) + SECTOR_SIZE) {
+        start_sector((g_sector + 1) % SECTOR_COUNT, g_sequence + 1);
+    }
+
+    const auto page_space = PAGE_SIZE - (g_write_address % PAGE_SIZE);
+    const auto count = std::min(g_staged, page_space);
+    if (count < page_space && !partial) {
+        return false;
+    }
+
+    if (flash_busy()) {
+        return false;
+    }
+
+    if (g_header_pending) {
+        SectorHeader header { MAGIC, g_sequence };
+        if (BSP_OSPI_NOR_Write(INSTANCE, reinterpret_cast<std::uint8_t *>(&header),
+                               sector_address(g_sector), sizeof(header)) != BSP_ERROR_NONE) {
+            return false;
+        }
+        g_header_pending = false;
+
+        /* Keep the next sector erased ahead of time; this drops the oldest sector */
+        const auto next = (g_sector + 1) % SECTOR_COUNT;
+        BSP_OSPI_NOR_Erase_Block(INSTANCE, sector_address(next), BSP_OSPI_NOR_ERASE_4K);
+        return true;
+    }
+
+    if (BSP_OSPI_NOR_Write(INSTANCE, g_staging, g_write_address, count) != BSP_ERROR_NONE) {
+        return false;
+    }
+
+    g_write_address += count;
+    g_staged -= count;
+    std::memmove(g_staging, &g_staging[count], g_staged);
+    g_staged_tick = HAL_GetTick();
+
+    return true;
+}
+
+/* Takes the lock for each chunk rather than the whole dump, which waits on the UART */
+static void dump_sector(std::uint32_t sector, void (*out)(const char *data, std::size_t size)) {
+    SectorHeader header;
+    {
+        ospi_flash::lock lock {};
+        ospi_flash::wait();
+        if (!read_header(sector, header) || header.magic != MAGIC || header.sequence > g_sequence) {
+            return;
+        }
+    }
+
+    char chunk[64];
+    for (auto offset = DATA_OFFSET; offset < SECTOR_SIZE; offset += sizeof(chunk)) {
+        const auto size = std::min<std::uint32_t>(sizeof(chunk), SECTOR_SIZE - offset);
+        {
+            ospi_flash::lock lock {};
+            ospi_flash::wait();
+            if (BSP_OSPI_NOR_Read(INSTANCE, reinterpret_cast<std::uint8_t *>(chunk),
+                                  sector_address(sector) + offset, size) != BSP_ERROR_NONE) {
+                return;
+            }
+        }
+
+        const auto *end = static_cast<const char *>(std::memchr(chunk, static_cast<char>(ERASED), size));
+        out(chunk, (end != nullptr) ? static_cast<std::size_t>(end - chunk) : size);
+        if (end != nullptr) {
+            return;
+        }
+    }
+}
+
+}  // namespace log_store
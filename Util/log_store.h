@@ -0,0 +1,80 @@
+/*
+ * log_store.h
+ *
+ * An append-only log store in the OSPI NOR flash (MX25LM51245G), so logs survive a lock-up or
+ * reset. Hard-coded to work with the STM32L562E-DK BSP.
+ *
+ * The store is a ring of 4 KB sectors at the top of the flash. Each sector starts with a header
+ * holding a sequence number, followed by log text. Text is staged in RAM and programmed in
+ * page-sized batches; the sector after the head is always kept erased ahead of time.
+ *
+ * Only the log thread writes to the store, so none of this is thread safe. The flash itself is
+ * shared with the terminal scrollback, through ospi_flash's lock.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#pragma once
+
+#include "ospi_flash.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace log_store {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Size of a store sector; the smallest erasable block. */
+inline constexpr std::uint32_t SECTOR_SIZE { ospi_flash::SECTOR_SIZE };
+
+/** Number of sectors in the store ring. */
+inline constexpr std::uint32_t SECTOR_COUNT { 64 };
+
+/** Flash address of the first sector. The store takes the top of the flash. */
+inline constexpr std::uint32_t BASE_ADDRESS { MX25LM51245G_FLASH_SIZE - SECTOR_COUNT * SECTOR_SIZE };
+
+/** Size of the RAM staging buffer. Absorbs logs while the flash is busy erasing. */
+inline constexpr std::uint32_t STAGING_SIZE { 2 * MX25LM51245G_PAGE_SIZE };
+
+/** How long a partial page may sit in RAM before it's programmed anyways. */
+inline constexpr std::uint32_t FLUSH_DELAY_MS { 100 };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Recovers the write head from the sector headers, without scanning the stored logs. Call after
+ * ospi_flash::init().
+ *
+ * @return true on success, false if the flash couldn't be used.
+ */
+bool init();
+
+/**
+ * Appends log text to the store. Full pages are programmed right away if the flash is free.
+ * Never waits on the flash; if the staging buffer is full, the text is dropped and counted.
+ *
+ * @param[in] data the text to append.
+ * @param     size the number of bytes of text.
+ */
+void append(const char *data, std::size_t size);
+
+/** Programs staged text that's waited long enough. Call periodically from the log thread. */
+void poll();
+
+/**
+ * Writes out the whole store, oldest first, followed by anything still staged.
+ *
+ * @param out called with each chunk of stored text.
+ */
+void dump(void (*out)(const char *data, std::size_t size));
+
+/** Number of bytes dropped because the staging buffer was full. */
+std::uint32_t dropped();
+
+}  // namespace log_store
@@ -8,11 +8,13 @@
  */
 
 #include "logger.h"
+#include "log_store.h"
+#include "uart_retarget.h"
 
-#include <etl/queue_mpmc_mutex.h>
 #include <mpaland/printf.h>
 
-#include <cctype>
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 
@@ -22,53 +24,76 @@ namespace logger {
 // Private data
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-/* Multi-producer multi-consumer queue. */
-etl::queue_mpmc_mutex<LogData, QUEUE_SIZE> g_log_queue;
+static_assert((QUEUE_SIZE & (QUEUE_SIZE - 1)) == 0, "QUEUE_SIZE must be a power of 2");
 
-/* UART instance to write logs over. */
-static UART_HandleTypeDef *g_uart;
+/* Byte ring of variable-size records. Head and tail are free-running and masked on access.
+ * Producers are serialized by masking interrupts, so ISRs can log too; there's one consumer. */
+static std::uint8_t g_log_queue[QUEUE_SIZE];
+static std::atomic<std::uint32_t> g_head { 0 };
+static std::atomic<std::uint32_t> g_tail { 0 };
 
-/* Whether or not the log thread has started; if it hasn't, it doesn't make sense to
- * defer since the queue uses a FreeRTOS mutex which won't do anything. */
+/* Logs dropped because the queue was full and the caller couldn't wait. */
+static std::atomic<std::uint32_t> g_dropped { 0 };
+
+/* Set when the log thread should dump the flash log store. */
+static std::atomic<bool> g_dump_requested { false };
+
+/* Whether or not the log thread has started; if it hasn't, nothing would drain the queue
+ * so logs are formatted and sent immediately instead. */
 static bool g_thread_started { false };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Private prototypes
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+static bool try_push(const std::uint8_t *record, std::size_t size);
+static void ring_read(std::uint32_t pos, void *dst, std::size_t size);
 static void out_buffer(char character, void* arg);
-static void log_now(const LogData &log_data);
+static void out_uart(const char *data, std::size_t size);
+static void format_arg(const Conversion &conv, ArgType type, const std::uint8_t *arg);
+static void log_now(const LogData &header, const std::uint8_t *args);
+static void log_direct(const char *fmt, unsigned long value);
+static void flush_buffer();
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Public implementations
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void init(UART_HandleTypeDef *uart) {
-    g_uart = uart;
-}
-
-void log(const LogData &data) {
+void log(const std::uint8_t *record, std::size_t size) {
     if (!g_thread_started) {
-        log_now(data);
-    } else {
-        while (!g_log_queue.push(data)) {
-            /* Retry */
+        LogData header;
+        std::memcpy(&header, record, sizeof(header));
+        log_now(header, record + sizeof(header));
+        return;
+    }
+
+    while (!try_push(record, size)) {
+        /* Can't wait for the log thread from an ISR or with interrupts masked, drop it instead */
+        if (__get_IPSR() != 0 || __get_PRIMASK() != 0) {
+            g_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
         }
+        /* Retry */
     }
 }
 
 void process_logs() {
-    auto size = g_log_queue.size();
+    auto tail = g_tail.load(std::memory_order_relaxed);
 
-    if (size == 0) {
-        return;
+    while (tail != g_head.load(std::memory_order_acquire)) {
+        LogData header;
+        std::uint8_t args[MAX_ARGUMENTS_SIZE];
+
+        ring_read(tail, &header, sizeof(header));
+        ring_read(tail + sizeof(header), args, header.site->args_size);
+        tail += sizeof(header) + header.site->args_size;
+
+        /* Free the space before the (slow) UART send so producers aren't held up */
+        g_tail.store(tail, std::memory_order_release);
+        log_now(header, args);
     }
 
-    for (typeof(size) i = 0; i < size; ++i) {
-        LogData log_data;
-        while (!g_log_queue.pop(log_data)) {
-            /* Retry */
-        }
-        log_now(log_data);
+    if (auto dropped = g_dropped.exchange(0, std::memory_order_relaxed); dropped != 0) {
+        log_direct("logger: dropped %lu logs\n", dropped);
     }
 }
 
@@ -79,13 +104,60 @@ void thread(void *arg) {
     g_thread_started = true;
 
     while (true) {
+        /* Also keeps the cycle counter from missing a wrap when logs are sparse */
+        cycles::now();
         process_logs();
+        log_store::poll();
+
+        if (g_dump_requested.exchange(false)) {
+            log_store::dump(out_uart);
+            log_direct("log_store: %lu bytes dropped\n", log_store::dropped());
+        }
     }
 }
 
+void dump_store() {
+    g_dump_requested = true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Private implementations
 ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool try_push(const std::uint8_t *record, std::size_t size) {
+    bool pushed = false;
+
+    const auto primask = __get_PRIMASK();
+    __disable_irq();
+
+    const auto head = g_head.load(std::memory_order_relaxed);
+    const auto tail = g_tail.load(std::memory_order_acquire);
+
+    if (QUEUE_SIZE - (head - tail) >= size) {
+        const auto offset = head & (QUEUE_SIZE - 1);
+        const auto first = std::min<std::size_t>(size, QUEUE_SIZE - offset);
+
+        std::memcpy(&g_log_queue[offset], record, first);
+        std::memcpy(&g_log_queue[0], record + first, size - first);
+
+        g_head.store(head + size, std::memory_order_release);
+        pushed = true;
+    }
+
+    __set_PRIMASK(primask);
+
+    return pushed;
+}
+
+static void ring_read(std::uint32_t pos, void *dst, std::size_t size) {
+    const auto offset = pos & (QUEUE_SIZE - 1);
+    const auto first = std::min<std::size_t>(size, QUEUE_SIZE - offset);
+    auto *out = static_cast<std::uint8_t *>(dst);
+
+    std::memcpy(out, &g_log_queue[offset], first);
+    std::memcpy(out + first, &g_log_queue[0], size - first);
+}
+
 /* Logging is done in one thread, so using these statics here is safe. */
 static char g_buffer[FORMAT_BUFFER_SIZE] {};
 static size_t g_buffer_i {};
@@ -93,20 +165,93 @@ static size_t g_buffer_i {};
 static void out_buffer(char character, void* arg) {
     (void) arg;
 
-    g_buffer[g_buffer_i] = character;
-    ++g_buffer_i;
+    if (g_buffer_i < sizeof(g_buffer)) {
+        g_buffer[g_buffer_i] = character;
+        ++g_buffer_i;
+    }
 }
 
-static void log_now(const LogData &log_data) {
-    /* Format the log into the global buffer. Passing all the args should be fine even if they're
-     * not all used; the rest will just take up some stack space for a second. */
-    fctprintf(out_buffer, nullptr, log_data.fmt,
-            log_data.arguments[0], log_data.arguments[1], log_data.arguments[2],
-            log_data.arguments[3], log_data.arguments[4], log_data.arguments[5]);
+template <typename T>
+static T read_arg(const std::uint8_t *arg) {
+    T value;
+    std::memcpy(&value, arg, sizeof(value));
+    return value;
+}
+
+static void format_arg(const Conversion &conv, ArgType type, const std::uint8_t *arg) {
+    /* Format one conversion at a time so each argument is passed with its real (promoted) type */
+    char spec[16];
+    const auto spec_len = std::min<std::size_t>(conv.end - conv.start, sizeof(spec) - 1);
+    std::memcpy(spec, conv.start, spec_len);
+    spec[spec_len] = '\0';
 
-    /* Send the formatted string out over UART */
-    HAL_UART_Transmit(g_uart, (uint8_t *) g_buffer, (uint16_t) g_buffer_i, HAL_MAX_DELAY);
+    switch (type) {
+        case ArgType::INT8:    fctprintf(out_buffer, nullptr, spec, read_arg<std::int8_t>(arg)); break;
+        case ArgType::UINT8:   fctprintf(out_buffer, nullptr, spec, read_arg<std::uint8_t>(arg)); break;
+        case ArgType::INT16:   fctprintf(out_buffer, nullptr, spec, read_arg<std::int16_t>(arg)); break;
+        case ArgType::UINT16:  fctprintf(out_buffer, nullptr, spec, read_arg<std::uint16_t>(arg)); break;
+        case ArgType::INT32:   fctprintf(out_buffer, nullptr, spec, read_arg<std::int32_t>(arg)); break;
+        case ArgType::UINT32:  fctprintf(out_buffer, nullptr, spec, read_arg<std::uint32_t>(arg)); break;
+        case ArgType::INT64:   fctprintf(out_buffer, nullptr, spec, read_arg<std::int64_t>(arg)); break;
+        case ArgType::UINT64:  fctprintf(out_buffer, nullptr, spec, read_arg<std::uint64_t>(arg)); break;
+        case ArgType::FLOAT:   fctprintf(out_buffer, nullptr, spec, static_cast<double>(read_arg<float>(arg))); break;
+        case ArgType::DOUBLE:  fctprintf(out_buffer, nullptr, spec, read_arg<double>(arg)); break;
+        case ArgType::STRING:  fctprintf(out_buffer, nullptr, spec, read_arg<const char *>(arg)); break;
+        case ArgType::POINTER: fctprintf(out_buffer, nullptr, spec, read_arg<const void *>(arg)); break;
+    }
+}
+
+static void log_now(const LogData &header, const std::uint8_t *args) {
+    const auto &site = *header.site;
+    const char *fmt = site.fmt;
+
+    fctprintf(out_buffer, nullptr, "[%10llu] ",
+            static_cast<unsigned long long>(cycles::to_us(header.timestamp)));
+
+    /* Walk the format; literals are copied out, conversions are formatted from the packed args */
+    for (std::uint8_t i = 0; i < site.arg_count; ++i) {
+        const auto conv = next_conversion(fmt);
+
+        for (; fmt != conv.start; ++fmt) {
+            out_buffer(*fmt, nullptr);
+            if (fmt[0] == '%' && fmt[1] == '%') {
+                ++fmt;
+            }
+        }
+
+        format_arg(conv, site.types[i], args);
+        args += arg_size(site.types[i]);
+        fmt = conv.end;
+    }
+
+    for (; *fmt != '\0'; ++fmt) {
+        out_buffer(*fmt, nullptr);
+        if (fmt[0] == '%' && fmt[1] == '%') {
+            ++fmt;
+        }
+    }
+
+    flush_buffer();
+}
+
+/* The log thread's own messages. It's the queue's only consumer, so it can't push to it and wait
+ * for room; these are formatted and sent straight away instead. */
+static void log_direct(const char *fmt, unsigned long value) {
+    fctprintf(out_buffer, nullptr, "[%10llu] ", static_cast<unsigned long long>(cycles::to_us(cycles::now())));
+    fctprintf(out_buffer, nullptr, fmt, value);
+    flush_buffer();
+}
+
+static void flush_buffer() {
+    /* Keep a copy in flash, then send the formatted string out over UART */
+    log_store::append(g_buffer, g_buffer_i);
+    out_uart(g_buffer, g_buffer_i);
     g_buffer_i = 0;
 }
 
+static void out_uart(const char *data, std::size_t size) {
+    /* Shares the console's TX ring so logs and printf don't fight over the UART */
+    uart_retarget_write(data, size);
+}
+
 }  // namespace logger
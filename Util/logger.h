@@ -1,8 +1,14 @@
 /*
  * logger.h
  *
- * A minimal deferred logging utility. Hard-coded to work with STM32L5 HAL and FreeRTOS.
- * TODO: just grab some existing format code from somewhere...
+ * A minimal deferred logging utility. Hard-coded to work with STM32L5 HAL and FreeRTOS. Logs go
+ * out over the console UART set up by uart_retarget.
+ *
+ * Logs are made with the LOG() macro. The format string is parsed at compile time and checked
+ * against the argument types, then each argument is packed at its natural width into a
+ * variable-size record along with a cycle counter timestamp. Formatting happens later, in the log
+ * thread, where the timestamp is rendered as microseconds since boot. Formatted logs are also
+ * kept in the flash log store (see log_store.h) once it's been initialized.
  *
  *  Created on: Jan 5, 2021
  *      Author: cmklu
@@ -12,7 +18,11 @@
 
 #include "stm32l5xx_hal.h"
 
+#include "cycles.h"
+
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 namespace logger {
 
@@ -20,11 +30,11 @@ namespace logger {
 // Constants
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-/** Number of logs that can be queued in the deferred logging queue. */
-inline constexpr std::uint32_t QUEUE_SIZE { 16 };
+/** Size in bytes of the deferred logging queue. Records are variable size, see LogData. */
+inline constexpr std::uint32_t QUEUE_SIZE { 256 };
 
-/** Max number of arguments that can be logged. */
-inline constexpr std::uint32_t MAX_ARGUMENTS { 6 };
+/** Max number of bytes of packed arguments a single log can carry. */
+inline constexpr std::uint32_t MAX_ARGUMENTS_SIZE { 32 };
 
 /** Size of the buffer to format into. Logs that end up longer than this are truncated. */
 inline constexpr std::uint32_t FORMAT_BUFFER_SIZE { 128 };
@@ -32,42 +42,307 @@ inline constexpr std::uint32_t FORMAT_BUFFER_SIZE { 128 };
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Types
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-struct LogData {
+
+/** How an argument is stored in a log record. */
+enum class ArgType : std::uint8_t {
+    INT8,
+    UINT8,
+    INT16,
+    UINT16,
+    INT32,
+    UINT32,
+    INT64,
+    UINT64,
+    FLOAT,
+    DOUBLE,
+    STRING,
+    POINTER,
+};
+
+/** Static description of a single LOG() call site. One is generated per call site. */
+struct LogSite {
     const char *fmt;
-    std::uint32_t arguments[MAX_ARGUMENTS];
+    const ArgType *types;
+    std::uint8_t arg_count;
+    std::uint8_t args_size;
+};
+
+/**
+ * Header of a queued log record. Followed by LogSite::args_size bytes of packed arguments.
+ * Packed since records are only ever copied in and out of the queue byte-wise.
+ */
+struct __attribute__((packed)) LogData {
+    const LogSite *site;
+    std::uint64_t timestamp;  /* cycles::now() when the log was made */
+};
+
+/** A format conversion (e.g. "%02X") found while walking a format string. */
+struct Conversion {
+    const char *start;
+    const char *end;
+    char specifier;
+    char length;  /* 0, 'h', 'H' (hh), 'l', 'L' (ll), 'j', 'z' or 't' */
+    bool valid;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-/** Initializes the logger to run over a UART instance. */
-void init(UART_HandleTypeDef *uart);
-
 /**
- * Queues the given log data for logging
+ * Queues an already packed log record (a LogData header followed by its arguments).
+ *
+ * @param[in] record the record to queue.
+ * @param     size   the total size of the record in bytes.
  */
-void log(const LogData &data);
+void log(const std::uint8_t *record, std::size_t size);
+
+/** Process queued logs. Call from a relatively low priority thread. */
+void process_logs();
+
+/** An RTOS thread for pushing queued logs. */
+void thread(void *arg);
+
+/** Asks the log thread to write out the contents of the flash log store. */
+void dump_store();
 
 /**
- * Queues data to be logged.
+ * Finds the next conversion in a format string. Literal "%%" is not treated as a conversion.
  *
- * @param fmt  The string format to be logged. Must not be a pointer to a stack array. Supports
- *             base character, integer, and string formats (%c/%d/%x/%s), no modifiers.
- * @param args The arguments for the string format. Will be internally stored as a uint32_t.
+ * @param[in] fmt the format string to search from.
+ * @return        the conversion found; start is nullptr if there are no more.
  */
+constexpr Conversion next_conversion(const char *fmt) {
+    Conversion conv { nullptr, nullptr, 0, 0, true };
+
+    while (*fmt != '\0') {
+        if (*fmt != '%') {
+            ++fmt;
+            continue;
+        }
+
+        if (fmt[1] == '%') {
+            fmt += 2;
+            continue;
+        }
+
+        conv.start = fmt++;
+
+        /* Flags, width and precision. '*' would consume an argument, so it isn't supported. */
+        while (*fmt == '-' || *fmt == '+' || *fmt == ' ' || *fmt == '#' || *fmt == '0') {
+            ++fmt;
+        }
+        while (*fmt >= '0' && *fmt <= '9') {
+            ++fmt;
+        }
+        if (*fmt == '.') {
+            ++fmt;
+            while (*fmt >= '0' && *fmt <= '9') {
+                ++fmt;
+            }
+        }
+
+        /* Length */
+        if (*fmt == 'h' || *fmt == 'l') {
+            conv.length = *fmt++;
+            if (*fmt == conv.length) {
+                conv.length = (conv.length == 'h') ? 'H' : 'L';
+                ++fmt;
+            }
+        } else if (*fmt == 'j' || *fmt == 'z' || *fmt == 't') {
+            conv.length = *fmt++;
+        }
+
+        conv.specifier = *fmt;
+        switch (conv.specifier) {
+            case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'b':
+            case 'c': case 's': case 'p': case 'f': case 'F':
+                ++fmt;
+                break;
+            default:
+                conv.valid = false;
+                break;
+        }
+
+        conv.end = fmt;
+        return conv;
+    }
+
+    return conv;
+}
+
+/** Whether a conversion's length modifier asks for a 64-bit argument. */
+constexpr bool wants_64bit(const Conversion &conv) {
+    switch (conv.length) {
+        case 'L': return true;
+        case 'j': return sizeof(std::intmax_t) == 8;
+        case 'l': return sizeof(long) == 8;
+        case 'z': return sizeof(std::size_t) == 8;
+        case 't': return sizeof(std::ptrdiff_t) == 8;
+        default:  return false;
+    }
+}
+
+/** Number of bytes an argument of the given type takes in a record. */
+constexpr std::uint8_t arg_size(ArgType type) {
+    switch (type) {
+        case ArgType::INT8:   case ArgType::UINT8:  return 1;
+        case ArgType::INT16:  case ArgType::UINT16: return 2;
+        case ArgType::INT32:  case ArgType::UINT32: return 4;
+        case ArgType::INT64:  case ArgType::UINT64: return 8;
+        case ArgType::FLOAT:                        return sizeof(float);
+        case ArgType::DOUBLE:                       return sizeof(double);
+        case ArgType::STRING: case ArgType::POINTER:
+        default:                                    return sizeof(void *);
+    }
+}
+
+/** Whether an argument of the given type can be printed with the given conversion. */
+constexpr bool arg_matches(const Conversion &conv, ArgType type) {
+    const bool is_integer = type <= ArgType::UINT64;
+    const bool is_64bit = (type == ArgType::INT64) || (type == ArgType::UINT64);
+
+    switch (conv.specifier) {
+        case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'b':
+            return is_integer && (is_64bit == wants_64bit(conv));
+        case 'c':
+            return is_integer && !is_64bit && conv.length == 0;
+        case 's':
+            return type == ArgType::STRING;
+        case 'p':
+            return type == ArgType::STRING || type == ArgType::POINTER;
+        case 'f': case 'F':
+            return (type == ArgType::FLOAT || type == ArgType::DOUBLE) &&
+                   (conv.length == 0 || conv.length == 'l');
+        default:
+            return false;
+    }
+}
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool unsupported_type = false;
+
+/** Maps a C++ argument type to how it's stored in a record. */
+template <typename T>
+constexpr ArgType arg_type_of() {
+    using U = std::remove_cv_t<T>;
+
+    if constexpr (std::is_enum_v<U>) {
+        return arg_type_of<std::underlying_type_t<U>>();
+    } else if constexpr (std::is_same_v<U, bool>) {
+        return ArgType::UINT8;
+    } else if constexpr (std::is_integral_v<U>) {
+        if constexpr (sizeof(U) == 1) {
+            return std::is_signed_v<U> ? ArgType::INT8 : ArgType::UINT8;
+        } else if constexpr (sizeof(U) == 2) {
+            return std::is_signed_v<U> ? ArgType::INT16 : ArgType::UINT16;
+        } else if constexpr (sizeof(U) == 4) {
+            return std::is_signed_v<U> ? ArgType::INT32 : ArgType::UINT32;
+        } else {
+            static_assert(sizeof(U) == 8, "Unsupported integer width for logger");
+            return std::is_signed_v<U> ? ArgType::INT64 : ArgType::UINT64;
+        }
+    } else if constexpr (std::is_same_v<U, float>) {
+        return ArgType::FLOAT;
+    } else if constexpr (std::is_same_v<U, double>) {
+        return ArgType::DOUBLE;
+    } else if constexpr (std::is_pointer_v<U>) {
+        return std::is_same_v<std::remove_cv_t<std::remove_pointer_t<U>>, char> ?
+                ArgType::STRING : ArgType::POINTER;
+    } else {
+        static_assert(unsupported_type<T>, "Unsupported argument type for logger");
+        return ArgType::POINTER;
+    }
+}
+
+/** Argument types of a call site. Has a trailing entry so it's never zero-sized. */
+template <typename ... Args>
+inline constexpr ArgType arg_types[sizeof...(Args) + 1] = { arg_type_of<Args>()..., ArgType::UINT8 };
+
 template <typename ... Args>
-void log(const char *fmt, Args ... args) {
-    auto constexpr arg_cnt = sizeof...(args);
-    static_assert(arg_cnt <= MAX_ARGUMENTS, "Too many arguments to logger!");
+inline constexpr std::uint32_t args_size = (0U + ... + arg_size(arg_type_of<Args>()));
 
-    log(LogData{ fmt, ((std::uint32_t) args)... });
+/** Whether the format string is well formed and has as many conversions as arguments. */
+template <typename ... Args>
+constexpr bool format_matches_count(const char *fmt) {
+    std::size_t count = 0;
+    for (auto conv = next_conversion(fmt); conv.start != nullptr; conv = next_conversion(conv.end)) {
+        if (!conv.valid) {
+            return false;
+        }
+        ++count;
+    }
+    return count == sizeof...(Args);
 }
 
-/** Process queued logs. Call from a relatively low priority thread. */
-void process_logs();
+/** Whether every argument can be printed with its matching conversion. */
+template <typename ... Args>
+constexpr bool format_matches_types(const char *fmt) {
+    std::size_t i = 0;
+    for (auto conv = next_conversion(fmt); conv.start != nullptr; conv = next_conversion(conv.end)) {
+        if (!conv.valid || i >= sizeof...(Args) || !arg_matches(conv, arg_types<Args...>[i])) {
+            return false;
+        }
+        ++i;
+    }
+    return true;
+}
 
-/** An RTOS thread for pushing queued logs. */
-void thread(void *arg);
+/** Copies an argument into a record at its natural width. */
+template <typename T>
+inline void pack(std::uint8_t *&dst, T value) {
+    using U = std::remove_cv_t<T>;
+
+    if constexpr (std::is_enum_v<U>) {
+        pack(dst, static_cast<std::underlying_type_t<U>>(value));
+    } else if constexpr (std::is_same_v<U, bool>) {
+        pack(dst, static_cast<std::uint8_t>(value));
+    } else {
+        std::memcpy(dst, &value, sizeof(value));
+        dst += sizeof(value);
+    }
+}
+
+template <typename Format, typename ... Args>
+void log(Format, Args ... args) {
+    constexpr const char *fmt = Format::str();
+    static_assert(format_matches_count<Args...>(fmt),
+                  "Log format string is malformed or doesn't match the number of arguments!");
+    static_assert(format_matches_types<Args...>(fmt),
+                  "Log argument type doesn't match its format conversion!");
+    static_assert(args_size<Args...> <= MAX_ARGUMENTS_SIZE, "Too many arguments to logger!");
+
+    static constexpr LogSite site {
+        fmt, arg_types<Args...>, sizeof...(Args), static_cast<std::uint8_t>(args_size<Args...>)
+    };
+
+    const LogData header { &site, cycles::now() };
+    std::uint8_t record[sizeof(LogData) + args_size<Args...>];
+    std::memcpy(record, &header, sizeof(header));
+
+    [[maybe_unused]] std::uint8_t *dst = record + sizeof(header);
+    (pack(dst, args), ...);
+
+    logger::log(record, sizeof(record));
+}
+
+}  // namespace detail
 
 }  // namespace logger
+
+/**
+ * Queues data to be logged.
+ *
+ * @param fmt  The string format to be logged. Must be a string literal. Supports the character,
+ *             integer, string, pointer and float conversions (%c/%d/%i/%u/%x/%X/%o/%b/%s/%p/%f)
+ *             with flags, width, precision and length modifiers; '*' is not supported. Checked
+ *             against the argument types at compile time.
+ * @param ...  The arguments for the string format. Stored at their natural widths.
+ */
+#define LOG(fmt, ...)                                                       \
+    ::logger::detail::log([] {                                              \
+        struct format { static constexpr const char *str() { return fmt; } }; \
+        return format {};                                                   \
+    }(), ##__VA_ARGS__)
@@ -0,0 +1,106 @@
+/*
+ * mpsc_queue.h
+ *
+ * A bounded, lock-free, multi-producer single-consumer queue of fixed-size items. Producers may
+ * be threads or ISRs; none of them ever waits on another, so a producer preempted mid-push only
+ * holds back the consumer, which sees the queue as ending at that slot until the push finishes.
+ *
+ * Each slot carries a sequence number telling which lap of the ring it's ready for: a producer
+ * claims a slot by advancing the head with compare-and-swap, fills it, then publishes it by
+ * bumping the slot's sequence. Built on std::atomic, which is LDREX/STREX on the Cortex-M33.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+template <typename T, std::size_t SIZE>
+class mpsc_queue {
+    static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "SIZE must be a power of 2");
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    mpsc_queue() : _head { 0 }, _tail { 0 } {
+        for (std::uint32_t i = 0; i < SIZE; ++i) {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Adds an item. Safe from any thread or ISR.
+     *
+     * @return false if the queue is full.
+     */
+    bool push(const T &item) {
+        auto pos = _head.load(std::memory_order_relaxed);
+        slot *s;
+
+        while (true) {
+            s = &_slots[pos & (SIZE - 1)];
+            const auto lap = static_cast<std::int32_t>(s->sequence.load(std::memory_order_acquire) - pos);
+
+            if (lap == 0) {
+                /* Free for this lap; claim it, or reload pos if another producer got there first */
+                if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (lap < 0) {
+                /* Still holds last lap's item */
+                return false;
+            } else {
+                pos = _head.load(std::memory_order_relaxed);
+            }
+        }
+
+        s->item = item;
+        s->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Takes the oldest item. Only call from the consumer.
+     *
+     * @return false if the queue is empty, or its oldest item is still being pushed.
+     */
+    bool pop(T &item) {
+        auto &s = _slots[_tail & (SIZE - 1)];
+        if (s.sequence.load(std::memory_order_acquire) != _tail + 1) {
+            return false;
+        }
+
+        item = s.item;
+        s.sequence.store(_tail + SIZE, std::memory_order_release);
+        ++_tail;
+        return true;
+    }
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct slot {
+        /** pos when free for the push at pos, pos + 1 once that push is published. */
+        std::atomic<std::uint32_t> sequence;
+        T item;
+    };
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    slot _slots[SIZE];
+    /** Next position to push, shared by producers. */
+    std::atomic<std::uint32_t> _head;
+    /** Next position to pop, owned by the consumer. */
+    std::uint32_t _tail;
+};
@@ -0,0 +1,72 @@
+/*
+ * ospi_flash.cpp
+ *
+ * Shared access to the OSPI NOR flash (MX25LM51245G). Hard-coded to work with the STM32L562E-DK
+ * BSP.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#include "ospi_flash.h"
+
+#include <cmsis_os.h>
+
+namespace ospi_flash {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool g_ready { false };
+
+static osMutexId_t g_mutex {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public implementations
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+lock::lock() :
+        _held { g_mutex != nullptr && osKernelGetState() == osKernelRunning &&
+                osMutexAcquire(g_mutex, osWaitForever) == osOK } {
+
+}
+
+lock::~lock() {
+    if (_held) {
+        osMutexRelease(g_mutex);
+    }
+}
+
+bool init() {
+    g_mutex = osMutexNew(nullptr);
+    if (g_mutex == nullptr) {
+        return false;
+    }
+
+    BSP_OSPI_NOR_Init_t ospi_init {};
+    ospi_init.InterfaceMode = BSP_OSPI_NOR_OPI_MODE;
+    /* STR so writes don't need to be an even number of bytes at an even address */
+    ospi_init.TransferRate = BSP_OSPI_NOR_STR_TRANSFER;
+
+    g_ready = BSP_OSPI_NOR_Init(INSTANCE, &ospi_init) == BSP_ERROR_NONE;
+    return g_ready;
+}
+
+bool ready() {
+    return g_ready;
+}
+
+bool busy() {
+    return BSP_OSPI_NOR_GetStatus(INSTANCE) != BSP_ERROR_NONE;
+}
+
+void wait() {
+    while (busy()) {
+        if (osKernelGetState() == osKernelRunning) {
+            osDelay(1);
+        }
+    }
+}
+
+}  // namespace ospi_flash
@@ -0,0 +1,74 @@
+/*
+ * ospi_flash.h
+ *
+ * Shared access to the OSPI NOR flash (MX25LM51245G). The log store and the terminal scrollback
+ * keep their own regions of it but run on different threads, and the BSP driver isn't thread
+ * safe, so every access goes through a lock. Hard-coded to work with the STM32L562E-DK BSP.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#pragma once
+
+#include "stm32l562e_discovery_ospi.h"
+
+#include <cstdint>
+
+namespace ospi_flash {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** BSP instance of the flash. */
+inline constexpr std::uint32_t INSTANCE { 0 };
+
+/** The smallest erasable block. */
+inline constexpr std::uint32_t SECTOR_SIZE { MX25LM51245G_SUBSECTOR_4K };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Types
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Holds the flash for as long as it's in scope. Before the scheduler starts there's only one
+ * thread, so it does nothing.
+ */
+class lock {
+public:
+    lock();
+    ~lock();
+
+    lock(const lock &) = delete;
+    lock &operator=(const lock &) = delete;
+
+private:
+    bool _held;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Initializes the flash in octal STR mode, and the lock. Call once, after the kernel is
+ * initialized and before the flash is used.
+ *
+ * @return true on success, false if the flash couldn't be used.
+ */
+bool init();
+
+/** Whether init() succeeded. */
+bool ready();
+
+/** Whether the flash is busy with a program or erase. Hold the lock. */
+bool busy();
+
+/**
+ * Waits for a program or erase in progress to finish; needed before a read, which the BSP
+ * doesn't wait for. Hold the lock.
+ */
+void wait();
+
+}  // namespace ospi_flash
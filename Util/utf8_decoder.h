@@ -0,0 +1,119 @@
+/*
+ * utf8_decoder.h
+ *
+ * An incremental UTF-8 decoder, fed a byte at a time. Its state carries over between calls, so a
+ * character split across two BLE writes decodes the same as one that arrives whole.
+ *
+ * Malformed input never stops decoding: each maximal invalid subpart (an unexpected continuation
+ * byte, a byte that can never appear, or a sequence cut short by the next lead byte) becomes one
+ * U+FFFD, as the Unicode standard recommends. Overlong forms, surrogates and codepoints above
+ * U+10FFFF are all rejected by checking the second byte of a sequence against its lead byte.
+ *
+ *  Created on: Jan 5, 2021
+ *      Author: cmklu
+ */
+
+#pragma once
+
+#include <cstdint>
+
+class utf8_decoder {
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Constants
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Emitted in place of malformed input. */
+    static constexpr char32_t REPLACEMENT { 0xFFFD };
+
+public:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    utf8_decoder() : _codepoint { 0 }, _remaining { 0 }, _lower { 0x80 }, _upper { 0xBF } {
+
+    }
+
+    /** Drops any partly decoded character. */
+    void reset() {
+        _remaining = 0;
+        _lower = 0x80;
+        _upper = 0xBF;
+    }
+
+    /**
+     * Decodes one byte.
+     *
+     * @param byte the next byte of the stream.
+     * @param emit called with each codepoint the byte completes: none, one, or two when the byte
+     *             cuts a sequence short (U+FFFD, then whatever the byte decodes to).
+     */
+    template <typename F>
+    void feed(std::uint8_t byte, F &&emit) {
+        if (_remaining != 0) {
+            if (byte >= _lower && byte <= _upper) {
+                _codepoint = (_codepoint << 6) | (byte & 0x3FU);
+                _lower = 0x80;
+                _upper = 0xBF;
+                if (--_remaining == 0) {
+                    emit(_codepoint);
+                }
+                return;
+            }
+
+            /* The sequence so far is one invalid subpart; the byte starts afresh */
+            _remaining = 0;
+            emit(REPLACEMENT);
+        }
+
+        if (byte < 0x80) {
+            emit(static_cast<char32_t>(byte));
+        } else if (byte >= 0xC2 && byte <= 0xDF) {
+            start(byte & 0x1FU, 1);
+        } else if (byte >= 0xE0 && byte <= 0xEF) {
+            start(byte & 0x0FU, 2);
+            if (byte == 0xE0) {
+                _lower = 0xA0;  /* overlong */
+            } else if (byte == 0xED) {
+                _upper = 0x9F;  /* surrogates */
+            }
+        } else if (byte >= 0xF0 && byte <= 0xF4) {
+            start(byte & 0x07U, 3);
+            if (byte == 0xF0) {
+                _lower = 0x90;  /* overlong */
+            } else if (byte == 0xF4) {
+                _upper = 0x8F;  /* above U+10FFFF */
+            }
+        } else {
+            /* A stray continuation byte, or C0, C1, F5 to FF */
+            emit(REPLACEMENT);
+        }
+    }
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Data
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** The bits decoded so far, and the continuation bytes still to come. */
+    char32_t _codepoint;
+    std::uint8_t _remaining;
+    /** Range the next continuation byte must fall in. */
+    std::uint8_t _lower;
+    std::uint8_t _upper;
+
+private:
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Starts a sequence; the lead byte may narrow the range after this. */
+    void start(std::uint32_t bits, std::uint8_t remaining) {
+        /* A sequence cut short may have left the range narrowed */
+        _lower = 0x80;
+        _upper = 0xBF;
+        _codepoint = bits;
+        _remaining = remaining;
+    }
+};
@@ -46,6 +46,9 @@
          UTIL_LCD_GetBackColor()
          UTIL_LCD_SetFont()
          UTIL_LCD_GetFont()
+         UTIL_LCD_SetGlyphCache()
+         UTIL_LCD_ClearGlyphCache()
+         UTIL_LCD_GetGlyphCacheStats()
          UTIL_LCD_Clear)
          UTIL_LCD_ClearStringLine()
          UTIL_LCD_DisplayStringAtLine()
@@ -128,6 +131,21 @@ typedef struct
   uint32_t y3;
 }Triangle_Positions_t;
 
+#if (UTIL_LCD_GLYPH_CACHE_ENTRIES > 0U)
+/**
+  * @brief  Glyph expanded to RGB565 for one font and pair of colors
+  */
+typedef struct
+{
+  const sFONT *pFont;     /*!< Font the glyph comes from, NULL if the entry is unused */
+  uint16_t     TextColor; /*!< RGB565 text color */
+  uint16_t     BackColor; /*!< RGB565 background color */
+  uint8_t      Ascii;     /*!< Character */
+  uint32_t     LastUse;   /*!< Value of GlyphCacheClock when last drawn, for LRU eviction */
+  uint16_t     Pixels[UTIL_LCD_GLYPH_CACHE_MAX_PIXELS];
+} UTIL_LCD_Glyph_t;
+#endif
+
 /**
   * @}
   */
@@ -142,6 +160,24 @@ typedef struct
 static UTIL_LCD_Ctx_t DrawProp[UTIL_LCD_MAX_LAYERS_NBR];
 static LCD_UTILS_Drv_t FuncDriver;
 
+#if (UTIL_LCD_GLYPH_CACHE_ENTRIES > 0U)
+/**
+  * @brief  Glyph cache, its LRU clock and statistics
+  */
+static UTIL_LCD_Glyph_t GlyphCache[UTIL_LCD_GLYPH_CACHE_ENTRIES];
+static uint32_t GlyphCacheClock;
+static uint32_t GlyphCacheEnabled = 1U;
+static uint32_t GlyphCacheHits;
+static uint32_t GlyphCacheMisses;
+#endif
+
+#if (UTIL_LCD_STRING_STRIP_PIXELS > 0U)
+/**
+  * @brief  Rows of a run of text, all glyphs of each row side by side
+  */
+static uint16_t StringStrip[UTIL_LCD_STRING_STRIP_PIXELS];
+#endif
+
 /**
   * @}
   */
@@ -150,6 +186,13 @@ static LCD_UTILS_Drv_t FuncDriver;
   * @{
   */
 static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData);
+static void ExpandChar(const uint8_t *pData, uint16_t *pDst, uint16_t TextColor, uint16_t BackColor);
+#if (UTIL_LCD_GLYPH_CACHE_ENTRIES > 0U)
+static const UTIL_LCD_Glyph_t *GetGlyph(uint8_t Ascii, const uint8_t *pData);
+#endif
+#if (UTIL_LCD_STRING_STRIP_PIXELS > 0U)
+static uint32_t DrawStringStrips(uint32_t Xpos, uint32_t Ypos, const uint8_t *Text, uint32_t Count);
+#endif
 static void FillTriangle(Triangle_Positions_t *Positions, uint32_t Color);
 /**
   * @}
@@ -264,6 +307,54 @@ sFONT *UTIL_LCD_GetFont(void)
   return DrawProp[DrawProp->LcdLayer].pFont;
 }
 
+/**
+  * @brief  Enables or disables the glyph cache. While enabled, RGB565 characters are expanded
+  *         once per font and colors, kept in RAM and drawn with a single FillRGBRect.
+  * @param  Enable 1 to use the glyph cache, 0 to expand every character as it is drawn
+  */
+void UTIL_LCD_SetGlyphCache(uint32_t Enable)
+{
+#if (UTIL_LCD_GLYPH_CACHE_ENTRIES > 0U)
+  GlyphCacheEnabled = Enable;
+#else
+  (void)Enable;
+#endif
+}
+
+/**
+  * @brief  Empties the glyph cache and resets its statistics.
+  */
+void UTIL_LCD_ClearGlyphCache(void)
+{
+#if (UTIL_LCD_GLYPH_CACHE_ENTRIES > 0U)
+  uint32_t i;
+
+  for (i = 0; i < UTIL_LCD_GLYPH_CACHE_ENTRIES; i++)
+  {
+    GlyphCache[i].pFont = NULL;
+  }
+  GlyphCacheClock  = 0;
+  GlyphCacheHits   = 0;
+  GlyphCacheMisses = 0;
+#endif
+}
+
+/**
+  * @brief  Gets the glyph cache statistics.
+  * @param  Hits   Number of characters drawn from the cache
+  * @param  Misses Number of characters that had to be expanded into the cache
+  */
+void UTIL_LCD_GetGlyphCacheStats(uint32_t *Hits, uint32_t *Misses)
+{
+#if (UTIL_LCD_GLYPH_CACHE_ENTRIES > 0U)
+  *Hits   = GlyphCacheHits;
+  *Misses = GlyphCacheMisses;
+#else
+  *Hits   = 0;
+  *Misses = 0;
+#endif
+}
+
 /**
   * @brief  Draws a RGB rectangle in currently active layer.
   * @param  pData   Pointer to RGB rectangle data
@@ -377,16 +468,38 @@ void UTIL_LCD_ClearStringLine(uint32_t Line)
   * @param  Xpos Start column address
   * @param  Ypos Line where to display the character shape.
   * @param  Ascii Character ascii code
-  *           This parameter must be a number between Min_Data = 0x20 and Max_Data = 0x7E
+  *           This parameter must be a number between Min_Data = 0x20 and Max_Data = 0x7E;
+  *           anything else is drawn as a space, as the fonts have no glyph for it
   */
 void UTIL_LCD_DisplayChar(uint32_t Xpos, uint32_t Ypos, uint8_t Ascii)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[DrawProp->LcdLayer].pFont->table[(Ascii-' ') *\
-  DrawProp[DrawProp->LcdLayer].pFont->Height * ((DrawProp[DrawProp->LcdLayer].pFont->Width + 7) / 8)]);
+  const sFONT *pFont = DrawProp[DrawProp->LcdLayer].pFont;
+  const uint8_t *pData;
+
+  if ((Ascii < (uint8_t)' ') || (Ascii > (uint8_t)'~'))
+  {
+    Ascii = (uint8_t)' ';
+  }
+  pData = &pFont->table[(Ascii-' ') * pFont->Height * ((pFont->Width + 7) / 8)];
+
+#if (UTIL_LCD_GLYPH_CACHE_ENTRIES > 0U)
+  if ((GlyphCacheEnabled != 0U) &&
+      (DrawProp[DrawProp->LcdLayer].LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565) &&
+      ((uint32_t)pFont->Width * pFont->Height <= UTIL_LCD_GLYPH_CACHE_MAX_PIXELS))
+  {
+    /* Whole glyph in one transfer */
+    UTIL_LCD_FillRGBRect(Xpos, Ypos, (uint8_t *)GetGlyph(Ascii, pData)->Pixels, pFont->Width, pFont->Height);
+    return;
+  }
+#endif
+
+  DrawChar(Xpos, Ypos, pData);
 }
 
 /**
   * @brief  Displays characters in currently active layer.
+  * @note   In RGB565 the visible part of the string is rasterized a strip of pixel rows at a time,
+  *         each strip sent as one window, rather than a transfer per character.
   * @param  Xpos X position (in pixel)
   * @param  Ypos Y position (in pixel)
   * @param  Text Pointer to string to display on LCD
@@ -395,11 +508,13 @@ void UTIL_LCD_DisplayChar(uint32_t Xpos, uint32_t Ypos, uint8_t Ascii)
   *            @arg  CENTER_MODE
   *            @arg  RIGHT_MODE
   *            @arg  LEFT_MODE
+  * @retval Width in pixels of the part of the string that landed on the screen
   */
-void UTIL_LCD_DisplayStringAt(uint32_t Xpos, uint32_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode)
+uint32_t UTIL_LCD_DisplayStringAt(uint32_t Xpos, uint32_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode)
 {
   uint32_t refcolumn = 1, i = 0;
   uint32_t size = 0, xsize = 0;
+  uint32_t count = 0, extent = 0;
   uint8_t  *ptr = Text;
 
   /* Get the text size */
@@ -438,8 +553,32 @@ void UTIL_LCD_DisplayStringAt(uint32_t Xpos, uint32_t Ypos, uint8_t *Text, Text_
     refcolumn = 1;
   }
 
+  /* Count the characters that would be sent, at most a screen width of them */
+  while ((Text[count] != 0) & (((DrawProp->LcdXsize - (count*DrawProp[DrawProp->LcdLayer].pFont->Width)) & 0xFFFF) >= DrawProp[DrawProp->LcdLayer].pFont->Width))
+  {
+    count++;
+  }
+
+  /* Part of the run that is on the screen */
+  if (refcolumn < DrawProp->LcdXsize)
+  {
+    extent = count * DrawProp[DrawProp->LcdLayer].pFont->Width;
+    if (extent > (DrawProp->LcdXsize - refcolumn))
+    {
+      extent = DrawProp->LcdXsize - refcolumn;
+    }
+  }
+
+#if (UTIL_LCD_STRING_STRIP_PIXELS > 0U)
+  if ((DrawProp[DrawProp->LcdLayer].LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565) &&
+      (extent <= UTIL_LCD_STRING_STRIP_PIXELS))
+  {
+    return DrawStringStrips(refcolumn, Ypos, Text, count);
+  }
+#endif
+
   /* Send the string character by character on LCD */
-  while ((*Text != 0) & (((DrawProp->LcdXsize - (i*DrawProp[DrawProp->LcdLayer].pFont->Width)) & 0xFFFF) >= DrawProp[DrawProp->LcdLayer].pFont->Width))
+  for (i = 0; i < count; i++)
   {
     /* Display one character on LCD */
     UTIL_LCD_DisplayChar(refcolumn, Ypos, *Text);
@@ -448,8 +587,9 @@ void UTIL_LCD_DisplayStringAt(uint32_t Xpos, uint32_t Ypos, uint8_t *Text, Text_
 
     /* Point on the next character */
     Text++;
-    i++;
   }
+
+  return extent;
 }
 
 /**
@@ -951,6 +1091,8 @@ static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
   width  = DrawProp[DrawProp->LcdLayer].pFont->Width;
   uint16_t rgb565[24];
   uint32_t argb8888[24];
+  uint16_t text565 = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].TextColor);
+  uint16_t back565 = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].BackColor);
 
   offset =  8 *((width + 7)/8) -  width ;
 
@@ -981,11 +1123,11 @@ static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
       {
         if(line & (1 << (width- j + offset- 1)))
         {
-          rgb565[j] = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].TextColor);
+          rgb565[j] = text565;
         }
         else
         {
-          rgb565[j] = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].BackColor);
+          rgb565[j] = back565;
         }
       }
       UTIL_LCD_FillRGBRect(Xpos,  Ypos++, (uint8_t*)&rgb565[0], width, 1);
@@ -1008,6 +1150,174 @@ static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
   }
 }
 
+/**
+  * @brief  Expands a whole character to RGB565.
+  * @param  pData     Pointer to the character data
+  * @param  pDst      Destination for Width x Height pixels, row by row
+  * @param  TextColor RGB565 text color
+  * @param  BackColor RGB565 background color
+  */
+static void ExpandChar(const uint8_t *pData, uint16_t *pDst, uint16_t TextColor, uint16_t BackColor)
+{
+  uint32_t i, j;
+  uint32_t height = DrawProp[DrawProp->LcdLayer].pFont->Height;
+  uint32_t width  = DrawProp[DrawProp->LcdLayer].pFont->Width;
+  uint32_t bytes  = (width + 7U) / 8U;
+  uint32_t line;
+  uint32_t mask;
+
+  for (i = 0; i < height; i++)
+  {
+    line = 0;
+    for (j = 0; j < bytes; j++)
+    {
+      line = (line << 8) | pData[(bytes * i) + j];
+    }
+
+    /* Leftmost pixel is the most significant bit */
+    mask = 1UL << ((8U * bytes) - 1U);
+    for (j = 0; j < width; j++)
+    {
+      *pDst++ = ((line & mask) != 0U) ? TextColor : BackColor;
+      mask >>= 1;
+    }
+  }
+}
+
+#if (UTIL_LCD_GLYPH_CACHE_ENTRIES > 0U)
+/**
+  * @brief  Finds a character in the glyph cache for the current font and colors, expanding it
+  *         into the least recently used entry if it isn't there.
+  * @param  Ascii Character ascii code
+  * @param  pData Pointer to the character data
+  * @retval Cached glyph
+  */
+static const UTIL_LCD_Glyph_t *GetGlyph(uint8_t Ascii, const uint8_t *pData)
+{
+  const sFONT *pFont = DrawProp[DrawProp->LcdLayer].pFont;
+  uint16_t text565 = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].TextColor);
+  uint16_t back565 = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].BackColor);
+  UTIL_LCD_Glyph_t *pLru = &GlyphCache[0];
+  uint32_t i;
+
+  GlyphCacheClock++;
+
+  for (i = 0; i < UTIL_LCD_GLYPH_CACHE_ENTRIES; i++)
+  {
+    UTIL_LCD_Glyph_t *pGlyph = &GlyphCache[i];
+
+    if ((pGlyph->pFont == pFont) && (pGlyph->Ascii == Ascii) &&
+        (pGlyph->TextColor == text565) && (pGlyph->BackColor == back565))
+    {
+      pGlyph->LastUse = GlyphCacheClock;
+      GlyphCacheHits++;
+      return pGlyph;
+    }
+
+    /* Unused entries are picked first, then the least recently drawn */
+    if ((pLru->pFont != NULL) && ((pGlyph->pFont == NULL) || (pGlyph->LastUse < pLru->LastUse)))
+    {
+      pLru = pGlyph;
+    }
+  }
+
+  ExpandChar(pData, pLru->Pixels, text565, back565);
+  pLru->pFont     = pFont;
+  pLru->Ascii     = Ascii;
+  pLru->TextColor = text565;
+  pLru->BackColor = back565;
+  pLru->LastUse   = GlyphCacheClock;
+  GlyphCacheMisses++;
+
+  return pLru;
+}
+#endif
+
+#if (UTIL_LCD_STRING_STRIP_PIXELS > 0U)
+/**
+  * @brief  Draws a run of characters in RGB565, clipped to the screen. Rows are rasterized into
+  *         StringStrip as many at a time as fit, every glyph of a row side by side, and each
+  *         strip is sent with a single window write.
+  * @param  Xpos  Start column address
+  * @param  Ypos  Line where to display the characters
+  * @param  Text  Pointer to the characters
+  * @param  Count Number of characters
+  * @retval Width in pixels of the part of the run that was drawn
+  */
+static uint32_t DrawStringStrips(uint32_t Xpos, uint32_t Ypos, const uint8_t *Text, uint32_t Count)
+{
+  const sFONT *pFont = DrawProp[DrawProp->LcdLayer].pFont;
+  uint16_t text565 = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].TextColor);
+  uint16_t back565 = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].BackColor);
+  uint32_t width   = pFont->Width;
+  uint32_t bytes   = (width + 7U) / 8U;
+  uint32_t glyph   = pFont->Height * bytes;
+  uint32_t extent, height, rows, row, last, i, j, k;
+  uint32_t line, mask;
+  uint16_t *pDst;
+
+  if ((Xpos >= DrawProp->LcdXsize) || (Ypos >= DrawProp->LcdYsize) || (Count == 0U))
+  {
+    return 0;
+  }
+
+  extent = Count * width;
+  if (extent > (DrawProp->LcdXsize - Xpos))
+  {
+    extent = DrawProp->LcdXsize - Xpos;
+  }
+
+  height = pFont->Height;
+  if (height > (DrawProp->LcdYsize - Ypos))
+  {
+    height = DrawProp->LcdYsize - Ypos;
+  }
+
+  /* Characters with at least one column on the screen, the last maybe only partly */
+  Count = (extent + width - 1U) / width;
+  last  = extent - ((Count - 1U) * width);
+
+  rows = UTIL_LCD_STRING_STRIP_PIXELS / extent;
+
+  for (row = 0; row < height; row += rows)
+  {
+    if (rows > (height - row))
+    {
+      rows = height - row;
+    }
+
+    pDst = StringStrip;
+    for (i = row; i < (row + rows); i++)
+    {
+      for (j = 0; j < Count; j++)
+      {
+        uint32_t index = ((Text[j] < (uint8_t)' ') || (Text[j] > (uint8_t)'~')) ? 0U : (Text[j] - (uint32_t)' ');
+        const uint8_t *pData = &pFont->table[(index * glyph) + (i * bytes)];
+        uint32_t columns = (j == (Count - 1U)) ? last : width;
+
+        line = 0;
+        for (k = 0; k < bytes; k++)
+        {
+          line = (line << 8) | pData[k];
+        }
+
+        /* Leftmost pixel is the most significant bit */
+        mask = 1UL << ((8U * bytes) - 1U);
+        for (k = 0; k < columns; k++)
+        {
+          *pDst++ = ((line & mask) != 0U) ? text565 : back565;
+          mask >>= 1;
+        }
+      }
+    }
+
+    UTIL_LCD_FillRGBRect(Xpos, Ypos + row, (uint8_t *)StringStrip, extent, rows);
+  }
+
+  return extent;
+}
+#endif
+
 /**
   * @brief  Fills a triangle (between 3 points).
   * @param  Positions  pointer to riangle coordinates
@@ -98,6 +98,29 @@
   */
 #define UTIL_LCD_DEFAULT_FONT        Font24
 
+/**
+  * @brief LCD Utility glyph cache: number of expanded RGB565 glyphs kept in RAM (0 to disable)
+  *        and the largest glyph, in pixels, that can be cached. Sized for Font16, the terminal's
+  *        font (Font8 and Font12 fit too, larger fonts are drawn uncached). Each entry takes
+  *        2 bytes a pixel plus 16, so the default 48 entries of 11x16 take 17.3 KB of RAM. Fewer
+  *        entries than the characters a screen cycles through makes LRU miss on every one.
+  */
+#ifndef UTIL_LCD_GLYPH_CACHE_ENTRIES
+#define UTIL_LCD_GLYPH_CACHE_ENTRIES     48U
+#endif
+#ifndef UTIL_LCD_GLYPH_CACHE_MAX_PIXELS
+#define UTIL_LCD_GLYPH_CACHE_MAX_PIXELS  (11U * 16U)
+#endif
+
+/**
+  * @brief LCD Utility string strip: RGB565 pixels UTIL_LCD_DisplayStringAt() rasterizes a run of
+  *        text into before sending it as one window, as many whole pixel rows of the run as fit
+  *        (0 to draw strings character by character)
+  */
+#ifndef UTIL_LCD_STRING_STRIP_PIXELS
+#define UTIL_LCD_STRING_STRIP_PIXELS     (240U * 8U)
+#endif
+
 /**
   * @}
   */
@@ -172,10 +195,14 @@ uint32_t UTIL_LCD_GetBackColor(void);
 void     UTIL_LCD_SetFont(sFONT *fonts);
 sFONT    *UTIL_LCD_GetFont(void);
 
+void     UTIL_LCD_SetGlyphCache(uint32_t Enable);
+void     UTIL_LCD_ClearGlyphCache(void);
+void     UTIL_LCD_GetGlyphCacheStats(uint32_t *Hits, uint32_t *Misses);
+
 void     UTIL_LCD_Clear(uint32_t Color);
 void     UTIL_LCD_ClearStringLine(uint32_t Line);
 void     UTIL_LCD_DisplayStringAtLine(uint32_t Line, uint8_t *ptr);
-void     UTIL_LCD_DisplayStringAt(uint32_t Xpos, uint32_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode);
+uint32_t UTIL_LCD_DisplayStringAt(uint32_t Xpos, uint32_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode);
 void     UTIL_LCD_DisplayChar(uint32_t Xpos, uint32_t Ypos, uint8_t Ascii);
 void     UTIL_LCD_GetPixel(uint16_t Xpos, uint16_t Ypos, uint32_t *Color);
 void     UTIL_LCD_SetPixel(uint16_t Xpos, uint16_t Ypos, uint32_t Color);